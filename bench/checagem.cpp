@@ -0,0 +1,117 @@
+/*!
+ * @file checagem.cpp
+ * @brief Compara o custo da verificação de limites (IFNUM_CHECKED) nos solvers existentes.
+ *
+ * O mesmo código é compilado duas vezes, com `-DIFNUM_CHECKED=1` e `-DIFNUM_CHECKED=0`
+ * (ver o alvo `bench-checagem` do Makefile), e cada binário imprime o menor tempo de cada
+ * caso: em máquinas compartilhadas, a mediana variava mais entre execuções do que entre os
+ * dois modos.
+ */
+
+#include "AlgebraLinear.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+
+using namespace ifnum;
+
+namespace
+{
+std::mt19937 gerador(42);
+
+/*!
+ * @brief Matriz aleatória diagonalmente dominante (bem condicionada, sem pivotamento).
+ */
+Matriz<double> matriz_dominante(size_t n, size_t colunas)
+{
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    Matriz<double> m(n, colunas);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < colunas; j++)
+            m.elemento(i, j) = dist(gerador);
+        if (i < colunas)
+            m.elemento(i, i) += static_cast<double>(n);
+    }
+    return m;
+}
+
+/*!
+ * @brief Menor tempo, em milissegundos, de `repeticoes` execuções de `preparar` + `medir`
+ *        (apenas `medir` é cronometrado).
+ */
+double minimo_ms(int repeticoes, const std::function<void()> &preparar,
+                  const std::function<void()> &medir)
+{
+    double menor = 0;
+    for (int r = 0; r < repeticoes; r++) {
+        preparar();
+        auto inicio = std::chrono::steady_clock::now();
+        medir();
+        auto fim = std::chrono::steady_clock::now();
+        const double ms = std::chrono::duration<double, std::milli>(fim - inicio).count();
+        menor = r == 0 ? ms : std::min(menor, ms);
+    }
+    return menor;
+}
+
+void relatar(const char *nome, size_t n, double ms)
+{
+    std::printf("IFNUM_CHECKED=%d  %-16s n=%-5zu %10.3f ms\n", IFNUM_CHECKED, nome, n, ms);
+}
+} // namespace
+
+int main()
+{
+    const int repeticoes = 15;
+    volatile double sumidouro = 0; // impede que o compilador descarte os resultados
+
+    {
+        const size_t n = 2000;
+        Matriz<double> A = matriz_dominante(n, n);
+        Matriz<double> b = matriz_dominante(n, 1);
+        relatar("sub", n, minimo_ms(repeticoes, [] {}, [&] { sumidouro = sub(A, b)(0, 0); }));
+        relatar("reversub", n,
+                minimo_ms(repeticoes, [] {}, [&] { sumidouro = reversub(A, b)(0, 0); }));
+    }
+
+    {
+        const size_t n = 400;
+        const Matriz<double> original = matriz_dominante(n, n);
+        const Matriz<double> b_original = matriz_dominante(n, 1);
+        Matriz<double> A(n, n), b(n, 1);
+        auto preparar = [&] {
+            A = original;
+            b = b_original;
+        };
+
+        relatar("gauss", n, minimo_ms(repeticoes, preparar, [&] {
+                    gauss(A.visao(), b.visao());
+                    sumidouro = b(0, 0);
+                }));
+        relatar("gauss_jordan", n, minimo_ms(repeticoes, preparar, [&] {
+                    gauss_jordan(A.visao(), b.visao());
+                    sumidouro = b(0, 0);
+                }));
+        relatar("retorna_L", n, minimo_ms(repeticoes, preparar, [&] {
+                    sumidouro = retorna_L(A)(n - 1, 0);
+                }));
+        relatar("decomposicaoLU", n, minimo_ms(repeticoes, [] {}, [&] {
+                    sumidouro = std::get<1>(decomposicaoLU(original))(0, 0);
+                }));
+    }
+
+    {
+        const size_t n = 1000;
+        const Matriz<double> A = matriz_dominante(n, n);
+        const Matriz<double> B = matriz_dominante(n, n);
+        Matriz<double> C(n, n);
+        relatar("A*2+B (expr.)", n, minimo_ms(repeticoes, [] {}, [&] {
+                    C = A * 2.0 + B;
+                    sumidouro = C(0, 0);
+                }));
+    }
+
+    return 0;
+}
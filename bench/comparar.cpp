@@ -0,0 +1,73 @@
+/*!
+ * @file comparar.cpp
+ * @brief Compara dois arquivos de resultados da suíte de benchmarks e aponta regressões.
+ *
+ * Uso: comparar BASE NOVO [--limiar FRACAO]
+ *
+ * BASE e NOVO são arquivos .json ou .csv gravados por `suite`. Para cada caso (nome, n)
+ * presente nos dois, compara as medianas; um aumento maior que o limiar (padrão: 0.10, ou
+ * 10%) é marcado como regressão, desde que a amostra mais rápida nova também seja mais
+ * lenta que a p95 base, isto é, que as duas distribuições não se sobreponham (para não
+ * acusar ruído de uma única execução). Retorna 1 se houver alguma regressão.
+ */
+
+#include "medicao.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+
+int main(int argc, char **argv)
+{
+    const auto uso = [&] {
+        std::fprintf(stderr, "Uso: %s BASE NOVO [--limiar FRACAO]\n", argv[0]);
+        return 2;
+    };
+    if (argc < 3)
+        return uso();
+    double limiar = 0.10;
+    for (int i = 3; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--limiar") && i + 1 < argc) {
+            char *fim = nullptr;
+            limiar = std::strtod(argv[++i], &fim);
+            if (fim == argv[i] || *fim != '\0' || !(limiar >= 0)) {
+                std::fprintf(stderr, "Limiar inválido: %s\n", argv[i]);
+                return uso();
+            }
+        } else {
+            std::fprintf(stderr, "Opção desconhecida: %s\n", argv[i]);
+            return uso();
+        }
+    }
+
+    std::map<std::pair<std::string, size_t>, bench::Resultado> base;
+    for (const bench::Resultado &r : bench::ler(argv[1]))
+        base[{r.nome, r.n}] = r;
+
+    int regressoes = 0, melhoras = 0, comparados = 0;
+    std::printf("%-22s %6s %14s %14s %9s\n", "caso", "n", "base (ns)", "novo (ns)", "variação");
+    for (const bench::Resultado &novo : bench::ler(argv[2])) {
+        const auto it = base.find({novo.nome, novo.n});
+        if (it == base.end())
+            continue;
+        const bench::Resultado &antigo = it->second;
+        const double variacao = novo.mediana_ns / antigo.mediana_ns - 1;
+        const char *marca = "";
+        if (variacao > limiar && novo.min_ns > antigo.p95_ns) {
+            marca = "  REGRESSÃO";
+            regressoes++;
+        } else if (variacao < -limiar) {
+            marca = "  melhora";
+            melhoras++;
+        }
+        comparados++;
+        std::printf("%-22s %6zu %14.0f %14.0f %+8.1f%%%s\n", novo.nome.c_str(), novo.n,
+                    antigo.mediana_ns, novo.mediana_ns, 100 * variacao, marca);
+    }
+
+    std::printf("\n%d casos comparados, %d regressões e %d melhoras (limiar de %.0f%%).\n",
+                comparados, regressoes, melhoras, 100 * limiar);
+    return regressoes ? 1 : 0;
+}
@@ -0,0 +1,153 @@
+/*!
+ * @file cordic.cpp
+ * @brief Compara as funções CORDIC (escalares e em lote) com as equivalentes de <cmath>.
+ *
+ * Para cada função, imprime o tempo médio por valor (mediana de várias repetições) e o
+ * maior erro observado em relação a <cmath>. Executado pelo alvo `bench-cordic` do Makefile.
+ */
+
+#include "Cordic.hpp"
+#include "CordicFixo.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace cordic = ifnum::cordic;
+
+namespace
+{
+constexpr double GRAUS = 180.0 / M_PI;
+
+/*!
+ * @brief Mediana, em nanossegundos por valor, de `repeticoes` execuções de `medir`.
+ */
+double mediana_ns(int repeticoes, size_t n, const std::function<void()> &medir)
+{
+    std::vector<double> tempos;
+    for (int r = 0; r < repeticoes; r++) {
+        auto inicio = std::chrono::steady_clock::now();
+        medir();
+        auto fim = std::chrono::steady_clock::now();
+        tempos.push_back(std::chrono::duration<double, std::nano>(fim - inicio).count() / n);
+    }
+    std::nth_element(tempos.begin(), tempos.begin() + repeticoes / 2, tempos.end());
+    return tempos[repeticoes / 2];
+}
+
+/*!
+ * @brief Maior diferença entre `obtido` e `referencia`, relativa ou absoluta.
+ */
+double erro_maximo(const std::vector<double> &obtido, const std::vector<double> &referencia,
+                   bool relativo)
+{
+    double erro = 0;
+    for (size_t i = 0; i < obtido.size(); i++) {
+        double d = std::fabs(obtido[i] - referencia[i]);
+        if (relativo)
+            d /= std::fabs(referencia[i]);
+        erro = std::max(erro, d);
+    }
+    return erro;
+}
+
+void relatar(const char *nome, double cmath_ns, double escalar_ns, double lote_ns, double erro,
+             const char *tipo_erro)
+{
+    std::printf("%-8s cmath %7.2f ns   cordic %7.2f ns   lote %7.2f ns   erro %s %.2e\n", nome,
+                cmath_ns, escalar_ns, lote_ns, tipo_erro, erro);
+}
+} // namespace
+
+int main()
+{
+    const int repeticoes = 9;
+    const size_t n = 1 << 20;
+    std::mt19937 gerador(42);
+    std::uniform_real_distribution<double> simetrica(-1.0, 1.0);
+    std::uniform_real_distribution<double> expoente(-300.0, 300.0);
+    std::uniform_real_distribution<double> argumento_exp(-700.0, 700.0);
+
+    std::vector<double> x(n), y(n), positivos(n), argumentos(n);
+    for (size_t i = 0; i < n; i++) {
+        x[i] = simetrica(gerador);
+        y[i] = simetrica(gerador);
+        positivos[i] = std::pow(10.0, expoente(gerador));
+        argumentos[i] = argumento_exp(gerador);
+    }
+    std::vector<double> referencia(n), escalar(n), lote(n);
+
+    auto comparar = [&](const char *nome, const std::function<double(size_t)> &padrao,
+                        const std::function<double(size_t)> &unitario,
+                        const std::function<void()> &em_lote, bool relativo) {
+        const double t_cmath = mediana_ns(repeticoes, n, [&] {
+            for (size_t i = 0; i < n; i++)
+                referencia[i] = padrao(i);
+        });
+        const double t_escalar = mediana_ns(repeticoes, n, [&] {
+            for (size_t i = 0; i < n; i++)
+                escalar[i] = unitario(i);
+        });
+        const double t_lote = mediana_ns(repeticoes, n, em_lote);
+        const double erro = erro_maximo(lote, referencia, relativo);
+        relatar(nome, t_cmath, t_escalar, t_lote, erro, relativo ? "rel" : "abs");
+        return erro;
+    };
+
+    comparar(
+        "atan2", [&](size_t i) { return std::atan2(y[i], x[i]) * GRAUS; },
+        [&](size_t i) { return cordic::atan2(y[i], x[i]); },
+        [&] { cordic::atan2(y.data(), x.data(), lote.data(), n); }, false);
+    comparar(
+        "hypot", [&](size_t i) { return std::hypot(x[i], y[i]); },
+        [&](size_t i) { return cordic::hypot(x[i], y[i]); },
+        [&] { cordic::hypot(x.data(), y.data(), lote.data(), n); }, true);
+    comparar(
+        "exp", [&](size_t i) { return std::exp(argumentos[i]); },
+        [&](size_t i) { return cordic::exp(argumentos[i]); },
+        [&] { cordic::exp(argumentos.data(), lote.data(), n); }, true);
+    comparar(
+        "log", [&](size_t i) { return std::log(positivos[i]); },
+        [&](size_t i) { return cordic::log(positivos[i]); },
+        [&] { cordic::log(positivos.data(), lote.data(), n); }, false);
+    comparar(
+        "sqrt", [&](size_t i) { return std::sqrt(positivos[i]); },
+        [&](size_t i) { return cordic::sqrt(positivos[i]); },
+        [&] { cordic::sqrt(positivos.data(), lote.data(), n); }, true);
+
+    // Para o seno, o lote é o motor em ponto fixo (CordicFixo), que não tem versão escalar
+    // em ponto flutuante; a coluna "cordic" é cordic::sin.
+    std::vector<double> angulos(n);
+    for (size_t i = 0; i < n; i++)
+        angulos[i] = 360.0 * simetrica(gerador);
+    comparar(
+        "sin", [&](size_t i) { return std::sin(angulos[i] / GRAUS); },
+        [&](size_t i) { return cordic::sin(angulos[i]); },
+        [&] { cordic::CordicFixo<>::sin(angulos.data(), lote.data(), n); }, false);
+
+    // O cosseno usa o lote em ponto flutuante, nos mesmos ângulos de até ±360°: a rotação só
+    // converge até 99.9°, então isto confere a redução do ângulo, que a escalar também faz.
+    const double erro_cos = comparar(
+        "cos", [&](size_t i) { return std::cos(angulos[i] / GRAUS); },
+        [&](size_t i) { return cordic::cos(angulos[i]); },
+        [&] { cordic::cos(angulos.data(), lote.data(), n); }, false);
+    const double especiais[] = {250.0, -135.0, 720.5, 1e20, NAN, INFINITY};
+    double sin_especiais[std::size(especiais)];
+    cordic::sin(especiais, sin_especiais, std::size(especiais));
+    bool falhou = erro_cos > 1e-8 || lote != escalar;
+    for (size_t i = 0; i < std::size(especiais); i++) {
+        const double esperado = std::sin(std::fmod(especiais[i], 360.0) / GRAUS);
+        if (std::isnan(esperado) ? !std::isnan(sin_especiais[i])
+                                 : std::fabs(sin_especiais[i] - esperado) > 1e-8)
+            falhou = true;
+    }
+    if (falhou) {
+        std::printf("FALHOU: cordic::sin/cos fora de [-90°, 90°]\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,214 @@
+/*!
+ * @file medicao.hpp
+ * @brief Infraestrutura de medição usada pela suíte de benchmarks (`make bench`).
+ *
+ * Cada caso é aquecido, calibrado (chamadas curtas são agrupadas em lotes, para que o custo
+ * do relógio não domine) e repetido até um número de amostras ou um orçamento de tempo.
+ * Do conjunto de amostras saem mediana, p95 e mínimo por chamada, e, a partir das
+ * operações e bytes informados pelo caso, GFLOP/s e GB/s. Os resultados são gravados em
+ * JSON (um resultado por linha) ou CSV, e lidos de volta pela ferramenta de comparação.
+ */
+
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+/*!
+ * @brief Parâmetros de medição de um caso.
+ */
+struct Opcoes {
+    int repeticoes = 15;          //!< Amostras desejadas.
+    int minimo = 3;               //!< Amostras mínimas, mesmo estourando o orçamento.
+    double orcamento_s = 1.0;     //!< Tempo máximo de amostragem por caso.
+    double aquecimento_s = 0.05;  //!< Tempo mínimo de aquecimento (ao menos uma chamada).
+    double alvo_amostra_s = 2e-3; //!< Duração mínima de uma amostra (define o lote).
+};
+
+/*!
+ * @brief Estatísticas de um caso (tempos por chamada, em nanossegundos).
+ */
+struct Resultado {
+    std::string nome;
+    size_t n = 0;
+    int amostras = 0;
+    long lote = 1;
+    double mediana_ns = 0;
+    double p95_ns = 0;
+    double min_ns = 0;
+    double gflops = 0; //!< 0 se o caso não informa operações.
+    double gbs = 0;    //!< 0 se o caso não informa bytes.
+};
+
+/*!
+ * @brief Mede f() e calcula as estatísticas.
+ *
+ * @param nome Nome do caso.
+ * @param n Tamanho do problema.
+ * @param flops Operações de ponto flutuante por chamada (0 se não se aplica).
+ * @param bytes Tráfego mínimo de memória por chamada (0 se não se aplica).
+ * @param f Código medido.
+ * @param opcoes Parâmetros de medição.
+ * @return Estatísticas por chamada.
+ */
+template <typename F>
+Resultado medir(const std::string &nome, size_t n, double flops, double bytes, F &&f,
+                const Opcoes &opcoes = {})
+{
+    using relogio = std::chrono::steady_clock;
+    auto segundos = [](relogio::duration d) { return std::chrono::duration<double>(d).count(); };
+
+    // Aquecimento, que também estima o custo de uma chamada
+    long chamadas = 0;
+    const auto inicio = relogio::now();
+    do {
+        f();
+        chamadas++;
+    } while (segundos(relogio::now() - inicio) < opcoes.aquecimento_s);
+    const double por_chamada = segundos(relogio::now() - inicio) / chamadas;
+
+    Resultado r;
+    r.nome = nome;
+    r.n = n;
+    r.lote = std::max(1L, static_cast<long>(opcoes.alvo_amostra_s / por_chamada));
+
+    std::vector<double> amostras;
+    const auto inicio_amostras = relogio::now();
+    while (static_cast<int>(amostras.size()) < opcoes.repeticoes &&
+           (static_cast<int>(amostras.size()) < opcoes.minimo ||
+            segundos(relogio::now() - inicio_amostras) < opcoes.orcamento_s)) {
+        const auto t0 = relogio::now();
+        for (long i = 0; i < r.lote; i++)
+            f();
+        amostras.push_back(segundos(relogio::now() - t0) * 1e9 / r.lote);
+    }
+
+    std::sort(amostras.begin(), amostras.end());
+    const size_t k = amostras.size();
+    r.amostras = static_cast<int>(k);
+    r.mediana_ns = k % 2 ? amostras[k / 2] : (amostras[k / 2 - 1] + amostras[k / 2]) / 2;
+    r.p95_ns = amostras[static_cast<size_t>(std::ceil(0.95 * k)) - 1];
+    r.min_ns = amostras[0];
+    r.gflops = flops / r.mediana_ns; // operações por ns = GFLOP/s
+    r.gbs = bytes / r.mediana_ns;
+    return r;
+}
+
+/*!
+ * @brief Grava os resultados em JSON, um objeto por linha dentro de "resultados".
+ */
+inline void escrever_json(const std::string &caminho, const std::vector<Resultado> &resultados,
+                          const std::string &descricao)
+{
+    std::ofstream saida(caminho);
+    if (!saida)
+        throw std::runtime_error("Não foi possível abrir " + caminho);
+
+    saida << "{\n  \"descricao\": \"" << descricao << "\",\n  \"resultados\": [\n";
+    char linha[512];
+    for (size_t i = 0; i < resultados.size(); i++) {
+        const Resultado &r = resultados[i];
+        std::snprintf(linha, sizeof(linha),
+                      "    {\"nome\": \"%s\", \"n\": %zu, \"amostras\": %d, \"lote\": %ld, "
+                      "\"mediana_ns\": %.6g, \"p95_ns\": %.6g, \"min_ns\": %.6g, "
+                      "\"gflops\": %.6g, \"gbs\": %.6g}%s\n",
+                      r.nome.c_str(), r.n, r.amostras, r.lote, r.mediana_ns, r.p95_ns, r.min_ns,
+                      r.gflops, r.gbs, i + 1 < resultados.size() ? "," : "");
+        saida << linha;
+    }
+    saida << "  ]\n}\n";
+}
+
+/*!
+ * @brief Grava os resultados em CSV, com cabeçalho.
+ */
+inline void escrever_csv(const std::string &caminho, const std::vector<Resultado> &resultados)
+{
+    std::ofstream saida(caminho);
+    if (!saida)
+        throw std::runtime_error("Não foi possível abrir " + caminho);
+
+    saida << "nome,n,amostras,lote,mediana_ns,p95_ns,min_ns,gflops,gbs\n";
+    char linha[512];
+    for (const Resultado &r : resultados) {
+        std::snprintf(linha, sizeof(linha), "%s,%zu,%d,%ld,%.6g,%.6g,%.6g,%.6g,%.6g\n",
+                      r.nome.c_str(), r.n, r.amostras, r.lote, r.mediana_ns, r.p95_ns, r.min_ns,
+                      r.gflops, r.gbs);
+        saida << linha;
+    }
+}
+
+namespace detail
+{
+inline std::string campo_json(const std::string &linha, const std::string &chave)
+{
+    const std::string marca = "\"" + chave + "\":";
+    size_t pos = linha.find(marca);
+    if (pos == std::string::npos)
+        return {};
+    pos = linha.find_first_not_of(" \"", pos + marca.size());
+    const size_t fim = linha.find_first_of("\",}", pos);
+    return linha.substr(pos, fim - pos);
+}
+} // namespace detail
+
+/*!
+ * @brief Lê um arquivo gravado por escrever_json ou escrever_csv (escolhido pela extensão).
+ */
+inline std::vector<Resultado> ler(const std::string &caminho)
+{
+    std::ifstream entrada(caminho);
+    if (!entrada)
+        throw std::runtime_error("Não foi possível abrir " + caminho);
+
+    const bool csv = caminho.size() >= 4 && caminho.compare(caminho.size() - 4, 4, ".csv") == 0;
+    std::vector<Resultado> resultados;
+    std::string linha;
+    if (csv)
+        std::getline(entrada, linha); // cabeçalho
+
+    while (std::getline(entrada, linha)) {
+        Resultado r;
+        if (csv) {
+            std::vector<std::string> campos;
+            std::stringstream fluxo(linha);
+            for (std::string campo; std::getline(fluxo, campo, ',');)
+                campos.push_back(campo);
+            if (campos.size() < 9)
+                continue;
+            r.nome = campos[0];
+            r.n = std::stoul(campos[1]);
+            r.amostras = std::stoi(campos[2]);
+            r.lote = std::stol(campos[3]);
+            r.mediana_ns = std::stod(campos[4]);
+            r.p95_ns = std::stod(campos[5]);
+            r.min_ns = std::stod(campos[6]);
+            r.gflops = std::stod(campos[7]);
+            r.gbs = std::stod(campos[8]);
+        } else {
+            if (linha.find("\"nome\"") == std::string::npos)
+                continue;
+            r.nome = detail::campo_json(linha, "nome");
+            r.n = std::stoul(detail::campo_json(linha, "n"));
+            r.amostras = std::stoi(detail::campo_json(linha, "amostras"));
+            r.lote = std::stol(detail::campo_json(linha, "lote"));
+            r.mediana_ns = std::stod(detail::campo_json(linha, "mediana_ns"));
+            r.p95_ns = std::stod(detail::campo_json(linha, "p95_ns"));
+            r.min_ns = std::stod(detail::campo_json(linha, "min_ns"));
+            r.gflops = std::stod(detail::campo_json(linha, "gflops"));
+            r.gbs = std::stod(detail::campo_json(linha, "gbs"));
+        }
+        resultados.push_back(r);
+    }
+    return resultados;
+}
+
+} // namespace bench
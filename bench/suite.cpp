@@ -0,0 +1,203 @@
+/*!
+ * @file suite.cpp
+ * @brief Suíte de benchmarks da biblioteca (alvo `make bench`).
+ *
+ * Varre tamanhos de 4 a 4096 (potências de 2) para operações representativas e grava os
+ * resultados em JSON e CSV, que podem ser comparados entre versões com `comparar`.
+ * Quando a estimativa de uma chamada no próximo tamanho passa de `--limite` segundos, os
+ * tamanhos restantes daquele caso são pulados.
+ *
+ * Opções:
+ *   --json ARQ        grava os resultados em JSON
+ *   --csv ARQ         grava os resultados em CSV
+ *   --min N, --max N  faixa de tamanhos (padrão: 4 e 4096; N >= 1)
+ *   --filtro TEXTO    só executa casos cujo nome contém TEXTO
+ *   --repeticoes K    amostras por caso (padrão: 15; K >= 1)
+ *   --orcamento S     tempo de amostragem por caso, em segundos (padrão: 1)
+ *   --limite S        tempo máximo estimado de uma chamada (padrão: 20)
+ */
+
+#include "AlgebraLinear.hpp"
+#include "Auxiliar.hpp"
+#include "Cordic.hpp"
+#include "Matriz.hpp"
+#include "Paralelo.hpp"
+#include "medicao.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ifnum;
+
+namespace
+{
+volatile double sumidouro = 0; // impede que o compilador descarte os resultados
+
+/*!
+ * @brief Um caso da suíte: custo por tamanho e preparação do código medido.
+ */
+struct Caso {
+    const char *nome;
+    int ordem;                            //!< Expoente do custo em n (1, 2 ou 3).
+    std::function<double(double)> flops;  //!< Operações por chamada.
+    std::function<double(double)> bytes;  //!< Tráfego mínimo de memória por chamada.
+    std::function<std::function<void()>(size_t)> preparar; //!< Monta os dados de tamanho n.
+};
+
+Matriz<double> matriz_dominante(size_t linhas, size_t colunas)
+{
+    static std::mt19937 gerador(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    Matriz<double> m(linhas, colunas);
+    for (size_t i = 0; i < linhas; i++) {
+        for (size_t j = 0; j < colunas; j++)
+            m.elemento(i, j) = dist(gerador);
+        if (i < colunas)
+            m.elemento(i, i) += static_cast<double>(linhas);
+    }
+    return m;
+}
+
+std::vector<Caso> casos()
+{
+    return {
+        {"operator*", 3, [](double n) { return 2 * n * n * n; },
+         [](double n) { return 3 * 8 * n * n; },
+         [](size_t n) -> std::function<void()> {
+             Matriz<double> A = matriz_dominante(n, n), B = matriz_dominante(n, n);
+             return [A, B] {
+                 Matriz<double> C = A * B;
+                 sumidouro = C(0, 0);
+             };
+         }},
+        {"decomposicaoLU", 3, [](double n) { return 2 * n * n * n / 3; },
+         [](double n) { return 4 * 8 * n * n; },
+         [](size_t n) -> std::function<void()> {
+             Matriz<double> A = matriz_dominante(n, n);
+             return [A] { sumidouro = std::get<1>(decomposicaoLU(A))(0, 0); };
+         }},
+        {"gauss_jordan", 3, [](double n) { return n * n * n; },
+         [](double n) { return 2 * 8 * (n * n + n); },
+         [](size_t n) -> std::function<void()> {
+             // Inclui a cópia da entrada (O(n²)), já que a eliminação a sobrescreve
+             Matriz<double> A0 = matriz_dominante(n, n), b0 = matriz_dominante(n, 1);
+             Matriz<double> A = A0, b = b0;
+             return [A0, b0, A, b]() mutable {
+                 A = A0;
+                 b = b0;
+                 gauss_jordan(A.visao(), b.visao());
+                 sumidouro = b(0, 0);
+             };
+         }},
+        {"cordic::sin", 1, [](double) { return 0.0; }, [](double n) { return 2 * 8 * n; },
+         [](size_t n) -> std::function<void()> {
+             std::vector<double> angulos(n), saida(n);
+             for (size_t i = 0; i < n; i++)
+                 angulos[i] = -180.0 + 360.0 * static_cast<double>(i) / static_cast<double>(n);
+             return [angulos, saida]() mutable {
+                 for (size_t i = 0; i < angulos.size(); i++)
+                     saida[i] = cordic::sin(angulos[i]);
+                 sumidouro = saida[0];
+             };
+         }},
+        {"rng::matriz_aleatoria", 2, [](double) { return 0.0; },
+         [](double n) { return 8 * n * n; },
+         [](size_t n) -> std::function<void()> {
+             return [n] { sumidouro = rng::matriz_aleatoria<double>(n, n, -1.0, 1.0)(0, 0); };
+         }},
+    };
+}
+
+const char *valor(int &i, int argc, char **argv)
+{
+    if (i + 1 >= argc) {
+        std::fprintf(stderr, "Faltou o valor de %s\n", argv[i]);
+        std::exit(2);
+    }
+    return argv[++i];
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::string json, csv, filtro;
+    size_t minimo = 4, maximo = 4096;
+    double limite_s = 20;
+    bench::Opcoes opcoes;
+
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--json"))
+            json = valor(i, argc, argv);
+        else if (!std::strcmp(argv[i], "--csv"))
+            csv = valor(i, argc, argv);
+        else if (!std::strcmp(argv[i], "--min"))
+            minimo = std::stoul(valor(i, argc, argv));
+        else if (!std::strcmp(argv[i], "--max"))
+            maximo = std::stoul(valor(i, argc, argv));
+        else if (!std::strcmp(argv[i], "--filtro"))
+            filtro = valor(i, argc, argv);
+        else if (!std::strcmp(argv[i], "--repeticoes"))
+            opcoes.repeticoes = std::stoi(valor(i, argc, argv));
+        else if (!std::strcmp(argv[i], "--orcamento"))
+            opcoes.orcamento_s = std::stod(valor(i, argc, argv));
+        else if (!std::strcmp(argv[i], "--limite"))
+            limite_s = std::stod(valor(i, argc, argv));
+        else {
+            std::fprintf(stderr, "Opção desconhecida: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    // Com 0, os tamanhos (n *= 2) nunca avançariam e medir() ficaria sem amostras.
+    if (minimo < 1 || opcoes.repeticoes < 1) {
+        std::fprintf(stderr, "--min e --repeticoes devem ser pelo menos 1.\n");
+        return 2;
+    }
+
+    char descricao[256];
+    std::snprintf(descricao, sizeof(descricao), "g++ %s, %zu threads, IFNUM_CHECKED=%d",
+                  __VERSION__, paralelo::threads(), IFNUM_CHECKED);
+    std::printf("%s\n\n%-22s %6s %14s %14s %10s %10s\n", descricao, "caso", "n", "mediana (ns)",
+                "p95 (ns)", "GFLOP/s", "GB/s");
+
+    std::vector<bench::Resultado> resultados;
+    for (const Caso &caso : casos()) {
+        if (!filtro.empty() && std::string(caso.nome).find(filtro) == std::string::npos)
+            continue;
+
+        double anterior_ns = 0;
+        size_t anterior_n = 0;
+        for (size_t n = minimo; n <= maximo; n *= 2) {
+            if (anterior_n) {
+                const double estimativa =
+                    anterior_ns * std::pow(double(n) / double(anterior_n), caso.ordem);
+                if (estimativa > limite_s * 1e9) {
+                    std::printf("%-22s %6zu  pulado (estimativa de %.0f s por chamada)\n",
+                                caso.nome, n, estimativa / 1e9);
+                    break;
+                }
+            }
+
+            const std::function<void()> f = caso.preparar(n);
+            const double x = static_cast<double>(n);
+            const bench::Resultado r =
+                bench::medir(caso.nome, n, caso.flops(x), caso.bytes(x), f, opcoes);
+            std::printf("%-22s %6zu %14.0f %14.0f %10.3f %10.3f\n", r.nome.c_str(), r.n,
+                        r.mediana_ns, r.p95_ns, r.gflops, r.gbs);
+            std::fflush(stdout);
+            resultados.push_back(r);
+            anterior_ns = r.mediana_ns;
+            anterior_n = n;
+        }
+    }
+
+    if (!json.empty())
+        bench::escrever_json(json, resultados, descricao);
+    if (!csv.empty())
+        bench::escrever_csv(csv, resultados);
+    return 0;
+}
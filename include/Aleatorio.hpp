@@ -0,0 +1,127 @@
+/*!
+ * @file Aleatorio.hpp
+ * @brief Gerador aleatório baseado em contador (Philox4x32-10) e preenchimento paralelo de
+ *        matrizes com distribuições uniforme, normal, exponencial e de Bernoulli.
+ *
+ * No Philox, o n-ésimo bloco de 128 bits é uma função pura de (semente, fluxo, n): não há
+ * estado a atualizar em sequência. Por isso, cada elemento de uma matriz pode ser calculado
+ * a partir do seu índice, em qualquer thread e em qualquer ordem, e o resultado para uma
+ * semente é o mesmo com qualquer número de threads. Fluxos diferentes (a mesma semente com
+ * outro `fluxo`) são sequências independentes, sem sobreposição.
+ *
+ * O cálculo dos blocos processa 8 contadores por vez e tem uma variante AVX2 escolhida em
+ * tempo de execução, como os kernels de Gemm.cpp.
+ *
+ * @code
+ * ifnum::rng::Philox g(42);
+ * ifnum::Matriz<double> A = ifnum::rng::matriz_aleatoria(1000, 1000, -1.0, 1.0, g);
+ * ifnum::rng::preencher(A.visao(), ifnum::rng::Normal<double>{0.0, 2.0}, g);
+ * @endcode
+ */
+
+#pragma once
+#include "Matriz.hpp"
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace ifnum::rng
+{
+/*!
+ * @brief Gerador Philox4x32-10 (Salmon et al., 2011), com semente de 64 bits e 2^64 fluxos
+ *        independentes de 2^64 blocos cada.
+ *
+ * Satisfaz UniformRandomBitGenerator, então também pode ser usado com as distribuições da
+ * biblioteca padrão. Ocupa 40 bytes e é barato de copiar; cada thread deve usar o próprio
+ * gerador (ou `rng::local()`).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+class Philox
+{
+  public:
+    using result_type = uint32_t;
+    using Bloco = std::array<uint32_t, 4>;
+
+  private:
+    uint64_t semente_;
+    uint64_t fluxo_;
+    uint64_t contador_ = 0; // próximo bloco a gerar
+    Bloco bloco_{};
+    unsigned usados_ = 4; // palavras de bloco_ já entregues
+
+  public:
+    explicit Philox(uint64_t semente, uint64_t fluxo = 0);
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+    static constexpr result_type max()
+    {
+        return UINT32_MAX;
+    }
+
+    result_type operator()();
+    void avancar(uint64_t blocos);
+    uint64_t reservar(uint64_t blocos);
+
+    uint64_t semente() const;
+    uint64_t fluxo() const;
+    uint64_t contador() const;
+
+    static Bloco bloco(uint64_t semente, uint64_t fluxo, uint64_t contador);
+};
+
+/*! @brief Distribuição uniforme em [min, max) (ponto flutuante) ou [min, max] (inteiros). */
+template <typename T>
+struct Uniforme {
+    T min;
+    T max;
+};
+
+/*! @brief Distribuição normal (Box-Muller). */
+template <typename T>
+struct Normal {
+    T media = 0;
+    T desvio = 1;
+};
+
+/*! @brief Distribuição exponencial com a taxa dada (média 1 / taxa). */
+template <typename T>
+struct Exponencial {
+    T taxa = 1;
+};
+
+/*! @brief 1 com probabilidade `p`, 0 caso contrário. */
+struct Bernoulli {
+    double p = 0.5;
+};
+
+void semear(uint64_t semente);
+uint64_t semente();
+Philox &local();
+
+template <typename T, typename D>
+void preencher(const MatrizView<T> &m, const D &distribuicao, Philox &gerador);
+
+template <typename T>
+ifnum::Matriz<T> matriz_aleatoria(size_t linhas, size_t colunas, T min, T max,
+                                  Philox &gerador);
+template <typename T>
+ifnum::Matriz<T> matriz_normal(size_t linhas, size_t colunas, T media, T desvio,
+                               Philox &gerador);
+template <typename T>
+ifnum::Matriz<T> matriz_normal(size_t linhas, size_t colunas, T media = 0, T desvio = 1);
+
+} // namespace ifnum::rng
+
+namespace ifnum::detail
+{
+void philox_blocos(uint64_t semente, uint64_t fluxo, uint64_t contador, size_t n,
+                   uint32_t *saida);
+uint64_t proximo_fluxo();
+} // namespace ifnum::detail
+
+#include "Aleatorio.tpp"
@@ -0,0 +1,250 @@
+/*!
+ * @file Aleatorio.tpp
+ * @brief Conversão dos blocos do Philox em amostras e preenchimento paralelo de matrizes.
+ */
+
+#ifdef __INTELLISENSE__
+#include "Aleatorio.hpp"
+#endif
+
+namespace ifnum::detail
+{
+inline constexpr double dois_pi = 6.28318530717958647692528676655900577;
+
+/*!
+ * @brief Amostras geradas por bloco de 128 bits: 4 de 32 bits para float e Bernoulli, 2 de
+ *        64 bits para double e inteiros.
+ */
+template <typename T, typename D>
+constexpr size_t amostras_por_bloco()
+{
+    if constexpr (std::is_same_v<D, rng::Bernoulli>)
+        return 4;
+    else if constexpr (std::is_floating_point_v<T> && sizeof(T) == 4)
+        return 4;
+    else
+        return 2;
+}
+
+/*! @brief Palavra de 64 bits formada pelas palavras 2i e 2i+1 dos blocos. */
+inline uint64_t palavra64(const uint32_t *bits, size_t i)
+{
+    return uint64_t(bits[2 * i]) | uint64_t(bits[2 * i + 1]) << 32;
+}
+
+/*! @brief Parte alta (64 bits) do produto de dois inteiros de 64 bits. */
+inline uint64_t mulhi64(uint64_t a, uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+    return static_cast<uint64_t>(static_cast<unsigned __int128>(a) * b >> 64);
+#else
+    const uint64_t a0 = a & 0xffffffff, a1 = a >> 32, b0 = b & 0xffffffff, b1 = b >> 32;
+    const uint64_t meio = a1 * b0 + (a0 * b0 >> 32);
+    return a1 * b1 + (meio >> 32) + ((a0 * b1 + (meio & 0xffffffff)) >> 32);
+#endif
+}
+
+/*! @brief Uniforme em [0, 1), com 53 bits de precisão. */
+inline double unitario(uint64_t u)
+{
+    return static_cast<double>(u >> 11) * 0x1p-53;
+}
+
+/*! @brief Uniforme em (0, 1], para logaritmos. */
+inline double unitario_aberto(uint64_t u)
+{
+    return static_cast<double>((u >> 11) + 1) * 0x1p-53;
+}
+
+/*!
+ * @brief A k-ésima palavra (de 32 bits se P = 4, de 64 se P = 2) como uniforme em [0, 1) e
+ *        em (0, 1].
+ */
+template <size_t P>
+inline void uniformes(const uint32_t *bits, size_t k, double &u, double &u_aberto)
+{
+    if constexpr (P == 4) {
+        u = bits[k] * 0x1p-32;
+        u_aberto = (double(bits[k]) + 1) * 0x1p-32;
+    } else {
+        const uint64_t w = palavra64(bits, k);
+        u = unitario(w);
+        u_aberto = unitario_aberto(w);
+    }
+}
+
+template <typename T>
+void amostras(const rng::Uniforme<T> &d, const uint32_t *bits, size_t n, T *saida)
+{
+    if constexpr (std::is_integral_v<T>) {
+        using W = std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>;
+        const uint64_t base = static_cast<uint64_t>(static_cast<W>(d.min));
+        const uint64_t largura = static_cast<uint64_t>(static_cast<W>(d.max)) - base + 1;
+        for (size_t k = 0; k < n; k++) {
+            const uint64_t w = palavra64(bits, k);
+            saida[k] = static_cast<T>(base + (largura ? mulhi64(w, largura) : w));
+        }
+    } else if constexpr (sizeof(T) == 4) {
+        const T largura = d.max - d.min;
+        for (size_t k = 0; k < n; k++)
+            saida[k] = d.min + largura * (static_cast<T>(bits[k] >> 8) * T(0x1p-24));
+    } else {
+        const T largura = d.max - d.min;
+        for (size_t k = 0; k < n; k++)
+            saida[k] = d.min + largura * static_cast<T>(unitario(palavra64(bits, k)));
+    }
+}
+
+template <typename T>
+void amostras(const rng::Normal<T> &d, const uint32_t *bits, size_t n, T *saida)
+{
+    constexpr size_t P = amostras_por_bloco<T, rng::Normal<T>>();
+    for (size_t k = 0; k < n; k += 2) {
+        double u1, u1_aberto, u2, u2_aberto;
+        uniformes<P>(bits, k, u1, u1_aberto);
+        uniformes<P>(bits, k + 1, u2, u2_aberto);
+        const double r = std::sqrt(-2.0 * std::log(u1_aberto));
+        const double teta = dois_pi * u2;
+        saida[k] = d.media + d.desvio * static_cast<T>(r * std::cos(teta));
+        saida[k + 1] = d.media + d.desvio * static_cast<T>(r * std::sin(teta));
+    }
+}
+
+template <typename T>
+void amostras(const rng::Exponencial<T> &d, const uint32_t *bits, size_t n, T *saida)
+{
+    constexpr size_t P = amostras_por_bloco<T, rng::Exponencial<T>>();
+    const double escala = -1.0 / static_cast<double>(d.taxa);
+    for (size_t k = 0; k < n; k++) {
+        double u, u_aberto;
+        uniformes<P>(bits, k, u, u_aberto);
+        saida[k] = static_cast<T>(escala * std::log(u_aberto));
+    }
+}
+
+template <typename T>
+void amostras(const rng::Bernoulli &d, const uint32_t *bits, size_t n, T *saida)
+{
+    const double p = d.p < 0 ? 0 : (d.p > 1 ? 1 : d.p);
+    const uint64_t limiar = static_cast<uint64_t>(p * 0x1p32);
+    for (size_t k = 0; k < n; k++)
+        saida[k] = static_cast<T>(bits[k] < limiar);
+}
+} // namespace ifnum::detail
+
+namespace ifnum::rng
+{
+/*!
+ * @brief Preenche uma visão com amostras independentes de uma distribuição.
+ *
+ * O elemento (i, j) usa o bloco `gerador.contador() + (i * colunas + j) / P` (P = 2 ou 4
+ * amostras por bloco), então o resultado depende só do gerador e das dimensões, não do
+ * número de threads nem dos passos da visão. O gerador avança o número de blocos usados.
+ * Os valores são calculados em grupos de 64 blocos, em um buffer na pilha, e copiados
+ * direto para a visão.
+ *
+ * @tparam T Tipo dos elementos.
+ * @tparam D Uniforme<T>, Normal<T>, Exponencial<T> ou Bernoulli.
+ * @param m Visão a preencher.
+ * @param distribuicao Parâmetros da distribuição.
+ * @param gerador Gerador; avança ao fim do preenchimento.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename D>
+void preencher(const MatrizView<T> &m, const D &distribuicao, Philox &gerador)
+{
+    static_assert(std::is_arithmetic_v<T>, "T deve ser um tipo numérico.");
+    if constexpr (!std::is_same_v<D, Bernoulli> && !std::is_same_v<D, Uniforme<T>>)
+        static_assert(std::is_floating_point_v<T>, "Distribuição só para ponto flutuante.");
+    IFNUM_MEDIR("rng::preencher");
+
+    constexpr size_t P = detail::amostras_por_bloco<T, D>();
+    constexpr size_t G = 64; // blocos por grupo
+    const size_t n = m.linhas() * m.colunas();
+    if (n == 0)
+        return;
+
+    const size_t blocos = (n + P - 1) / P;
+    const uint64_t base = gerador.reservar(blocos);
+    const uint64_t semente = gerador.semente();
+    const uint64_t fluxo = gerador.fluxo();
+    const size_t colunas = m.colunas();
+
+    paralelo::para(0, (blocos + G - 1) / G, G * 64, [&](size_t ini, size_t fim) {
+        alignas(64) uint32_t bits[4 * G];
+        alignas(64) T valores[P * G];
+        for (size_t grupo = ini; grupo < fim; grupo++) {
+            const size_t b0 = grupo * G;
+            const size_t nb = std::min(G, blocos - b0);
+            detail::philox_blocos(semente, fluxo, base + b0, nb, bits);
+            detail::amostras(distribuicao, bits, P * nb, valores);
+
+            size_t e = b0 * P;
+            const size_t e_fim = std::min(n, (b0 + nb) * P);
+            const T *v = valores;
+            while (e < e_fim) {
+                const size_t i = e / colunas, j = e % colunas;
+                const size_t q = std::min(colunas - j, e_fim - e);
+                T *destino = m.data() + i * m.passo_linha() + j * m.passo_coluna();
+                if (m.passo_coluna() == 1) {
+                    std::copy(v, v + q, destino);
+                } else {
+                    for (size_t k = 0; k < q; k++)
+                        destino[k * m.passo_coluna()] = v[k];
+                }
+                v += q;
+                e += q;
+            }
+        }
+    });
+    IFNUM_BYTES(n * sizeof(T));
+}
+
+/*!
+ * @brief Matriz com valores uniformes em [min, max) (ou [min, max] para inteiros).
+ *
+ * @param gerador Gerador usado; avança os blocos consumidos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+ifnum::Matriz<T> matriz_aleatoria(size_t linhas, size_t colunas, T min, T max,
+                                  Philox &gerador)
+{
+    Matriz<T> m(linhas, colunas);
+    preencher(m.visao(), Uniforme<T>{min, max}, gerador);
+    return m;
+}
+
+/*!
+ * @brief Matriz com valores da distribuição normal N(media, desvio²).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+ifnum::Matriz<T> matriz_normal(size_t linhas, size_t colunas, T media, T desvio,
+                               Philox &gerador)
+{
+    Matriz<T> m(linhas, colunas);
+    preencher(m.visao(), Normal<T>{media, desvio}, gerador);
+    return m;
+}
+
+/*!
+ * @brief Matriz normal a partir da semente global, com um fluxo novo a cada chamada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+ifnum::Matriz<T> matriz_normal(size_t linhas, size_t colunas, T media, T desvio)
+{
+    Philox gerador(semente(), detail::proximo_fluxo());
+    return matriz_normal(linhas, colunas, media, desvio, gerador);
+}
+
+} // namespace ifnum::rng
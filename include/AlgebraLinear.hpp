@@ -7,7 +7,10 @@
  */
 
 #pragma once
+#include "Cholesky.hpp"
+#include "LU.hpp"
 #include "Matriz.hpp"
+#include "QR.hpp"
 #include <tuple>
 
 namespace ifnum
@@ -15,27 +18,47 @@ namespace ifnum
 
 template <typename T>
 Matriz<T> sub(Matriz<T> &matriz, Matriz<T> &b);
+template <typename T>
+Matriz<T> sub(const ConstMatrizView<T> &matriz, const ConstMatrizView<T> &b);
 
 template <typename T>
 Matriz<T> reversub(const Matriz<T> &matriz, const Matriz<T> &b);
+template <typename T>
+Matriz<T> reversub(const ConstMatrizView<T> &matriz, const ConstMatrizView<T> &b);
 
 template <typename T>
-bool verificar_matriz_quadrada(Matriz<T> matriz);
+bool verificar_matriz_quadrada(const Matriz<T> &matriz);
+template <typename T>
+bool verificar_matriz_quadrada(const ConstMatrizView<T> &matriz);
 
 template <typename T>
 Matriz<T> gauss(Matriz<T> &matriz, Matriz<T> &b);
+template <typename T>
+void gauss(const MatrizView<T> &matriz, const MatrizView<T> &b);
 
 template <typename T>
 Matriz<T> gauss_jordan(Matriz<T> &matriz, Matriz<T> &b);
+template <typename T>
+void gauss_jordan(const MatrizView<T> &matriz, const MatrizView<T> &b);
 
 template <typename T>
 Matriz<T> retorna_U(Matriz<T> &matriz);
+template <typename T>
+void retorna_U(const MatrizView<T> &matriz);
 
 template <typename T>
 Matriz<T> retorna_L(Matriz<T> &matriz);
+template <typename T>
+Matriz<T> retorna_L(const MatrizView<T> &matriz);
 
 std::tuple<Matriz<double>, Matriz<double>, Matriz<double>> decomposicaoLU(const Matriz<double> &A);
+std::tuple<MatrizArena<double>, MatrizArena<double>, MatrizArena<double>>
+decomposicaoLU(const ConstMatrizView<double> &A, Arena &area);
 Matriz<double> resolverLU(const Matriz<double> &A, const Matriz<double> &b);
+MatrizArena<double> resolverLU(const ConstMatrizView<double> &A, const ConstMatrizView<double> &b,
+                               Arena &area);
+Matriz<double> resolverCholesky(const Matriz<double> &A, const Matriz<double> &b);
+Matriz<double> minimos_quadrados(const Matriz<double> &A, const Matriz<double> &b);
 
 } // namespace ifnum
 
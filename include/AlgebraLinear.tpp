@@ -11,13 +11,48 @@
 
 namespace ifnum
 {
+namespace detail
+{
+/*!
+ * @brief Faz `destino[j * passo] -= fator * origem[j * passo]` para j em [0, n).
+ *
+ * Laço interno das eliminações (uma linha menos um múltiplo de outra). Não verifica
+ * limites e trata o caso contíguo separadamente, para que possa ser vetorizado. O caso
+ * contíguo anda em blocos de 8 elementos: com -O2, o GCC só vetoriza laços cujo número de
+ * iterações é múltiplo conhecido da largura do vetor. O bloco é desenrolado por inteiro;
+ * deixado como um laço de 4 iterações, o tempo variava até 40% conforme o endereço em que o
+ * ligador o colocava.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void subtrair_multiplo(T *__restrict destino, const T *__restrict origem, size_t n,
+                       size_t passo, T fator) noexcept
+{
+    if (passo == 1) {
+        constexpr size_t BLOCO = 8;
+        size_t j = 0;
+        for (; j + BLOCO <= n; j += BLOCO)
+#pragma GCC unroll 8
+            for (size_t l = 0; l < BLOCO; ++l)
+                destino[j + l] -= origem[j + l] * fator;
+        for (; j < n; ++j)
+            destino[j] -= origem[j] * fator;
+    } else {
+        for (size_t j = 0; j < n; ++j)
+            destino[j * passo] -= origem[j * passo] * fator;
+    }
+}
+} // namespace detail
+
 /*!
  * @brief Resolve um sistema triangular superior via substituição reversa.
  *
  * Recebe uma matriz com a parte inferior zerada e um vetor, e retorna o vetor solução.
  *
- * @param matriz Matriz triangular superior.
- * @param b Vetor de constantes.
+ * @param matriz Matriz (ou visão) triangular superior.
+ * @param b Vetor (ou coluna de uma matriz) de constantes.
  * @return Vetor solução do sistema.
  *
  * @author Lucas Andrei
@@ -25,29 +60,41 @@ namespace ifnum
  * @date 20/03/2025
  */
 template <typename T>
-Matriz<T> sub(Matriz<T> &matriz, Matriz<T> &b)
+Matriz<T> sub(const ConstMatrizView<T> &matriz, const ConstMatrizView<T> &b)
 {
-    int n = static_cast<int>(matriz.linhas());
+    const size_t n = matriz.linhas();
     Matriz<T> x(n, 1);
 
-    for (int i = n - 1; i >= 0; i--) {
+    for (size_t i = n; i-- > 0;) {
         T soma = 0;
-        for (int j = i + 1; j < n; j++) {
-            soma += matriz(i, j) * x(j, 0);
+        for (size_t j = i + 1; j < n; j++) {
+            soma += matriz.elemento(i, j) * x.elemento(j, 0);
         }
-        x(i, 0) = (b(i, 0) - soma) / matriz(i, i);
+        x.elemento(i, 0) = (b.elemento(i, 0) - soma) / matriz.elemento(i, i);
     }
 
     return x;
 }
 
+/*!
+ * @brief Substituição reversa sobre matrizes; repassa visões sem cópia para a versão acima.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> sub(Matriz<T> &matriz, Matriz<T> &b)
+{
+    return sub(matriz.visao(), b.visao());
+}
+
 /*!
  * @brief Resolve um sistema triangular inferior via substituição direta.
  *
  * Recebe uma matriz com a parte superior zerada e um vetor, e retorna o vetor solução.
  *
- * @param matriz Matriz triangular inferior.
- * @param b Vetor de constantes.
+ * @param matriz Matriz (ou visão) triangular inferior.
+ * @param b Vetor (ou coluna de uma matriz) de constantes.
  * @return Vetor solução do sistema.
  *
  * @author Lucas Andrei
@@ -55,22 +102,34 @@ Matriz<T> sub(Matriz<T> &matriz, Matriz<T> &b)
  * @date 20/03/2025
  */
 template <typename T>
-Matriz<T> reversub(const Matriz<T> &matriz, const Matriz<T> &b)
+Matriz<T> reversub(const ConstMatrizView<T> &matriz, const ConstMatrizView<T> &b)
 {
-    int n = static_cast<int>(matriz.linhas());
+    const size_t n = matriz.linhas();
     Matriz<T> x(n, 1);
 
-    for (int i = 0; i < n; i++) {
+    for (size_t i = 0; i < n; i++) {
         T soma = 0;
-        for (int j = 0; j < i; j++) {
-            soma += matriz(i, j) * x(j, 0);
+        for (size_t j = 0; j < i; j++) {
+            soma += matriz.elemento(i, j) * x.elemento(j, 0);
         }
-        x(i, 0) = (b(i, 0) - soma) / matriz(i, i);
+        x.elemento(i, 0) = (b.elemento(i, 0) - soma) / matriz.elemento(i, i);
     }
 
     return x;
 }
 
+/*!
+ * @brief Substituição direta sobre matrizes; repassa visões sem cópia para a versão acima.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> reversub(const Matriz<T> &matriz, const Matriz<T> &b)
+{
+    return reversub(matriz.visao(), b.visao());
+}
+
 /*!
  * @brief Verifica se uma matriz é quadrada.
  *
@@ -84,22 +143,35 @@ Matriz<T> reversub(const Matriz<T> &matriz, const Matriz<T> &b)
  * @date 20/03/2025
  */
 template <typename T>
-bool verificar_matriz_quadrada(Matriz<T> matriz)
+bool verificar_matriz_quadrada(const Matriz<T> &matriz)
 {
     if (matriz.colunas() != matriz.linhas())
         return false;
     return true;
 }
 
+/*!
+ * @brief Verifica se uma visão é quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+bool verificar_matriz_quadrada(const ConstMatrizView<T> &matriz)
+{
+    return matriz.colunas() == matriz.linhas();
+}
+
 /*!
  * @brief Aplica o método de eliminação de Gauss para escalonar uma matriz.
  *
  * Realiza a triangularização superior de uma matriz de coeficientes e modifica o vetor de constantes correspondente.
  * Não realiza substituição para encontrar a solução — apenas escalona o sistema.
  *
+ * Trabalha diretamente sobre visões, então pode escalonar um bloco de uma matriz maior.
+ *
  * @param matriz Matriz dos coeficientes (modificada no processo).
  * @param b Vetor de constantes do sistema (modificado no processo).
- * @return Matriz escalonada.
  *
  * @throws std::invalid_argument Se a matriz não for quadrada.
  *
@@ -108,25 +180,44 @@ bool verificar_matriz_quadrada(Matriz<T> matriz)
  * @date 20/03/2025
  */
 template <typename T>
-Matriz<T> gauss(Matriz<T> &matriz, Matriz<T> &b)
+void gauss(const MatrizView<T> &matriz, const MatrizView<T> &b)
 {
-    if (!verificar_matriz_quadrada(matriz)) {
+    if (!verificar_matriz_quadrada<T>(matriz)) {
         throw std::invalid_argument("Matriz não é quadrada.");
     };
-    int n = static_cast<int>(matriz.linhas());
+    const size_t n = matriz.linhas();
+    IFNUM_MEDIR("gauss");
+    IFNUM_FLOPS(2 * n * n * n / 3);
+    IFNUM_BYTES(sizeof(T) * (2 * n * n + 2 * n));
 
-    for (int i = 0; i < n - 1; ++i) {
-        for (int k = i + 1; k < n; ++k) {
-            T fator = matriz(k, i) / matriz(i, i);
+    for (size_t i = 0; i + 1 < n; ++i) {
+        // As linhas abaixo do pivô são atualizadas de forma independente.
+        paralelo::para(i + 1, n, n - i, [&](size_t inicio, size_t fim) {
+            for (size_t k = inicio; k < fim; ++k) {
+                T fator = matriz.elemento(k, i) / matriz.elemento(i, i);
 
-            for (int j = i; j < n; ++j) {
-                matriz(k, j) -= matriz(i, j) * fator;
-            }
+                detail::subtrair_multiplo(&matriz.elemento(k, i), &matriz.elemento(i, i), n - i,
+                                          matriz.passo_coluna(), fator);
 
-            b(k, 0) -= b(i, 0) * fator;
-        }
+                b.elemento(k, 0) -= b.elemento(i, 0) * fator;
+            }
+        });
     }
+}
 
+/*!
+ * @brief Eliminação de Gauss sobre matrizes, escalonando no próprio buffer.
+ *
+ * @return Cópia da matriz escalonada.
+ * @throws std::invalid_argument Se a matriz não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> gauss(Matriz<T> &matriz, Matriz<T> &b)
+{
+    gauss(matriz.visao(), b.visao());
     return matriz;
 }
 
@@ -137,7 +228,6 @@ Matriz<T> gauss(Matriz<T> &matriz, Matriz<T> &b)
  *
  * @param matriz Matriz dos coeficientes (modificada no processo).
  * @param b Vetor de constantes do sistema (modificado no processo e se torna o vetor solução).
- * @return Matriz identidade resultante do processo.
  *
  * @throws std::invalid_argument Se a matriz não for quadrada.
  *
@@ -146,40 +236,58 @@ Matriz<T> gauss(Matriz<T> &matriz, Matriz<T> &b)
  * @date 20/03/2025
  */
 template <typename T>
-Matriz<T> gauss_jordan(Matriz<T> &matriz, Matriz<T> &b)
+void gauss_jordan(const MatrizView<T> &matriz, const MatrizView<T> &b)
 {
-    if (!verificar_matriz_quadrada(matriz)) {
+    if (!verificar_matriz_quadrada<T>(matriz)) {
         throw std::invalid_argument("Matriz não é quadrada.");
     };
-    int n = static_cast<int>(matriz.linhas());
+    const size_t n = matriz.linhas();
+    IFNUM_MEDIR("gauss_jordan");
+    IFNUM_FLOPS(n * n * n + n * n); // só a etapa reversa; a direta conta em "gauss"
+    IFNUM_BYTES(sizeof(T) * (2 * n * n + 2 * n));
 
     // Aplicação do escalonamento direto (Gauss)
     gauss(matriz, b);
 
     // Aplicação do escalonamento reverso (Jordan)
-    for (int i = n - 1; i >= 0; --i) {
-        T divisor = matriz(i, i);
-        for (int j = 0; j < n; ++j) {
-            matriz(i, j) /= divisor;
+    for (size_t i = n; i-- > 0;) {
+        T divisor = matriz.elemento(i, i);
+        for (size_t j = 0; j < n; ++j) {
+            matriz.elemento(i, j) /= divisor;
         }
-        b(i, 0) /= divisor;
+        b.elemento(i, 0) /= divisor;
 
-        for (int k = i - 1; k >= 0; --k) {
-            T fator = matriz(k, i);
-            for (int j = 0; j < n; ++j) {
-                matriz(k, j) -= matriz(i, j) * fator;
+        paralelo::para(0, i, n, [&](size_t inicio, size_t fim) {
+            for (size_t k = inicio; k < fim; ++k) {
+                T fator = matriz.elemento(k, i);
+                detail::subtrair_multiplo(&matriz.elemento(k, 0), &matriz.elemento(i, 0), n,
+                                          matriz.passo_coluna(), fator);
+                b.elemento(k, 0) -= b.elemento(i, 0) * fator;
             }
-            b(k, 0) -= b(i, 0) * fator;
-        }
+        });
     }
+}
 
+/*!
+ * @brief Gauss-Jordan sobre matrizes, no próprio buffer.
+ *
+ * @return Cópia da matriz identidade resultante do processo.
+ * @throws std::invalid_argument Se a matriz não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> gauss_jordan(Matriz<T> &matriz, Matriz<T> &b)
+{
+    gauss_jordan(matriz.visao(), b.visao());
     return matriz;
 }
 
 /*!
  * @brief Calcula a matriz U.
  *
- * Recebe uma matriz quadrada e calcula a matriz U de LU.
+ * Recebe uma matriz quadrada e calcula a matriz U de LU, no lugar.
  *
  * @param matriz Matriz quadrada
  *
@@ -188,24 +296,36 @@ Matriz<T> gauss_jordan(Matriz<T> &matriz, Matriz<T> &b)
  * @date 27/03/2025
 */
 template <typename T>
-Matriz<T> retorna_U(Matriz<T> &matriz)
+void retorna_U(const MatrizView<T> &matriz)
 {
-    if (!verificar_matriz_quadrada(matriz)) {
+    if (!verificar_matriz_quadrada<T>(matriz)) {
         throw std::invalid_argument("Matriz não é quadrada.");
     }
 
-    int n = static_cast<int>(matriz.linhas());
+    const size_t n = matriz.linhas();
 
-    for (int i = 0; i < n - 1; ++i) {
-        for (int k = i + 1; k < n; ++k) {
-            T fator = matriz(k, i) / matriz(i, i);
+    for (size_t i = 0; i + 1 < n; ++i) {
+        paralelo::para(i + 1, n, n - i, [&](size_t inicio, size_t fim) {
+            for (size_t k = inicio; k < fim; ++k) {
+                T fator = matriz.elemento(k, i) / matriz.elemento(i, i);
 
-            for (int j = i; j < n; ++j) {
-                matriz(k, j) -= matriz(i, j) * fator;
+                detail::subtrair_multiplo(&matriz.elemento(k, i), &matriz.elemento(i, i), n - i,
+                                          matriz.passo_coluna(), fator);
             }
-        }
+        });
     }
+}
 
+/*!
+ * @brief Calcula a matriz U no próprio buffer e a retorna.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> retorna_U(Matriz<T> &matriz)
+{
+    retorna_U(matriz.visao());
     return matriz; // Agora retorna apenas a matriz U
 }
 
@@ -221,36 +341,49 @@ Matriz<T> retorna_U(Matriz<T> &matriz)
 * @date 27/03/202
 */
 template <typename T>
-Matriz<T> retorna_L(Matriz<T> &matriz)
+Matriz<T> retorna_L(const MatrizView<T> &matriz)
 {
-    if (!verificar_matriz_quadrada(matriz)) {
+    if (!verificar_matriz_quadrada<T>(matriz)) {
         throw std::invalid_argument("Matriz não é quadrada.");
     }
 
-    int n = static_cast<int>(matriz.linhas());
+    const size_t n = matriz.linhas();
     Matriz<T> L(n, n); // Criamos uma nova matriz L
 
     // Inicializa a matriz L com a identidade (valores 1 na diagonal e 0 fora da diagonal)
-    for (int i = 0; i < n; ++i) {
-        L(i, i) = 1; // Diagonal principal é 1
-        for (int j = i + 1; j < n; ++j) {
-            L(i, j) = 0; // Valores acima da diagonal são 0
+    for (size_t i = 0; i < n; ++i) {
+        L.elemento(i, i) = 1; // Diagonal principal é 1
+        for (size_t j = i + 1; j < n; ++j) {
+            L.elemento(i, j) = 0; // Valores acima da diagonal são 0
         }
     }
 
-    for (int i = 0; i < n - 1; ++i) {
-        for (int k = i + 1; k < n; ++k) {
-            T fator = matriz(k, i) / matriz(i, i);
-            L(k, i) = fator; // Armazena o fator na matriz L
+    for (size_t i = 0; i + 1 < n; ++i) {
+        paralelo::para(i + 1, n, n - i, [&](size_t inicio, size_t fim) {
+            for (size_t k = inicio; k < fim; ++k) {
+                T fator = matriz.elemento(k, i) / matriz.elemento(i, i);
+                L.elemento(k, i) = fator; // Armazena o fator na matriz L
 
-            for (int j = i; j < n; ++j) {
                 // Atualiza a matriz original (ou já modificada) para a próxima iteração
-                matriz(k, j) -= matriz(i, j) * fator;
+                detail::subtrair_multiplo(&matriz.elemento(k, i), &matriz.elemento(i, i), n - i,
+                                          matriz.passo_coluna(), fator);
             }
-        }
+        });
     }
 
     return L; // Retorna a matriz L
 }
 
+/*!
+ * @brief Calcula a matriz L de uma matriz (que sai escalonada, como em retorna_U).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> retorna_L(Matriz<T> &matriz)
+{
+    return retorna_L(matriz.visao());
+}
+
 } // namespace ifnum
\ No newline at end of file
@@ -0,0 +1,192 @@
+/*!
+ * @file Alocador.hpp
+ * @brief Alocadores da biblioteca: memória alinhada e área de trabalho (arena) reutilizável.
+ *
+ * `AlocadorAlinhado` é o alocador padrão de Matriz: todo buffer começa em um endereço
+ * múltiplo de 64 bytes (uma linha de cache, e a largura de um registrador AVX-512), o que
+ * deixa os kernels SIMD livres de cargas desalinhadas no início das linhas.
+ *
+ * `Arena` reserva blocos grandes e entrega pedaços deles por simples incremento de ponteiro;
+ * nada é devolvido individualmente, e `zerar()` recicla tudo de uma vez. Matrizes e solvers
+ * que recebem uma arena (via `AlocadorArena`) não chamam o malloc em regime permanente:
+ *
+ * @code
+ * ifnum::Arena area;
+ * for (...) {
+ *     area.zerar();
+ *     ifnum::MatrizArena<double> x = ifnum::resolverLU(A, b, area);
+ *     ...
+ * }
+ * @endcode
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace ifnum
+{
+/*! @brief Alinhamento padrão (em bytes) dos buffers de Matriz e das alocações da Arena. */
+inline constexpr size_t alinhamento_padrao = 64;
+
+/*!
+ * @brief Alocador padrão com endereços alinhados a `Alinhamento` bytes.
+ *
+ * @tparam T Tipo dos elementos.
+ * @tparam Alinhamento Alinhamento em bytes (potência de 2).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t Alinhamento = alinhamento_padrao>
+class AlocadorAlinhado
+{
+    static_assert((Alinhamento & (Alinhamento - 1)) == 0 && Alinhamento >= alignof(T),
+                  "O alinhamento deve ser uma potência de 2 e respeitar alignof(T).");
+
+  public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    template <typename U>
+    struct rebind {
+        using other = AlocadorAlinhado<U, Alinhamento>;
+    };
+
+    AlocadorAlinhado() noexcept = default;
+    template <typename U>
+    AlocadorAlinhado(const AlocadorAlinhado<U, Alinhamento> &) noexcept;
+
+    T *allocate(size_t n);
+    void deallocate(T *p, size_t n) noexcept;
+};
+
+/*!
+ * @brief Área de trabalho para temporários: aloca por incremento de ponteiro e libera tudo
+ *        de uma vez.
+ *
+ * A memória vem de blocos alinhados a 64 bytes, que são mantidos entre os ciclos. Quando um
+ * ciclo precisou de mais de um bloco, `zerar()` os funde em um só do tamanho somado, de
+ * modo que a partir do segundo ciclo com o mesmo padrão de uso não há mais alocações.
+ *
+ * A arena não é segura para uso simultâneo por várias threads (use uma por thread) e não
+ * pode ser copiada nem movida, já que os alocadores guardam o seu endereço. Objetos criados
+ * nela não podem ser usados depois de `zerar()` ou `restaurar()` liberar a sua memória.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+class Arena
+{
+  public:
+    /*! @brief Posição da arena, para liberar só o que foi alocado depois dela. */
+    struct Marca {
+        size_t bloco;
+        size_t posicao;
+    };
+
+  private:
+    struct Bloco {
+        unsigned char *inicio;
+        size_t tamanho;
+    };
+
+    std::vector<Bloco> blocos_;
+    size_t atual_ = 0;   // bloco em uso
+    size_t posicao_ = 0; // bytes ocupados no bloco em uso
+
+    static constexpr size_t bloco_minimo_ = size_t(64) << 10;
+
+    void novo_bloco_(size_t tamanho);
+
+  public:
+    explicit Arena(size_t capacidade = 0);
+    ~Arena();
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    void *alocar(size_t bytes, size_t alinhamento = alinhamento_padrao);
+    void zerar();
+    Marca marca() const;
+    void restaurar(Marca marca);
+
+    size_t capacidade() const;
+    size_t em_uso() const;
+    size_t blocos() const;
+};
+
+/*!
+ * @brief Libera, ao sair do escopo, tudo o que foi alocado na arena dentro dele.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+class EscopoArena
+{
+  private:
+    Arena &arena_;
+    Arena::Marca marca_;
+
+  public:
+    explicit EscopoArena(Arena &arena);
+    ~EscopoArena();
+    EscopoArena(const EscopoArena &) = delete;
+    EscopoArena &operator=(const EscopoArena &) = delete;
+};
+
+/*!
+ * @brief Alocador que tira a memória de uma Arena.
+ *
+ * `deallocate` não faz nada: a memória volta quando a arena é zerada. Sem arena (construído
+ * por padrão), comporta-se como AlocadorAlinhado. A conversão implícita a partir de
+ * `Arena &` permite escrever `MatrizArena<double> m(linhas, colunas, area)`.
+ *
+ * @tparam T Tipo dos elementos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+class AlocadorArena
+{
+  private:
+    Arena *arena_ = nullptr;
+
+  public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    AlocadorArena() noexcept = default;
+    AlocadorArena(Arena &arena) noexcept;
+    template <typename U>
+    AlocadorArena(const AlocadorArena<U> &outro) noexcept;
+
+    Arena *arena() const noexcept;
+
+    T *allocate(size_t n);
+    void deallocate(T *p, size_t n) noexcept;
+};
+
+namespace detail
+{
+/*! @brief true se o alocador tira a memória do heap (e não de uma Arena). */
+template <typename A>
+bool usa_heap(const A &alocador) noexcept;
+} // namespace detail
+
+template <typename T, typename U, size_t A>
+bool operator==(const AlocadorAlinhado<T, A> &, const AlocadorAlinhado<U, A> &) noexcept;
+template <typename T, typename U, size_t A>
+bool operator!=(const AlocadorAlinhado<T, A> &, const AlocadorAlinhado<U, A> &) noexcept;
+template <typename T, typename U>
+bool operator==(const AlocadorArena<T> &a, const AlocadorArena<U> &b) noexcept;
+template <typename T, typename U>
+bool operator!=(const AlocadorArena<T> &a, const AlocadorArena<U> &b) noexcept;
+
+} // namespace ifnum
+
+#include "Alocador.tpp"
@@ -0,0 +1,118 @@
+/*!
+ * @file Alocador.tpp
+ * @brief Implementação dos alocadores declarados em `Alocador.hpp`.
+ */
+
+#ifdef __INTELLISENSE__
+#include "Alocador.hpp"
+#endif
+
+namespace ifnum
+{
+template <typename T, size_t Alinhamento>
+template <typename U>
+AlocadorAlinhado<T, Alinhamento>::AlocadorAlinhado(
+    const AlocadorAlinhado<U, Alinhamento> &) noexcept
+{
+}
+
+/*!
+ * @brief Aloca n elementos (não inicializados) com o endereço alinhado.
+ *
+ * @throws std::bad_alloc Se não houver memória.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t Alinhamento>
+T *AlocadorAlinhado<T, Alinhamento>::allocate(size_t n)
+{
+    return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(Alinhamento)));
+}
+
+template <typename T, size_t Alinhamento>
+void AlocadorAlinhado<T, Alinhamento>::deallocate(T *p, size_t) noexcept
+{
+    ::operator delete(p, std::align_val_t(Alinhamento));
+}
+
+template <typename T>
+AlocadorArena<T>::AlocadorArena(Arena &arena) noexcept : arena_(&arena)
+{
+}
+
+template <typename T>
+template <typename U>
+AlocadorArena<T>::AlocadorArena(const AlocadorArena<U> &outro) noexcept : arena_(outro.arena())
+{
+}
+
+/*! @brief Arena de origem da memória (nullptr se o alocador usa o heap). */
+template <typename T>
+Arena *AlocadorArena<T>::arena() const noexcept
+{
+    return arena_;
+}
+
+/*!
+ * @brief Aloca n elementos (não inicializados) na arena, ou no heap se não houver arena.
+ *
+ * @throws std::bad_alloc Se não houver memória.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T *AlocadorArena<T>::allocate(size_t n)
+{
+    constexpr size_t alinhamento = std::max(alinhamento_padrao, alignof(T));
+    if (arena_)
+        return static_cast<T *>(arena_->alocar(n * sizeof(T), alinhamento));
+    return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(alinhamento)));
+}
+
+template <typename T>
+void AlocadorArena<T>::deallocate(T *p, size_t) noexcept
+{
+    constexpr size_t alinhamento = std::max(alinhamento_padrao, alignof(T));
+    if (!arena_)
+        ::operator delete(p, std::align_val_t(alinhamento));
+}
+
+namespace detail
+{
+template <typename A>
+bool usa_heap([[maybe_unused]] const A &alocador) noexcept
+{
+    if constexpr (std::is_same_v<A, AlocadorArena<typename A::value_type>>)
+        return !alocador.arena();
+    else
+        return true;
+}
+} // namespace detail
+
+template <typename T, typename U, size_t A>
+bool operator==(const AlocadorAlinhado<T, A> &, const AlocadorAlinhado<U, A> &) noexcept
+{
+    return true;
+}
+
+template <typename T, typename U, size_t A>
+bool operator!=(const AlocadorAlinhado<T, A> &, const AlocadorAlinhado<U, A> &) noexcept
+{
+    return false;
+}
+
+template <typename T, typename U>
+bool operator==(const AlocadorArena<T> &a, const AlocadorArena<U> &b) noexcept
+{
+    return a.arena() == b.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const AlocadorArena<T> &a, const AlocadorArena<U> &b) noexcept
+{
+    return a.arena() != b.arena();
+}
+
+} // namespace ifnum
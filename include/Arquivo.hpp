@@ -0,0 +1,211 @@
+/*!
+ * @file Arquivo.hpp
+ * @brief Formato binário de matrizes: mapeamento em memória, gravação em fluxo e operações
+ *        fora da memória (out-of-core).
+ *
+ * Um arquivo começa com um cabeçalho de 64 bytes (CabecalhoArquivo: dimensões, tipo dos
+ * elementos, ordem de armazenamento e alinhamento) seguido dos elementos, crus, a partir
+ * de um deslocamento alinhado. MatrizMapeada mapeia o arquivo com mmap e o expõe como uma
+ * ConstMatrizView sem copiar nada: só as páginas realmente lidas vêm do disco.
+ * EscritorMatriz grava linha a linha, sem precisar da matriz inteira em memória.
+ *
+ * `multiplicar_arquivos` e `transpor_arquivo` processam matrizes maiores que a RAM em
+ * painéis, com uso de memória limitado, pedindo ao sistema a leitura antecipada do
+ * próximo painel enquanto o atual é processado.
+ *
+ * Os arquivos usam a ordem de bytes da máquina que os gravou; a leitura em uma máquina de
+ * ordem diferente é recusada. Requer um sistema POSIX (mmap/madvise).
+ */
+
+#pragma once
+#include "Matriz.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ifnum
+{
+/*!
+ * @brief Tipo dos elementos gravados no arquivo.
+ */
+enum class TipoDado : uint32_t {
+    f32 = 1, //!< float
+    f64 = 2, //!< double
+    i32 = 3, //!< int32_t
+    i64 = 4, //!< int64_t
+};
+
+/*!
+ * @brief Ordem de armazenamento dos elementos.
+ */
+enum class Ordem : uint32_t {
+    por_linha = 0,  //!< Elemento (i, j) em i * passo + j.
+    por_coluna = 1, //!< Elemento (i, j) em j * passo + i.
+};
+
+/*!
+ * @brief Padrão de acesso esperado, repassado ao sistema (madvise) ao mapear o arquivo.
+ */
+enum class Acesso {
+    normal,
+    sequencial, //!< Leitura antecipada agressiva; páginas lidas podem ser descartadas cedo.
+    aleatorio,  //!< Sem leitura antecipada.
+};
+
+/*!
+ * @brief Cabeçalho de 64 bytes no início de todo arquivo de matriz.
+ */
+struct CabecalhoArquivo {
+    char magica[8];        //!< "IFNUMMAT"
+    uint32_t versao;       //!< Versão do formato (1).
+    uint32_t marca_bytes;  //!< 0x01020304 na ordem de bytes de quem gravou.
+    uint32_t tipo;         //!< TipoDado.
+    uint32_t ordem;        //!< Ordem.
+    uint64_t linhas;
+    uint64_t colunas;
+    uint64_t passo;        //!< Elementos entre linhas (ou colunas) consecutivas.
+    uint32_t alinhamento;  //!< Alinhamento do início dos dados, em bytes.
+    uint32_t reservado;
+    uint64_t deslocamento; //!< Posição do primeiro elemento, em bytes.
+};
+static_assert(sizeof(CabecalhoArquivo) == 64, "O cabeçalho deve ter 64 bytes.");
+
+namespace detail
+{
+template <typename T>
+constexpr TipoDado tipo_dado();
+
+CabecalhoArquivo novo_cabecalho(TipoDado tipo, size_t linhas, size_t colunas);
+void validar_cabecalho(const CabecalhoArquivo &c, TipoDado tipo, size_t tamanho_arquivo,
+                       const std::string &caminho);
+bool mesmo_arquivo(const std::string &a, const std::string &b);
+
+/*!
+ * @brief Arquivo mapeado somente para leitura (RAII sobre open/mmap/munmap).
+ */
+class Mapeamento
+{
+  private:
+    const unsigned char *dados_ = nullptr;
+    size_t tamanho_ = 0;
+
+  public:
+    Mapeamento(const std::string &caminho, Acesso acesso);
+    ~Mapeamento();
+    Mapeamento(Mapeamento &&outro) noexcept;
+    Mapeamento &operator=(Mapeamento &&outro) noexcept;
+    Mapeamento(const Mapeamento &) = delete;
+    Mapeamento &operator=(const Mapeamento &) = delete;
+
+    const unsigned char *dados() const;
+    size_t tamanho() const;
+    void antecipar(size_t inicio, size_t bytes) const;
+    void descartar(size_t inicio, size_t bytes) const;
+};
+
+/*!
+ * @brief Arquivo de saída com buffer grande, para gravação sequencial.
+ */
+class ArquivoSaida
+{
+  private:
+    std::FILE *arquivo_ = nullptr;
+    std::string caminho_;
+
+  public:
+    explicit ArquivoSaida(const std::string &caminho);
+    ~ArquivoSaida();
+    ArquivoSaida(const ArquivoSaida &) = delete;
+    ArquivoSaida &operator=(const ArquivoSaida &) = delete;
+
+    void escrever(const void *dados, size_t bytes);
+    void fechar();
+};
+} // namespace detail
+
+/*!
+ * @brief Matriz de um arquivo, mapeada em memória somente para leitura.
+ *
+ * `visao()` aponta diretamente para as páginas do arquivo (sem cópia) e continua válida
+ * enquanto o objeto existir. Arquivos gravados por coluna aparecem como visões com
+ * `passo_coluna() != 1`.
+ *
+ * @tparam T Tipo dos elementos; deve corresponder ao tipo gravado no arquivo.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+class MatrizMapeada
+{
+  private:
+    detail::Mapeamento mapa_;
+    CabecalhoArquivo cabecalho_;
+
+  public:
+    explicit MatrizMapeada(const std::string &caminho, Acesso acesso = Acesso::normal);
+
+    size_t linhas() const;
+    size_t colunas() const;
+    Ordem ordem() const;
+    const T *data() const;
+
+    ConstMatrizView<T> visao() const;
+    operator ConstMatrizView<T>() const;
+
+    void antecipar(size_t inicio, size_t quantidade) const;
+    void descartar(size_t inicio, size_t quantidade) const;
+};
+
+/*!
+ * @brief Grava uma matriz em arquivo, linha a linha, sem mantê-la inteira em memória.
+ *
+ * O cabeçalho é gravado na construção, com as dimensões finais; as linhas são então
+ * acrescentadas em ordem. `fechar()` confere que todas as linhas foram escritas.
+ *
+ * @tparam T Tipo dos elementos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+class EscritorMatriz
+{
+  private:
+    detail::ArquivoSaida saida_;
+    size_t linhas_;
+    size_t colunas_;
+    size_t escritas_ = 0;
+    std::vector<T> linha_; // só para visões com colunas não contíguas
+
+  public:
+    EscritorMatriz(const std::string &caminho, size_t linhas, size_t colunas);
+
+    void escrever_linha(const T *linha);
+    void escrever(const ConstMatrizView<T> &bloco);
+    size_t linhas_escritas() const;
+    void fechar();
+};
+
+template <typename T>
+void salvar(const std::string &caminho, const ConstMatrizView<T> &m);
+template <typename T, typename Alloc>
+void salvar(const std::string &caminho, const Matriz<T, Alloc> &m);
+template <typename T>
+Matriz<T> carregar(const std::string &caminho);
+
+/*! @brief Memória padrão dos painéis das operações fora da memória (256 MiB). */
+inline constexpr size_t memoria_padrao = size_t(256) << 20;
+
+template <typename T>
+void multiplicar_arquivos(const std::string &caminho_a, const std::string &caminho_b,
+                          const std::string &caminho_c, size_t memoria = memoria_padrao);
+template <typename T>
+void transpor_arquivo(const std::string &origem, const std::string &destino,
+                      size_t memoria = memoria_padrao);
+
+} // namespace ifnum
+
+#include "Arquivo.tpp"
@@ -0,0 +1,442 @@
+/*!
+ * @file Arquivo.tpp
+ * @brief Implementação das partes template do formato binário (ver Arquivo.hpp).
+ */
+
+#ifdef __INTELLISENSE__
+#include "Arquivo.hpp"
+#endif
+
+namespace ifnum
+{
+namespace detail
+{
+/*! @brief TipoDado correspondente a T (erro de compilação para tipos sem correspondente). */
+template <typename T>
+constexpr TipoDado tipo_dado()
+{
+    if constexpr (std::is_same_v<T, float>)
+        return TipoDado::f32;
+    else if constexpr (std::is_same_v<T, double>)
+        return TipoDado::f64;
+    else if constexpr (std::is_same_v<T, int32_t>)
+        return TipoDado::i32;
+    else {
+        static_assert(std::is_same_v<T, int64_t>, "Tipo sem representação no formato binário.");
+        return TipoDado::i64;
+    }
+}
+} // namespace detail
+
+/*!
+ * @brief Mapeia o arquivo e confere o cabeçalho.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param caminho Caminho do arquivo.
+ * @param acesso Padrão de acesso esperado (ver Acesso).
+ * @throws std::runtime_error Se o arquivo não existir, não for uma matriz válida ou estiver
+ *         truncado.
+ * @throws std::invalid_argument Se os elementos do arquivo não forem do tipo T.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizMapeada<T>::MatrizMapeada(const std::string &caminho, Acesso acesso)
+    : mapa_(caminho, acesso), cabecalho_{}
+{
+    if (mapa_.tamanho() >= sizeof(CabecalhoArquivo))
+        std::memcpy(&cabecalho_, mapa_.dados(), sizeof(CabecalhoArquivo));
+    detail::validar_cabecalho(cabecalho_, detail::tipo_dado<T>(), mapa_.tamanho(), caminho);
+}
+
+template <typename T>
+size_t MatrizMapeada<T>::linhas() const
+{
+    return static_cast<size_t>(cabecalho_.linhas);
+}
+
+template <typename T>
+size_t MatrizMapeada<T>::colunas() const
+{
+    return static_cast<size_t>(cabecalho_.colunas);
+}
+
+template <typename T>
+Ordem MatrizMapeada<T>::ordem() const
+{
+    return static_cast<Ordem>(cabecalho_.ordem);
+}
+
+/*! @brief Ponteiro para o primeiro elemento, dentro do mapeamento. */
+template <typename T>
+const T *MatrizMapeada<T>::data() const
+{
+    return reinterpret_cast<const T *>(mapa_.dados() + cabecalho_.deslocamento);
+}
+
+/*!
+ * @brief Visão somente leitura sobre os elementos mapeados, sem cópia.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+ConstMatrizView<T> MatrizMapeada<T>::visao() const
+{
+    const size_t passo = static_cast<size_t>(cabecalho_.passo);
+    if (ordem() == Ordem::por_linha)
+        return ConstMatrizView<T>(data(), linhas(), colunas(), passo, 1);
+    return ConstMatrizView<T>(data(), linhas(), colunas(), 1, passo);
+}
+
+template <typename T>
+MatrizMapeada<T>::operator ConstMatrizView<T>() const
+{
+    return visao();
+}
+
+/*!
+ * @brief Pede a leitura antecipada das linhas (ou colunas, se gravado por coluna)
+ *        [inicio, inicio + quantidade), sem bloquear.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void MatrizMapeada<T>::antecipar(size_t inicio, size_t quantidade) const
+{
+    const size_t passo = static_cast<size_t>(cabecalho_.passo) * sizeof(T);
+    mapa_.antecipar(cabecalho_.deslocamento + inicio * passo, quantidade * passo);
+}
+
+/*!
+ * @brief Libera da memória as linhas (ou colunas) [inicio, inicio + quantidade) já usadas.
+ *
+ * Os dados continuam acessíveis (são relidos do arquivo se necessário).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void MatrizMapeada<T>::descartar(size_t inicio, size_t quantidade) const
+{
+    const size_t passo = static_cast<size_t>(cabecalho_.passo) * sizeof(T);
+    mapa_.descartar(cabecalho_.deslocamento + inicio * passo, quantidade * passo);
+}
+
+/*!
+ * @brief Cria o arquivo e grava o cabeçalho.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param caminho Caminho do arquivo (sobrescrito se existir).
+ * @param linhas Número de linhas que serão escritas.
+ * @param colunas Número de colunas.
+ * @throws std::runtime_error Se o arquivo não puder ser criado.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+EscritorMatriz<T>::EscritorMatriz(const std::string &caminho, size_t linhas, size_t colunas)
+    : saida_(caminho), linhas_(linhas), colunas_(colunas)
+{
+    const CabecalhoArquivo c = detail::novo_cabecalho(detail::tipo_dado<T>(), linhas, colunas);
+    saida_.escrever(&c, sizeof(c));
+}
+
+/*!
+ * @brief Acrescenta uma linha (colunas() elementos contíguos).
+ *
+ * @throws std::out_of_range Se todas as linhas já foram escritas.
+ * @throws std::runtime_error Se a escrita falhar.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void EscritorMatriz<T>::escrever_linha(const T *linha)
+{
+    if (escritas_ == linhas_)
+        throw std::out_of_range("Todas as linhas do arquivo já foram escritas.");
+    saida_.escrever(linha, colunas_ * sizeof(T));
+    escritas_++;
+}
+
+/*!
+ * @brief Acrescenta as linhas de um bloco (qualquer visão com colunas() colunas).
+ *
+ * @throws std::invalid_argument Se o número de colunas for diferente.
+ * @throws std::out_of_range Se o bloco passar do número de linhas do arquivo.
+ * @throws std::runtime_error Se a escrita falhar.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void EscritorMatriz<T>::escrever(const ConstMatrizView<T> &bloco)
+{
+    if (bloco.colunas() != colunas_)
+        throw std::invalid_argument("Número de colunas diferente do arquivo.");
+    if (bloco.linhas() > linhas_ - escritas_)
+        throw std::out_of_range("O bloco passa do número de linhas do arquivo.");
+
+    IFNUM_BYTES(bloco.linhas() * colunas_ * sizeof(T));
+    if (bloco.passo_coluna() == 1) {
+        if (bloco.passo_linha() == colunas_) {
+            saida_.escrever(bloco.data(), bloco.linhas() * colunas_ * sizeof(T));
+            escritas_ += bloco.linhas();
+            return;
+        }
+        for (size_t i = 0; i < bloco.linhas(); i++)
+            escrever_linha(bloco.data() + i * bloco.passo_linha());
+        return;
+    }
+
+    linha_.resize(colunas_);
+    for (size_t i = 0; i < bloco.linhas(); i++) {
+        for (size_t j = 0; j < colunas_; j++)
+            linha_[j] = bloco.elemento(i, j);
+        escrever_linha(linha_.data());
+    }
+}
+
+template <typename T>
+size_t EscritorMatriz<T>::linhas_escritas() const
+{
+    return escritas_;
+}
+
+/*!
+ * @brief Grava os dados pendentes e fecha o arquivo.
+ *
+ * Sem chamar fechar(), o destrutor fecha o arquivo sem conferir nada; um arquivo
+ * incompleto é recusado na leitura (fica truncado).
+ *
+ * @throws std::runtime_error Se faltarem linhas ou a gravação falhar.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void EscritorMatriz<T>::fechar()
+{
+    saida_.fechar();
+    if (escritas_ != linhas_)
+        throw std::runtime_error("Arquivo incompleto: faltaram linhas.");
+}
+
+/*!
+ * @brief Grava uma matriz (ou visão) em arquivo binário.
+ *
+ * @tparam T Tipo dos elementos (float, double, int32_t ou int64_t).
+ * @param caminho Caminho do arquivo (sobrescrito se existir).
+ * @param m Matriz a gravar.
+ * @throws std::runtime_error Se o arquivo não puder ser gravado.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void salvar(const std::string &caminho, const ConstMatrizView<T> &m)
+{
+    EscritorMatriz<T> escritor(caminho, m.linhas(), m.colunas());
+    escritor.escrever(m);
+    escritor.fechar();
+}
+
+template <typename T, typename Alloc>
+void salvar(const std::string &caminho, const Matriz<T, Alloc> &m)
+{
+    salvar(caminho, m.visao());
+}
+
+/*!
+ * @brief Lê um arquivo binário para uma nova Matriz (em ordem de linha).
+ *
+ * Para usar os dados sem copiá-los, prefira MatrizMapeada.
+ *
+ * @tparam T Tipo dos elementos gravados.
+ * @param caminho Caminho do arquivo.
+ * @return Matriz com os dados do arquivo.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> carregar(const std::string &caminho)
+{
+    const MatrizMapeada<T> mapa(caminho, Acesso::sequencial);
+    return Matriz<T>(mapa.visao());
+}
+
+namespace detail
+{
+/*!
+ * @brief Grava a visão `a` em `destino`, por linha, usando ~`memoria` bytes.
+ *
+ * A saída é montada em painéis de linhas, copiados em blocos de 64 x 64 para aproveitar a
+ * cache quando `a` não tem linhas contíguas (arquivo por coluna ou visão transposta), e
+ * gravada em fluxo.
+ */
+template <typename T>
+void gravar_por_linha(const ConstMatrizView<T> &a, const std::string &destino, size_t memoria)
+{
+    const size_t m = a.linhas(), n = a.colunas();
+    IFNUM_BYTES(2 * m * n * sizeof(T));
+    const size_t mb =
+        std::max<size_t>(1, std::min(m, memoria / std::max<size_t>(1, sizeof(T) * n)));
+    constexpr size_t bloco = 64;
+
+    EscritorMatriz<T> S(destino, m, n);
+    Matriz<T> painel(std::min(mb, m), n);
+    const T *d = a.data();
+    const size_t pl = a.passo_linha(), pc = a.passo_coluna();
+
+    for (size_t i0 = 0; i0 < m; i0 += mb) {
+        const size_t ib = std::min(mb, m - i0);
+        T *p = painel.data();
+        for (size_t j0 = 0; j0 < n; j0 += bloco) {
+            const size_t j1 = std::min(n, j0 + bloco);
+            for (size_t ii = 0; ii < ib; ii += bloco) {
+                const size_t i1 = std::min(ib, ii + bloco);
+                for (size_t j = j0; j < j1; j++)
+                    for (size_t i = ii; i < i1; i++)
+                        p[i * n + j] = d[(i0 + i) * pl + j * pc];
+            }
+        }
+        S.escrever(painel.bloco(0, 0, ib, n));
+    }
+    S.fechar();
+}
+
+/*! @brief Remove o arquivo ao sair do escopo, inclusive por exceção. */
+struct ArquivoTemporario {
+    std::string caminho;
+
+    explicit ArquivoTemporario(std::string c) : caminho(std::move(c))
+    {
+    }
+
+    ~ArquivoTemporario()
+    {
+        std::remove(caminho.c_str());
+    }
+
+    ArquivoTemporario(const ArquivoTemporario &) = delete;
+    ArquivoTemporario &operator=(const ArquivoTemporario &) = delete;
+};
+
+/*!
+ * @brief Painéis de multiplicar_arquivos, com B já em uma visão de linhas contíguas.
+ */
+template <typename T>
+void multiplicar_paineis(const MatrizMapeada<T> &A, const ConstMatrizView<T> &B,
+                         const std::string &caminho_c, size_t memoria)
+{
+    const size_t m = A.linhas(), k = A.colunas(), n = B.colunas();
+    IFNUM_FLOPS(2 * m * n * k);
+    const size_t por_linha = sizeof(T) * (n + k);
+    const size_t mb = std::max<size_t>(1, std::min(m, memoria / std::max<size_t>(1, por_linha)));
+
+    EscritorMatriz<T> C(caminho_c, m, n);
+    Matriz<T> painel(std::min(mb, m), n);
+    const bool a_por_linha = A.ordem() == Ordem::por_linha;
+    if (a_por_linha)
+        A.antecipar(0, mb);
+
+    for (size_t i0 = 0; i0 < m; i0 += mb) {
+        const size_t ib = std::min(mb, m - i0);
+        if (a_por_linha && i0 + ib < m)
+            A.antecipar(i0 + ib, std::min(mb, m - i0 - ib));
+
+        const MatrizView<T> c = painel.bloco(0, 0, ib, n);
+        gemm(c, T(1), A.visao().bloco(i0, 0, ib, k), B, T(0));
+        C.escrever(c);
+
+        if (a_por_linha)
+            A.descartar(i0, ib);
+    }
+    C.fechar();
+}
+} // namespace detail
+
+/*!
+ * @brief C = A * B com as três matrizes em arquivo, usando no máximo ~`memoria` bytes.
+ *
+ * A é percorrida em painéis de linhas: cada painel de C (linhas x n) é calculado em
+ * memória pelo GEMM blocado, lendo A e B diretamente do mapeamento, e gravado em seguida.
+ * Enquanto um painel é calculado, o sistema já lê o próximo painel de A (madvise), e o
+ * painel anterior é liberado. B é relida a cada painel, então painéis maiores (mais
+ * memória) significam menos leituras de B.
+ *
+ * O GEMM lê B por linhas. Se B estiver gravada por coluna, ela é regravada por linha uma
+ * única vez, antes dos painéis, em um arquivo temporário `caminho_c + ".b.tmp"` (do mesmo
+ * tamanho que B, removido ao final); sem isso, cada painel copiaria B inteira.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param caminho_a Arquivo de A (m x k).
+ * @param caminho_b Arquivo de B (k x n).
+ * @param caminho_c Arquivo de saída para C (m x n, por linha).
+ * @param memoria Memória para os painéis de C (e cópias de painéis de A gravada por coluna).
+ * @throws std::invalid_argument Se as dimensões forem incompatíveis ou se caminho_c for o
+ *         arquivo de A ou de B (abri-lo para escrita truncaria a entrada ainda mapeada).
+ * @throws std::runtime_error Se algum arquivo não puder ser lido ou gravado.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void multiplicar_arquivos(const std::string &caminho_a, const std::string &caminho_b,
+                          const std::string &caminho_c, size_t memoria)
+{
+    const MatrizMapeada<T> A(caminho_a, Acesso::sequencial);
+    const MatrizMapeada<T> B(caminho_b);
+    if (A.colunas() != B.linhas())
+        throw std::invalid_argument("Matrizes com dimensões incompatíveis para multiplicação.");
+    for (const std::string &saida : {caminho_c, caminho_c + ".b.tmp"})
+        if (detail::mesmo_arquivo(saida, caminho_a) || detail::mesmo_arquivo(saida, caminho_b))
+            throw std::invalid_argument("O arquivo de saída é uma das entradas: " + saida);
+
+    IFNUM_MEDIR("multiplicar_arquivos");
+    if (B.ordem() == Ordem::por_linha) {
+        detail::multiplicar_paineis(A, B.visao(), caminho_c, memoria);
+        return;
+    }
+
+    const detail::ArquivoTemporario copia(caminho_c + ".b.tmp");
+    detail::gravar_por_linha(B.visao(), copia.caminho, memoria);
+    const MatrizMapeada<T> B_por_linha(copia.caminho);
+    detail::multiplicar_paineis(A, B_por_linha.visao(), caminho_c, memoria);
+}
+
+/*!
+ * @brief Grava em `destino` a transposta da matriz em `origem`, usando ~`memoria` bytes.
+ *
+ * A saída é montada em painéis de linhas (colunas da origem), transpostos em blocos de
+ * 64 x 64 para aproveitar a cache, e gravada em fluxo.
+ *
+ * Para apenas ler a transposta, `MatrizMapeada::visao().transposta()` não custa nada; esta
+ * função serve para obter um arquivo por linha com o acesso rápido na outra direção.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param origem Arquivo de entrada (m x n).
+ * @param destino Arquivo de saída (n x m, por linha).
+ * @param memoria Memória para o painel de saída.
+ * @throws std::invalid_argument Se destino for o próprio arquivo de origem.
+ * @throws std::runtime_error Se algum arquivo não puder ser lido ou gravado.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void transpor_arquivo(const std::string &origem, const std::string &destino, size_t memoria)
+{
+    const MatrizMapeada<T> A(origem, Acesso::sequencial);
+    if (detail::mesmo_arquivo(destino, origem))
+        throw std::invalid_argument("O arquivo de saída é a própria entrada: " + destino);
+    IFNUM_MEDIR("transpor_arquivo");
+    detail::gravar_por_linha(A.visao().transposta(), destino, memoria);
+}
+
+} // namespace ifnum
@@ -0,0 +1,115 @@
+/*!
+ * @file Autovalores.hpp
+ * @brief Declaração da classe template Autovalores (cálculo de autovalores sem alocação).
+ *
+ * Reúne os métodos de autovalores da biblioteca: Householder + QR implícito para matrizes
+ * simétricas, Hessenberg + QR de Francis para matrizes gerais, Lanczos para os maiores
+ * autovalores e o método da potência (com deslocamento e iteração inversa). Toda a memória
+ * de trabalho fica no objeto e é reaproveitada entre chamadas com a mesma ordem, o que
+ * permite calcular espectros repetidamente em um laço sem alocações.
+ */
+
+#pragma once
+#include "Iterativos.hpp"
+#include "LU.hpp"
+#include "Matriz.hpp"
+#include "MatrizEsparsa.hpp"
+#include "MatrizView.hpp"
+#include "Paralelo.hpp"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace ifnum
+{
+/*!
+ * @brief Solver de autovalores com espaço de trabalho reaproveitável.
+ *
+ * Os resultados são devolvidos por referência a buffers internos, válidos até a próxima
+ * chamada. Depois da primeira chamada para uma dada ordem n, as seguintes não alocam
+ * memória (exceto `maiores` com uma dimensão de Krylov maior que a anterior).
+ *
+ * | Método       | Matriz                  | Custo             |
+ * |--------------|-------------------------|-------------------|
+ * | `simetrica`  | simétrica               | ~4/3 n³ (+ 2 n³ com autovetores) |
+ * | `geral`      | qualquer                | ~10 n³            |
+ * | `maiores`    | simétrica, densa/esparsa| m produtos A·v + O(n m²) por ciclo |
+ * | `potencia`   | qualquer                | n² por iteração   |
+ * | `inversa`    | qualquer                | 2/3 n³ + n² por iteração |
+ *
+ * Exemplo:
+ * @code
+ * ifnum::Autovalores<double> solver(500);
+ * for (...) {
+ *     const auto &lambda = solver.simetrica(A); // ordem crescente, sem alocar
+ * }
+ * @endcode
+ *
+ * @tparam T Tipo dos elementos (ponto flutuante).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+class Autovalores
+{
+  private:
+    size_t n_ = 0;
+    std::vector<T> a_;       // cópia de trabalho n x n (refletores de Householder)
+    std::vector<T> q_;       // autovetores, um por linha
+    std::vector<T> d_;       // diagonal da tridiagonal
+    std::vector<T> e_;       // sobrediagonal da tridiagonal
+    std::vector<T> u_;       // vetores auxiliares de tamanho n
+    std::vector<T> p_;
+    std::vector<T> beta_;    // coeficientes dos refletores
+    std::vector<T> valores_; // autovalores reais
+    std::vector<std::complex<T>> complexos_;
+    std::vector<T> base_;    // base de Krylov (Lanczos)
+    std::vector<T> ritz_;    // autovetores da tridiagonal de Lanczos
+    std::vector<T> deslocada_;
+    std::optional<LU<T>> lu_;
+    int iteracoes_ = 0;
+    bool convergiu_ = false;
+    bool vetores_ = false;
+
+    void reservar_(size_t n);
+    void copiar_(const ConstMatrizView<T> &A, bool simetrica);
+    void tridiagonalizar_();
+    void acumular_householder_();
+    void hessenberg_();
+    void qr_francis_();
+    void multiplicar_(const ConstMatrizView<T> &A, const T *x, T *y) const;
+    template <typename F>
+    const std::vector<T> &lanczos_(size_t n, const F &aplicar, size_t k, double tolerancia,
+                                   size_t dimensao);
+
+  public:
+    explicit Autovalores(size_t n = 0);
+
+    const std::vector<T> &simetrica(const ConstMatrizView<T> &A, bool vetores = false);
+    ConstMatrizView<T> autovetores() const;
+    const std::vector<std::complex<T>> &geral(const ConstMatrizView<T> &A);
+
+    const std::vector<T> &maiores(const ConstMatrizView<T> &A, size_t k,
+                                  double tolerancia = 1e-10, size_t dimensao = 0);
+    const std::vector<T> &maiores(const MatrizEsparsa<T> &A, size_t k, double tolerancia = 1e-10,
+                                  size_t dimensao = 0);
+
+    T potencia(const ConstMatrizView<T> &A, double tolerancia, int r, T deslocamento = 0,
+               const std::vector<T> &x0 = {});
+    T inversa(const ConstMatrizView<T> &A, T deslocamento, double tolerancia, int r,
+              const std::vector<T> &x0 = {});
+    const std::vector<T> &vetor() const;
+
+    int iteracoes() const;
+    bool convergiu() const;
+};
+
+} // namespace ifnum
+
+#include "Autovalores.tpp"
@@ -0,0 +1,1044 @@
+/*!
+ * @file Autovalores.tpp
+ * @brief Implementação dos métodos da classe template Autovalores.
+ */
+
+#ifdef __INTELLISENSE__
+#include "Autovalores.hpp"
+#endif
+
+namespace ifnum
+{
+namespace detail
+{
+/*!
+ * @brief QL implícito com deslocamento de Wilkinson para uma matriz tridiagonal simétrica.
+ *
+ * Ao final, d contém os autovalores em ordem crescente. Se z não for nulo, as rotações são
+ * aplicadas às linhas de z (n x n, em ordem de linha), que terminam permutadas junto com d;
+ * partindo de z = Qᵀ, a linha i passa a ser o autovetor associado a d[i].
+ *
+ * @param d Diagonal (n elementos).
+ * @param e Sobrediagonal: e[i] acopla d[i] e d[i + 1]; e[n - 1] é ignorado.
+ * @param z Vetores a rotacionar, ou nullptr.
+ * @param n Ordem.
+ * @throws std::runtime_error Se algum autovalor não convergir em 60 iterações.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void ql_implicito(T *d, T *e, T *z, size_t n)
+{
+    if (n == 0)
+        return;
+    e[n - 1] = 0;
+
+    const T eps = std::numeric_limits<T>::epsilon();
+    T deslocamento = 0;
+    T referencia = 0;
+    for (size_t l = 0; l < n; l++) {
+        referencia = std::max(referencia, std::abs(d[l]) + std::abs(e[l]));
+        size_t m = l;
+        while (m < n - 1 && std::abs(e[m]) > eps * referencia)
+            m++;
+
+        int iter = 0;
+        while (m > l) {
+            if (++iter > 60)
+                throw std::runtime_error("O método QR não convergiu.");
+
+            // Deslocamento de Wilkinson a partir do bloco 2 x 2 do topo
+            T g = d[l];
+            T p = (d[l + 1] - g) / (2 * e[l]);
+            T r = std::copysign(std::hypot(p, T(1)), p);
+            d[l] = e[l] / (p + r);
+            d[l + 1] = e[l] * (p + r);
+            const T dl1 = d[l + 1];
+            T h = g - d[l];
+            for (size_t i = l + 2; i < n; i++)
+                d[i] -= h;
+            deslocamento += h;
+
+            // Varredura de rotações de Givens de m até l
+            p = d[m];
+            T c = 1, c2 = 1, c3 = 1;
+            T s = 0, s2 = 0;
+            const T el1 = e[l + 1];
+            for (size_t i = m; i-- > l;) {
+                c3 = c2;
+                c2 = c;
+                s2 = s;
+                g = c * e[i];
+                h = c * p;
+                r = std::hypot(p, e[i]);
+                e[i + 1] = s * r;
+                s = e[i] / r;
+                c = p / r;
+                p = c * d[i] - s * g;
+                d[i + 1] = h + s * (c * g + s * d[i]);
+
+                if (z) {
+                    T *__restrict zi = z + i * n;
+                    T *__restrict zi1 = z + (i + 1) * n;
+                    for (size_t k = 0; k < n; k++) {
+                        const T t = zi1[k];
+                        zi1[k] = s * zi[k] + c * t;
+                        zi[k] = c * zi[k] - s * t;
+                    }
+                }
+            }
+            p = -s * s2 * c3 * el1 * e[l] / dl1;
+            e[l] = s * p;
+            d[l] = c * p;
+
+            if (std::abs(e[l]) <= eps * referencia)
+                break;
+        }
+        d[l] += deslocamento;
+        e[l] = 0;
+    }
+
+    // Ordenação crescente (seleção: no máximo n trocas de linhas de z)
+    for (size_t i = 0; i + 1 < n; i++) {
+        size_t menor = i;
+        for (size_t j = i + 1; j < n; j++)
+            if (d[j] < d[menor])
+                menor = j;
+        if (menor != i) {
+            std::swap(d[i], d[menor]);
+            if (z)
+                std::swap_ranges(z + i * n, z + (i + 1) * n, z + menor * n);
+        }
+    }
+}
+
+/*!
+ * @brief Vetor inicial determinístico e normalizado para os métodos iterativos.
+ *
+ * Usa valores pseudoaleatórios (e não um vetor constante) para não começar ortogonal
+ * a um autovetor em matrizes com simetria.
+ */
+template <typename T>
+void vetor_inicial(T *v, size_t n, const std::vector<T> &x0)
+{
+    if (!x0.empty()) {
+        if (x0.size() != n)
+            throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+        std::copy(x0.begin(), x0.end(), v);
+    } else {
+        uint32_t estado = 0x9E3779B9u;
+        for (size_t i = 0; i < n; i++) {
+            estado = estado * 1664525u + 1013904223u;
+            v[i] = T(0.5) + T(estado >> 8) / T(1u << 24);
+        }
+    }
+    const T modulo = std::sqrt(produto_interno(v, v, n));
+    if (modulo == 0)
+        throw std::invalid_argument("O vetor inicial não pode ser nulo.");
+    for (size_t i = 0; i < n; i++)
+        v[i] /= modulo;
+}
+
+/*!
+ * @brief Máximo de reinícios de Lanczos em Autovalores::maiores antes de desistir.
+ *
+ * Cada reinício custa m - l produtos matriz-vetor. Espectros cujos maiores autovalores são
+ * muito próximos (separação relativa ~1e-6, como o do laplaciano 1D de ordem 2000) chegam a
+ * usar centenas de reinícios com a dimensão padrão; uma dimensão maior reduz esse número.
+ */
+inline constexpr int REINICIOS_LANCZOS = 1000;
+} // namespace detail
+
+/*!
+ * @brief Cria o solver e já reserva o espaço de trabalho para matrizes de ordem n.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param n Ordem esperada (0 adia a reserva para a primeira chamada).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Autovalores<T>::Autovalores(size_t n)
+{
+    reservar_(n);
+}
+
+template <typename T>
+void Autovalores<T>::reservar_(size_t n)
+{
+    n_ = n;
+    a_.resize(n * n);
+    d_.resize(n);
+    e_.resize(n);
+    u_.resize(n);
+    p_.resize(n);
+    beta_.resize(n);
+}
+
+/*!
+ * @brief Copia A para o espaço de trabalho; se simetrica, espelha o triângulo inferior.
+ */
+template <typename T>
+void Autovalores<T>::copiar_(const ConstMatrizView<T> &A, bool simetrica)
+{
+    if (A.linhas() != A.colunas())
+        throw std::invalid_argument("Matriz não é quadrada.");
+    reservar_(A.linhas());
+
+    const size_t n = n_;
+    for (size_t i = 0; i < n; i++) {
+        T *linha = a_.data() + i * n;
+        const size_t fim = simetrica ? i + 1 : n;
+        for (size_t j = 0; j < fim; j++)
+            linha[j] = A.elemento(i, j);
+    }
+    if (simetrica)
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = i + 1; j < n; j++)
+                a_[i * n + j] = a_[j * n + i];
+}
+
+/*!
+ * @brief Reduz a_ (simétrica) à forma tridiagonal (d_, e_) por refletores de Householder.
+ *
+ * No passo k, o refletor H = I - β v vᵀ anula a coluna k abaixo da subdiagonal, e o bloco
+ * restante é atualizado por S ← S - v wᵀ - w vᵀ, com w = β S v - (β² vᵀ S v / 2) v. Todas
+ * as operações percorrem linhas contíguas. O vetor v fica guardado na linha k de a_.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void Autovalores<T>::tridiagonalizar_()
+{
+    const size_t n = n_;
+    T *a = a_.data();
+
+    for (size_t k = 0; k + 2 < n; k++) {
+        const size_t L = n - k - 1;
+        T *v = a + k * n + k + 1; // coluna k abaixo da diagonal = linha k após a diagonal
+        T cauda = 0;
+        for (size_t i = 1; i < L; i++)
+            cauda += v[i] * v[i];
+
+        d_[k] = a[k * n + k];
+        if (cauda == 0) {
+            e_[k] = v[0];
+            beta_[k] = 0;
+            continue;
+        }
+
+        const T modulo = std::sqrt(v[0] * v[0] + cauda);
+        const T alfa = -std::copysign(modulo, v[0]);
+        const T beta = 1 / (modulo * modulo - alfa * v[0]);
+        v[0] -= alfa;
+        e_[k] = alfa;
+        beta_[k] = beta;
+
+        // p = β S v = β Σ v_i S_i (S é simétrica): combinação de linhas, que vetoriza sem
+        // reassociar somas; cada thread cuida de uma faixa de colunas.
+        T *S = a + (k + 1) * n + k + 1;
+        T *p = p_.data();
+        paralelo::para(0, L, L, [&](size_t inicio, size_t fim) {
+            std::fill(p + inicio, p + fim, T(0));
+            for (size_t i = 0; i < L; i++) {
+                const T *si = S + i * n;
+                const T vi = v[i];
+                for (size_t j = inicio; j < fim; j++)
+                    p[j] += vi * si[j];
+            }
+            for (size_t j = inicio; j < fim; j++)
+                p[j] *= beta;
+        });
+
+        // w = p - (β pᵀv / 2) v, guardado em p
+        T pv = 0;
+        for (size_t i = 0; i < L; i++)
+            pv += p[i] * v[i];
+        const T K = beta * pv / 2;
+        for (size_t i = 0; i < L; i++)
+            p[i] -= K * v[i];
+
+        paralelo::para(0, L, 2 * L, [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++) {
+                T *__restrict si = S + i * n;
+                const T vi = v[i];
+                const T wi = p[i];
+                for (size_t j = 0; j < L; j++)
+                    si[j] -= vi * p[j] + wi * v[j];
+            }
+        });
+    }
+
+    if (n >= 2) {
+        d_[n - 2] = a[(n - 2) * n + n - 2];
+        e_[n - 2] = a[(n - 2) * n + n - 1];
+        beta_[n - 2] = 0;
+    }
+    if (n >= 1) {
+        d_[n - 1] = a[(n - 1) * n + n - 1];
+        e_[n - 1] = 0;
+    }
+}
+
+/*!
+ * @brief Forma Qᵀ = (H_0 H_1 ... H_{n-3})ᵀ em q_, a partir dos refletores guardados em a_.
+ *
+ * Q é acumulada de trás para frente (cada refletor só altera o bloco ainda não tocado) e
+ * transposta no final, para que os autovetores fiquem nas linhas de q_.
+ */
+template <typename T>
+void Autovalores<T>::acumular_householder_()
+{
+    const size_t n = n_;
+    q_.assign(n * n, T(0));
+    for (size_t i = 0; i < n; i++)
+        q_[i * n + i] = 1;
+
+    T *q = q_.data();
+    T *u = u_.data();
+    for (size_t k = n >= 2 ? n - 2 : 0; k-- > 0;) {
+        const T beta = beta_[k];
+        if (beta == 0)
+            continue;
+        const size_t L = n - k - 1;
+        const T *v = a_.data() + k * n + k + 1;
+        T *M = q + (k + 1) * n + k + 1;
+
+        // u = vᵀ M; M ← M - β v u
+        std::fill(u, u + L, T(0));
+        for (size_t i = 0; i < L; i++) {
+            const T *mi = M + i * n;
+            const T vi = v[i];
+            for (size_t j = 0; j < L; j++)
+                u[j] += vi * mi[j];
+        }
+        paralelo::para(0, L, L, [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++) {
+                T *__restrict mi = M + i * n;
+                const T f = beta * v[i];
+                for (size_t j = 0; j < L; j++)
+                    mi[j] -= f * u[j];
+            }
+        });
+    }
+
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = i + 1; j < n; j++)
+            std::swap(q[i * n + j], q[j * n + i]);
+}
+
+/*!
+ * @brief Calcula todos os autovalores de uma matriz simétrica.
+ *
+ * Householder reduz A a uma tridiagonal e o QL implícito com deslocamento de Wilkinson
+ * calcula os autovalores dela. Só o triângulo inferior de A é lido.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Matriz simétrica n x n (ou visão).
+ * @param vetores Se true, também calcula os autovetores (ver autovetores()).
+ * @return Autovalores em ordem crescente (referência válida até a próxima chamada).
+ * @throws std::invalid_argument Se A não for quadrada.
+ * @throws std::runtime_error Se o QL não convergir.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+const std::vector<T> &Autovalores<T>::simetrica(const ConstMatrizView<T> &A, bool vetores)
+{
+    copiar_(A, true);
+    tridiagonalizar_();
+    vetores_ = vetores;
+    if (vetores)
+        acumular_householder_();
+
+    valores_.assign(d_.begin(), d_.end());
+    detail::ql_implicito(valores_.data(), e_.data(), vetores ? q_.data() : nullptr, n_);
+    iteracoes_ = 0;
+    convergiu_ = true;
+    return valores_;
+}
+
+/*!
+ * @brief Autovetores calculados pela última chamada de simetrica(A, true).
+ *
+ * @return Visão n x n cuja coluna j é o autovetor (unitário) de simetrica()[j].
+ * @throws std::logic_error Se os autovetores não foram calculados.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+ConstMatrizView<T> Autovalores<T>::autovetores() const
+{
+    if (!vetores_)
+        throw std::logic_error("Autovetores não calculados: use simetrica(A, true).");
+    return ConstMatrizView<T>(q_.data(), n_, n_, 1, n_);
+}
+
+/*!
+ * @brief Reduz a_ à forma de Hessenberg superior por refletores de Householder.
+ */
+template <typename T>
+void Autovalores<T>::hessenberg_()
+{
+    const size_t n = n_;
+    T *H = a_.data();
+    T *ort = p_.data();
+    T *f = u_.data();
+
+    for (size_t m = 1; m + 1 < n; m++) {
+        T escala = 0;
+        for (size_t i = m; i < n; i++)
+            escala += std::abs(H[i * n + m - 1]);
+        if (escala == 0)
+            continue;
+
+        T h = 0;
+        for (size_t i = m; i < n; i++) {
+            ort[i] = H[i * n + m - 1] / escala;
+            h += ort[i] * ort[i];
+        }
+        const T g = -std::copysign(std::sqrt(h), ort[m]);
+        h -= ort[m] * g;
+        ort[m] -= g;
+
+        // H ← (I - u uᵀ / h) H, nas linhas e colunas m..n-1
+        std::fill(f + m, f + n, T(0));
+        for (size_t i = m; i < n; i++) {
+            const T *hi = H + i * n;
+            for (size_t j = m; j < n; j++)
+                f[j] += ort[i] * hi[j];
+        }
+        for (size_t i = m; i < n; i++) {
+            T *__restrict hi = H + i * n;
+            const T fator = ort[i] / h;
+            for (size_t j = m; j < n; j++)
+                hi[j] -= fator * f[j];
+        }
+
+        // H ← H (I - u uᵀ / h), em todas as linhas
+        paralelo::para(0, n, 2 * (n - m), [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++) {
+                T *__restrict hi = H + i * n;
+                T soma = 0;
+                for (size_t j = m; j < n; j++)
+                    soma += ort[j] * hi[j];
+                soma /= h;
+                for (size_t j = m; j < n; j++)
+                    hi[j] -= soma * ort[j];
+            }
+        });
+
+        H[m * n + m - 1] = escala * g;
+        for (size_t i = m + 1; i < n; i++)
+            H[i * n + m - 1] = 0;
+    }
+}
+
+/*!
+ * @brief QR de Francis (duplo deslocamento implícito) sobre a Hessenberg em a_.
+ *
+ * Segue o `hqr` do EISPACK: deflaciona autovalores reais isolados e pares 2 x 2, usando os
+ * deslocamentos excepcionais após 10 e 30 iterações sem convergência. Só a janela ativa
+ * da matriz é atualizada, já que os autovetores não são calculados.
+ */
+template <typename T>
+void Autovalores<T>::qr_francis_()
+{
+    const size_t ordem = n_;
+    T *H = a_.data();
+    auto h = [&](size_t i, size_t j) -> T & { return H[i * ordem + j]; };
+    complexos_.resize(ordem);
+    if (ordem == 0)
+        return;
+
+    const T eps = std::numeric_limits<T>::epsilon();
+    T norma = 0;
+    for (size_t i = 0; i < ordem; i++)
+        for (size_t j = i > 0 ? i - 1 : 0; j < ordem; j++)
+            norma += std::abs(h(i, j));
+
+    long n = static_cast<long>(ordem) - 1;
+    T deslocamento = 0;
+    T p = 0, q = 0, r = 0, s = 0, z = 0, x = 0, y = 0, w = 0;
+    int iter = 0;
+
+    while (n >= 0) {
+        // Procura um elemento desprezível na subdiagonal
+        long l = n;
+        while (l > 0) {
+            s = std::abs(h(l - 1, l - 1)) + std::abs(h(l, l));
+            if (s == 0)
+                s = norma;
+            if (std::abs(h(l, l - 1)) < eps * s)
+                break;
+            l--;
+        }
+
+        if (l == n) { // Uma raiz real
+            complexos_[n] = std::complex<T>(h(n, n) + deslocamento, 0);
+            n--;
+            iter = 0;
+        } else if (l == n - 1) { // Duas raízes (bloco 2 x 2)
+            w = h(n, n - 1) * h(n - 1, n);
+            p = (h(n - 1, n - 1) - h(n, n)) / 2;
+            q = p * p + w;
+            z = std::sqrt(std::abs(q));
+            x = h(n, n) + deslocamento;
+            if (q >= 0) {
+                z = p >= 0 ? p + z : p - z;
+                const T primeira = x + z;
+                complexos_[n - 1] = std::complex<T>(primeira, 0);
+                complexos_[n] = std::complex<T>(z != 0 ? x - w / z : primeira, 0);
+            } else {
+                complexos_[n - 1] = std::complex<T>(x + p, z);
+                complexos_[n] = std::complex<T>(x + p, -z);
+            }
+            n -= 2;
+            iter = 0;
+        } else {
+            x = h(n, n);
+            y = h(n - 1, n - 1);
+            w = h(n, n - 1) * h(n - 1, n);
+
+            if (iter == 10) { // Deslocamento excepcional de Wilkinson
+                deslocamento += x;
+                for (long i = 0; i <= n; i++)
+                    h(i, i) -= x;
+                s = std::abs(h(n, n - 1)) + std::abs(h(n - 1, n - 2));
+                x = y = T(0.75) * s;
+                w = T(-0.4375) * s * s;
+            }
+            if (iter == 30) { // Deslocamento excepcional do MATLAB
+                s = (y - x) / 2;
+                s = s * s + w;
+                if (s > 0) {
+                    s = std::sqrt(s);
+                    if (y < x)
+                        s = -s;
+                    s = x - w / ((y - x) / 2 + s);
+                    for (long i = 0; i <= n; i++)
+                        h(i, i) -= s;
+                    deslocamento += s;
+                    x = y = w = T(0.964);
+                }
+            }
+            if (++iter > 60)
+                throw std::runtime_error("O método QR não convergiu.");
+
+            // Procura dois elementos consecutivos pequenos na subdiagonal
+            long m = n - 2;
+            while (m >= l) {
+                z = h(m, m);
+                r = x - z;
+                s = y - z;
+                p = (r * s - w) / h(m + 1, m) + h(m, m + 1);
+                q = h(m + 1, m + 1) - z - r - s;
+                r = h(m + 2, m + 1);
+                s = std::abs(p) + std::abs(q) + std::abs(r);
+                p /= s;
+                q /= s;
+                r /= s;
+                if (m == l)
+                    break;
+                if (std::abs(h(m, m - 1)) * (std::abs(q) + std::abs(r)) <
+                    eps * (std::abs(p) *
+                           (std::abs(h(m - 1, m - 1)) + std::abs(z) + std::abs(h(m + 1, m + 1)))))
+                    break;
+                m--;
+            }
+            for (long i = m + 2; i <= n; i++) {
+                h(i, i - 2) = 0;
+                if (i > m + 2)
+                    h(i, i - 3) = 0;
+            }
+
+            // Passo QR duplo nas linhas l..n e colunas m..n
+            for (long k = m; k <= n - 1; k++) {
+                const bool ultimo = k == n - 1;
+                if (k != m) {
+                    p = h(k, k - 1);
+                    q = h(k + 1, k - 1);
+                    r = ultimo ? 0 : h(k + 2, k - 1);
+                    x = std::abs(p) + std::abs(q) + std::abs(r);
+                    if (x == 0)
+                        continue;
+                    p /= x;
+                    q /= x;
+                    r /= x;
+                }
+                s = std::copysign(std::sqrt(p * p + q * q + r * r), p);
+                if (s == 0)
+                    continue;
+                if (k != m)
+                    h(k, k - 1) = -s * x;
+                else if (l != m)
+                    h(k, k - 1) = -h(k, k - 1);
+                p += s;
+                x = p / s;
+                y = q / s;
+                z = r / s;
+                q /= p;
+                r /= p;
+
+                for (long j = k; j <= n; j++) { // Linhas k..k+2
+                    p = h(k, j) + q * h(k + 1, j);
+                    if (!ultimo) {
+                        p += r * h(k + 2, j);
+                        h(k + 2, j) -= p * z;
+                    }
+                    h(k, j) -= p * x;
+                    h(k + 1, j) -= p * y;
+                }
+                for (long i = l; i <= std::min(n, k + 3); i++) { // Colunas k..k+2
+                    p = x * h(i, k) + y * h(i, k + 1);
+                    if (!ultimo) {
+                        p += z * h(i, k + 2);
+                        h(i, k + 2) -= p * r;
+                    }
+                    h(i, k) -= p;
+                    h(i, k + 1) -= p * q;
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * @brief Calcula todos os autovalores (possivelmente complexos) de uma matriz qualquer.
+ *
+ * Reduz A à forma de Hessenberg superior e aplica o QR de Francis com duplo deslocamento,
+ * que trata pares complexos conjugados em aritmética real.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Matriz n x n (ou visão).
+ * @return Autovalores ordenados pela parte real e depois pela imaginária.
+ * @throws std::invalid_argument Se A não for quadrada.
+ * @throws std::runtime_error Se o QR não convergir.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+const std::vector<std::complex<T>> &Autovalores<T>::geral(const ConstMatrizView<T> &A)
+{
+    copiar_(A, false);
+    hessenberg_();
+    qr_francis_();
+    std::sort(complexos_.begin(), complexos_.end(),
+              [](const std::complex<T> &x, const std::complex<T> &y) {
+                  return x.real() < y.real() || (x.real() == y.real() && x.imag() < y.imag());
+              });
+    iteracoes_ = 0;
+    convergiu_ = true;
+    return complexos_;
+}
+
+/*!
+ * @brief y = A x, com as linhas divididas entre as threads.
+ */
+template <typename T>
+void Autovalores<T>::multiplicar_(const ConstMatrizView<T> &A, const T *x, T *y) const
+{
+    const size_t n = A.linhas();
+    const T *dados = A.data();
+    const size_t pl = A.passo_linha();
+    const size_t pc = A.passo_coluna();
+    paralelo::para(0, n, n, [&](size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++) {
+            const T *linha = dados + i * pl;
+            T soma = 0;
+            if (pc == 1)
+                for (size_t j = 0; j < n; j++)
+                    soma += linha[j] * x[j];
+            else
+                for (size_t j = 0; j < n; j++)
+                    soma += linha[j * pc] * x[j];
+            y[i] = soma;
+        }
+    });
+}
+
+/*!
+ * @brief Lanczos com reortogonalização completa e reinício implícito para os k maiores
+ *        autovalores.
+ *
+ * A cada 5 passos (a partir do k-ésimo) calcula os valores de Ritz da tridiagonal e para
+ * quando o resíduo β_m |s_m| de cada um dos k maiores é menor que tolerancia * |θ|. Se a
+ * base se esgota antes disso, ela é reduzida a l = k + (m - k) / 2 vetores pelo reinício
+ * implícito de Sorensen: m - l passos de QR na tridiagonal, deslocados pelos valores de
+ * Ritz indesejados, cujas rotações são aplicadas também à base. A fatoração de Lanczos de
+ * ordem l que sobra continua tridiagonal, e os passos seguintes partem dela.
+ */
+template <typename T>
+template <typename F>
+const std::vector<T> &Autovalores<T>::lanczos_(size_t n, const F &aplicar, size_t k,
+                                               double tolerancia, size_t dimensao)
+{
+    if (k == 0 || k > n)
+        throw std::invalid_argument("Número de autovalores pedido inválido.");
+    // Só os vetores de tamanho n: a cópia n x n de a_ não é usada aqui.
+    n_ = n;
+    u_.resize(n);
+    p_.resize(n);
+    beta_.resize(n);
+
+    const size_t m_max = dimensao ? std::min(n, std::max(dimensao, k))
+                                  : std::min(n, 2 * k + 20);
+    const size_t l = k + (m_max - k) / 2;
+    if (base_.size() < n * (m_max + 1))
+        base_.resize(n * (m_max + 1));
+    if (ritz_.size() < m_max * m_max)
+        ritz_.resize(m_max * m_max);
+    d_.resize(std::max(n, m_max));
+    e_.resize(std::max(n, m_max));
+
+    T *alfa = d_.data();
+    T *beta = e_.data();
+    T *V = base_.data();
+    detail::vetor_inicial(V, n, std::vector<T>{});
+
+    // Gram-Schmidt clássico repetido duas vezes contra os vetores 0..j da base
+    auto ortogonalizar = [&](T *w, size_t j) {
+        for (int passada = 0; passada < 2; passada++) {
+            for (size_t i = 0; i <= j; i++) {
+                const T *vi = V + i * n;
+                const T c = detail::produto_interno(w, vi, n);
+                paralelo::para(0, n, 1, [&](size_t inicio, size_t fim) {
+                    for (size_t t = inicio; t < fim; t++)
+                        w[t] -= c * vi[t];
+                });
+            }
+        }
+    };
+
+    const T eps = std::numeric_limits<T>::epsilon();
+    T escala = 0;
+    int produtos = 0;
+    auto concluir = [&](const T *theta, size_t m, bool convergiu) -> const std::vector<T> & {
+        valores_.resize(k);
+        for (size_t i = 0; i < k; i++)
+            valores_[i] = theta[m - 1 - i];
+        iteracoes_ = produtos;
+        convergiu_ = convergiu;
+        vetores_ = false;
+        return valores_;
+    };
+    int reinicios = 0;
+    for (size_t j = 0; j < m_max; j++) {
+        const T *vj = V + j * n;
+        T *w = V + (j + 1) * n;
+        aplicar(vj, w);
+        produtos++;
+
+        alfa[j] = detail::produto_interno(w, vj, n);
+        const T bant = j > 0 ? beta[j - 1] : T(0);
+        const T *vant = j > 0 ? V + (j - 1) * n : vj;
+        paralelo::para(0, n, 2, [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++)
+                w[i] -= alfa[j] * vj[i] + bant * vant[i];
+        });
+        ortogonalizar(w, j);
+
+        beta[j] = std::sqrt(detail::produto_interno(w, w, n));
+        escala = std::max(escala, std::abs(alfa[j]) + beta[j]);
+        const size_t m = j + 1;
+        const bool invariante = beta[j] <= eps * escala * T(n);
+
+        if (m >= k && (m % 5 == 0 || invariante || m == m_max)) {
+            // Valores de Ritz: autovalores da tridiagonal m x m (em p_ e beta_ como rascunho)
+            T *theta = p_.data();
+            T *sub = beta_.data();
+            std::copy(alfa, alfa + m, theta);
+            std::copy(beta, beta + m, sub);
+            T *s = ritz_.data();
+            std::fill(s, s + m * m, T(0));
+            for (size_t i = 0; i < m; i++)
+                s[i * m + i] = 1;
+            detail::ql_implicito(theta, sub, s, m);
+
+            bool convergiu = true;
+            for (size_t i = m - k; i < m; i++)
+                if (beta[j] * std::abs(s[i * m + m - 1]) >
+                    tolerancia * std::max(std::abs(theta[i]), eps))
+                    convergiu = false;
+
+            if (convergiu || invariante ||
+                (m == m_max && (l == m_max || reinicios == detail::REINICIOS_LANCZOS)))
+                return concluir(theta, m, convergiu || invariante);
+
+            if (m == m_max) {
+                // H = tridiagonal densa (em ritz_); ultima = última linha de Q (em beta_)
+                T *H = ritz_.data();
+                T *ultima = beta_.data();
+                std::fill(H, H + m * m, T(0));
+                std::fill(ultima, ultima + m, T(0));
+                ultima[m - 1] = 1;
+                for (size_t i = 0; i < m; i++) {
+                    H[i * m + i] = alfa[i];
+                    if (i + 1 < m)
+                        H[i * m + i + 1] = H[(i + 1) * m + i] = beta[i];
+                }
+
+                for (size_t r = 0; r < m - l; r++) {
+                    // Passo de QR implícito deslocado por theta[r], perseguindo a protuberância
+                    T x = H[0] - theta[r];
+                    T z = H[m];
+                    for (size_t q = 0; q + 1 < m; q++) {
+                        const T raio = std::hypot(x, z);
+                        const T c = raio == 0 ? T(1) : x / raio;
+                        const T sn = raio == 0 ? T(0) : z / raio;
+                        T *hq = H + q * m;
+                        T *hq1 = H + (q + 1) * m;
+                        for (size_t t = 0; t < m; t++) {
+                            const T a = hq[t], b = hq1[t];
+                            hq[t] = c * a + sn * b;
+                            hq1[t] = c * b - sn * a;
+                        }
+                        for (size_t t = 0; t < m; t++) {
+                            const T a = H[t * m + q], b = H[t * m + q + 1];
+                            H[t * m + q] = c * a + sn * b;
+                            H[t * m + q + 1] = c * b - sn * a;
+                        }
+                        T *vq = V + q * n;
+                        T *vq1 = V + (q + 1) * n;
+                        paralelo::para(0, n, 6, [&](size_t inicio, size_t fim) {
+                            for (size_t t = inicio; t < fim; t++) {
+                                const T a = vq[t], b = vq1[t];
+                                vq[t] = c * a + sn * b;
+                                vq1[t] = c * b - sn * a;
+                            }
+                        });
+                        const T a = ultima[q], b = ultima[q + 1];
+                        ultima[q] = c * a + sn * b;
+                        ultima[q + 1] = c * b - sn * a;
+                        if (q + 2 < m) {
+                            x = hq1[q];
+                            z = H[(q + 2) * m + q];
+                        }
+                    }
+                }
+
+                // Novo resíduo: β̂_l v̂_l + β_m Q[m - 1, l - 1] v_m (w guarda β_m v_m)
+                T *vl = V + l * n;
+                const T bl = H[l * m + l - 1];
+                const T fator = ultima[l - 1];
+                paralelo::para(0, n, 2, [&](size_t inicio, size_t fim) {
+                    for (size_t t = inicio; t < fim; t++)
+                        vl[t] = bl * vl[t] + fator * w[t];
+                });
+                ortogonalizar(vl, l - 1);
+                for (size_t i = 0; i < l; i++) {
+                    alfa[i] = H[i * m + i];
+                    beta[i] = i + 1 < l ? H[(i + 1) * m + i] : T(0);
+                }
+                beta[l - 1] = std::sqrt(detail::produto_interno(vl, vl, n));
+                if (beta[l - 1] <= eps * escala * T(n))
+                    return concluir(theta, m, true); // os l vetores mantidos são invariantes
+                for (size_t t = 0; t < n; t++)
+                    vl[t] /= beta[l - 1];
+                reinicios++;
+                j = l - 1; // o próximo passo estende a base a partir do vetor l
+                continue;
+            }
+        }
+
+        for (size_t i = 0; i < n; i++)
+            w[i] /= beta[j];
+    }
+    return valores_; // inalcançável: m == m_max retorna ou reinicia acima
+}
+
+/*!
+ * @brief Calcula os k maiores autovalores de uma matriz simétrica densa pelo método de Lanczos.
+ *
+ * Constrói uma base de Krylov de dimensão até m (reortogonalizada) e usa os valores de Ritz.
+ * Se a tolerância não é atingida com m vetores, a base é reiniciada implicitamente,
+ * mantendo cerca de (m + k) / 2 direções, até convergir ou até detail::REINICIOS_LANCZOS
+ * reinícios. Para k pequeno, custa algumas vezes m produtos matriz-vetor em vez da redução
+ * completa O(n³). iteracoes() devolve o total de produtos e convergiu() diz se a tolerância
+ * foi atingida.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Matriz simétrica n x n.
+ * @param k Quantidade de autovalores (1 <= k <= n).
+ * @param tolerancia Resíduo relativo de Ritz aceitável.
+ * @param dimensao Dimensão máxima da base (0: 2k + 20, limitada a n). A memória usada é
+ *                 n * (dimensao + 1) elementos.
+ * @return Os k maiores autovalores, em ordem decrescente.
+ * @throws std::invalid_argument Se A não for quadrada ou k for inválido.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+const std::vector<T> &Autovalores<T>::maiores(const ConstMatrizView<T> &A, size_t k,
+                                              double tolerancia, size_t dimensao)
+{
+    if (A.linhas() != A.colunas())
+        throw std::invalid_argument("Matriz não é quadrada.");
+    return lanczos_(A.linhas(), [&](const T *x, T *y) { multiplicar_(A, x, y); }, k, tolerancia,
+                    dimensao);
+}
+
+/*!
+ * @brief Versão de maiores() para matrizes esparsas (só usa o produto por vetor).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+const std::vector<T> &Autovalores<T>::maiores(const MatrizEsparsa<T> &A, size_t k,
+                                              double tolerancia, size_t dimensao)
+{
+    if (A.linhas() != A.colunas())
+        throw std::invalid_argument("Matriz não é quadrada.");
+    return lanczos_(A.linhas(), [&](const T *x, T *y) { A.multiplicar(x, y); }, k, tolerancia,
+                    dimensao);
+}
+
+/*!
+ * @brief Método da potência com deslocamento, sem alocações.
+ *
+ * Itera v ← (A - σI) v / ||(A - σI) v|| e estima o autovalor pelo quociente de Rayleigh
+ * vᵀ A v. Converge para o autovalor mais distante de σ; com σ = 0, o dominante.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Matriz n x n.
+ * @param tolerancia Variação máxima da estimativa entre duas iterações.
+ * @param r Número máximo de iterações.
+ * @param deslocamento σ.
+ * @param x0 Vetor inicial (vazio: vetor determinístico).
+ * @return Autovalor estimado; o autovetor fica em vetor().
+ * @throws std::invalid_argument Se A não for quadrada ou x0 for inválido.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T Autovalores<T>::potencia(const ConstMatrizView<T> &A, double tolerancia, int r,
+                           T deslocamento, const std::vector<T> &x0)
+{
+    if (A.linhas() != A.colunas())
+        throw std::invalid_argument("Matriz não é quadrada.");
+    reservar_(A.linhas());
+    const size_t n = n_;
+    T *v = u_.data();
+    T *y = p_.data();
+    detail::vetor_inicial(v, n, x0);
+
+    T lambda = std::numeric_limits<T>::infinity();
+    convergiu_ = false;
+    for (iteracoes_ = 0; iteracoes_ < r && !convergiu_;) {
+        multiplicar_(A, v, y);
+        const T rayleigh = detail::produto_interno(v, y, n);
+        for (size_t i = 0; i < n; i++)
+            y[i] -= deslocamento * v[i];
+        const T modulo = std::sqrt(detail::produto_interno(y, y, n));
+        iteracoes_++;
+
+        convergiu_ = std::abs(rayleigh - lambda) <= tolerancia;
+        lambda = rayleigh;
+        if (modulo == 0) { // v já é autovetor de autovalor σ
+            convergiu_ = true;
+            break;
+        }
+        for (size_t i = 0; i < n; i++)
+            v[i] = y[i] / modulo;
+    }
+    return lambda;
+}
+
+/*!
+ * @brief Iteração inversa com deslocamento: autovalor de A mais próximo de σ.
+ *
+ * Fatora A - σI uma vez (LU com pivotamento parcial, reaproveitando a memória) e itera
+ * v ← (A - σI)⁻¹ v normalizado. Se μ = vᵀ (A - σI)⁻¹ v, o autovalor é σ + 1 / μ.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Matriz n x n.
+ * @param deslocamento σ (não pode ser exatamente um autovalor).
+ * @param tolerancia Variação máxima da estimativa entre duas iterações.
+ * @param r Número máximo de iterações.
+ * @param x0 Vetor inicial (vazio: vetor determinístico).
+ * @return Autovalor estimado; o autovetor fica em vetor().
+ * @throws std::invalid_argument Se A não for quadrada ou x0 for inválido.
+ * @throws std::runtime_error Se A - σI for singular.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T Autovalores<T>::inversa(const ConstMatrizView<T> &A, T deslocamento, double tolerancia, int r,
+                          const std::vector<T> &x0)
+{
+    if (A.linhas() != A.colunas())
+        throw std::invalid_argument("Matriz não é quadrada.");
+    reservar_(A.linhas());
+    const size_t n = n_;
+
+    deslocada_.resize(n * n);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++)
+            deslocada_[i * n + j] = A.elemento(i, j);
+        deslocada_[i * n + i] -= deslocamento;
+    }
+    const ConstMatrizView<T> B(deslocada_.data(), n, n, n);
+    if (lu_)
+        lu_->fatorar(B);
+    else
+        lu_.emplace(B);
+
+    T *v = u_.data();
+    T *y = p_.data();
+    detail::vetor_inicial(v, n, x0);
+
+    T lambda = std::numeric_limits<T>::infinity();
+    convergiu_ = false;
+    for (iteracoes_ = 0; iteracoes_ < r && !convergiu_;) {
+        lu_->resolver(v, y);
+        const T mu = detail::produto_interno(v, y, n);
+        const T modulo = std::sqrt(detail::produto_interno(y, y, n));
+        iteracoes_++;
+
+        const T estimativa = deslocamento + 1 / mu;
+        convergiu_ = std::abs(estimativa - lambda) <= tolerancia;
+        lambda = estimativa;
+        for (size_t i = 0; i < n; i++)
+            v[i] = y[i] / modulo;
+    }
+    return lambda;
+}
+
+/*!
+ * @brief Autovetor (unitário) da última chamada de potencia() ou inversa().
+ */
+template <typename T>
+const std::vector<T> &Autovalores<T>::vetor() const
+{
+    return u_;
+}
+
+/*!
+ * @brief Iterações da última chamada (passos de Lanczos, para maiores()).
+ */
+template <typename T>
+int Autovalores<T>::iteracoes() const
+{
+    return iteracoes_;
+}
+
+/*!
+ * @brief Se a última chamada atingiu a tolerância.
+ */
+template <typename T>
+bool Autovalores<T>::convergiu() const
+{
+    return convergiu_;
+}
+
+} // namespace ifnum
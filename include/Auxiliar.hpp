@@ -4,6 +4,7 @@
  */
 
 #pragma once
+#include "Aleatorio.hpp"
 #include "Matriz.hpp"
 #include <chrono>
 #include <iostream>
@@ -44,9 +45,11 @@ class Timer
 namespace ifnum::rng
 {
 
-inline extern std::mt19937 mt;
+extern std::mt19937 mt;
 
 template <typename T>
 ifnum::Matriz<T> matriz_aleatoria(size_t linhas, size_t colunas, T min, T max);
 
-} // namespace ifnum::rng
\ No newline at end of file
+} // namespace ifnum::rng
+
+#include "Auxiliar.tpp"
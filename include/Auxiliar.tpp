@@ -36,8 +36,9 @@ namespace ifnum::rng
 /*!
  * @brief Gera uma matriz aleatória de valores numéricos.
  *
- * Gera uma matriz com os valores distribuídos uniformemente no intervalo [min, max],
- * usando distribuição inteira ou contínua, dependendo do tipo T.
+ * Gera uma matriz com os valores distribuídos uniformemente no intervalo [min, max),
+ * ou [min, max] se T for inteiro. Cada chamada usa um fluxo novo do Philox com a semente
+ * global (ver rng::semear), e o preenchimento é paralelo, direto no buffer da matriz.
  *
  * @tparam T Tipo numérico dos elementos (int, float, double...).
  * @param linhas Número de linhas da matriz.
@@ -55,21 +56,8 @@ ifnum::Matriz<T> matriz_aleatoria(size_t linhas, size_t colunas, T min, T max)
 {
     static_assert(std::is_arithmetic<T>::value, "T deve ser um tipo numérico.");
 
-    std::vector<T> vetor(linhas * colunas);
-    if constexpr (std::is_integral<T>::value) {
-        // Se T é tipo inteiro
-        std::uniform_int_distribution<T> dist(min, max);
-        for (size_t i = 0; i < linhas * colunas; i++)
-            vetor[i] = dist(rng::mt);
-
-    } else if constexpr (std::is_floating_point<T>::value) {
-        // Se T for ponto flutuante
-        std::uniform_real_distribution<T> dist(min, max);
-        for (size_t i = 0; i < linhas * colunas; i++)
-            vetor[i] = dist(rng::mt);
-    }
-
-    return Matriz<T>(linhas, colunas, vetor);
+    Philox gerador(semente(), detail::proximo_fluxo());
+    return matriz_aleatoria(linhas, colunas, min, max, gerador);
 }
 
 } // namespace ifnum::rng
\ No newline at end of file
@@ -0,0 +1,65 @@
+/*!
+ * @file Blas1.hpp
+ * @brief Operações de nível 1 (vetor-vetor) no estilo BLAS: dot, nrm2, asum, iamax, axpy e scal.
+ *
+ * Para `float` e `double` com elementos contíguos, a partir de 16 elementos, as operações
+ * usam os kernels de Blas1.cpp, com variantes SSE2, AVX2 e AVX-512 escolhidas em tempo de
+ * execução (ver Cpu.hpp). As reduções (dot, nrm2, asum) somam em várias faixas independentes
+ * e combinam as somas parciais aos pares, com erro proporcional a log(n) em vez de n. Outros
+ * tipos, vetores com passo e vetores curtos usam laços simples, expandidos no chamador, com a
+ * mesma soma aos pares entre folhas de 512 elementos.
+ *
+ * Os ponteiros são crus para servir a Vetor, às colunas de Matriz e a buffers externos. O
+ * passo (`inc`) é a distância, em elementos, entre dois elementos consecutivos.
+ */
+
+#pragma once
+#include "Instrumentacao.hpp"
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace ifnum::detail
+{
+float dot(size_t n, const float *x, const float *y);
+double dot(size_t n, const double *x, const double *y);
+float nrm2(size_t n, const float *x);
+double nrm2(size_t n, const double *x);
+float asum(size_t n, const float *x);
+double asum(size_t n, const double *x);
+size_t iamax(size_t n, const float *x);
+size_t iamax(size_t n, const double *x);
+void axpy(size_t n, float alfa, const float *x, float *y);
+void axpy(size_t n, double alfa, const double *x, double *y);
+void scal(size_t n, float alfa, float *x);
+void scal(size_t n, double alfa, double *x);
+} // namespace ifnum::detail
+
+namespace ifnum::blas
+{
+template <typename T>
+T dot(size_t n, const T *x, const T *y);
+template <typename T>
+T dot(size_t n, const T *x, size_t incx, const T *y, size_t incy);
+
+template <typename T>
+T nrm2(size_t n, const T *x, size_t incx = 1);
+
+template <typename T>
+T asum(size_t n, const T *x, size_t incx = 1);
+
+template <typename T>
+size_t iamax(size_t n, const T *x, size_t incx = 1);
+
+template <typename T>
+void axpy(size_t n, T alfa, const T *x, T *y);
+template <typename T>
+void axpy(size_t n, T alfa, const T *x, size_t incx, T *y, size_t incy);
+
+template <typename T>
+void scal(size_t n, T alfa, T *x, size_t incx = 1);
+
+} // namespace ifnum::blas
+
+#include "Blas1.tpp"
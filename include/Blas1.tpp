@@ -0,0 +1,269 @@
+/*!
+ * @file Blas1.tpp
+ * @brief Soma aos pares e versões genéricas (qualquer tipo, com passo) das operações de Blas1.hpp.
+ */
+
+#ifdef __INTELLISENSE__
+#include "Blas1.hpp"
+#endif
+
+namespace ifnum::detail
+{
+/*! @brief Elementos somados em sequência (por faixa, nos kernels) antes da soma aos pares. */
+inline constexpr size_t FOLHA_BLAS1 = 512;
+
+/*!
+ * @brief Menor n contíguo enviado aos kernels de Blas1.cpp.
+ *
+ * Abaixo disso, a chamada indireta e a redução das faixas custam mais que a conta (dot de 3
+ * `double` leva de 30 a 45 ns pelo kernel e 6 ns pelo laço simples), e as funções de
+ * ifnum::blas usam o laço genérico, expandido no chamador.
+ */
+inline constexpr size_t MINIMO_KERNEL_BLAS1 = 16;
+
+template <typename T>
+inline constexpr bool tem_kernel_blas1 = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+/*!
+ * @brief Soma aos pares das somas parciais de folhas de FOLHA_BLAS1 elementos.
+ *
+ * Em vez de recursão, mantém uma pilha de somas como um contador binário: ao terminar a
+ * folha c, as (número de bits 1 finais de c) somas do topo, que cobrem o mesmo número de
+ * folhas, são combinadas com ela. O resultado é o da soma aos pares em árvore, em uma
+ * única passada.
+ *
+ * @param n Número de elementos.
+ * @param folha Chamável `(inicio, quantidade)` que soma uma folha.
+ */
+template <typename T, typename Folha>
+[[gnu::always_inline]] inline T somar_pareado(size_t n, const Folha &folha)
+{
+    if (n <= FOLHA_BLAS1)
+        return folha(0, n);
+
+    T pilha[64];
+    size_t topo = 0;
+    for (size_t inicio = 0, c = 0; inicio < n; inicio += FOLHA_BLAS1, c++) {
+        T soma = folha(inicio, n - inicio < FOLHA_BLAS1 ? n - inicio : FOLHA_BLAS1);
+        for (size_t k = c; k & 1; k >>= 1)
+            soma = pilha[--topo] + soma;
+        pilha[topo++] = soma;
+    }
+
+    T total = T(0);
+    while (topo > 0)
+        total = pilha[--topo] + total;
+    return total;
+}
+
+/*!
+ * @brief Indica se uma soma de quadrados pode ser usada direto na norma euclidiana.
+ *
+ * Fora de [min / épsilon, max], os quadrados perderam precisão por underflow ou a soma
+ * transbordou, e a norma deve ser refeita com os elementos divididos pelo maior módulo.
+ * NaN é aceito (a norma também é NaN).
+ */
+template <typename T>
+inline bool soma_quadrados_confiavel(T soma)
+{
+    constexpr T menor = std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon();
+    return std::isnan(soma) || (soma >= menor && soma <= std::numeric_limits<T>::max());
+}
+} // namespace ifnum::detail
+
+namespace ifnum::blas
+{
+/*!
+ * @brief Produto interno xᵀy de dois vetores contíguos.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param n Número de elementos.
+ * @return Soma de x[i] * y[i] (zero se n = 0).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T dot(size_t n, const T *x, const T *y)
+{
+    return dot(n, x, size_t(1), y, size_t(1));
+}
+
+/*!
+ * @brief Produto interno xᵀy com passos (ex.: duas colunas de uma Matriz).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T dot(size_t n, const T *x, size_t incx, const T *y, size_t incy)
+{
+    IFNUM_FLOPS(2 * n);
+    IFNUM_BYTES(2 * n * sizeof(T));
+    if constexpr (detail::tem_kernel_blas1<T>) {
+        if (incx == 1 && incy == 1 && n >= detail::MINIMO_KERNEL_BLAS1)
+            return detail::dot(n, x, y);
+    }
+    return detail::somar_pareado<T>(n, [&](size_t inicio, size_t quantidade) {
+        T soma = T(0);
+        for (size_t i = inicio; i < inicio + quantidade; i++)
+            soma += x[i * incx] * y[i * incy];
+        return soma;
+    });
+}
+
+/*!
+ * @brief Norma euclidiana ||x||₂, sem overflow para elementos grandes nem perda por underflow
+ *        para elementos pequenos.
+ *
+ * A soma é feita no próprio tipo T.
+ *
+ * @tparam T Tipo de ponto flutuante.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T nrm2(size_t n, const T *x, size_t incx)
+{
+    static_assert(std::is_floating_point_v<T>, "nrm2 só está disponível para ponto flutuante.");
+    IFNUM_FLOPS(2 * n);
+    IFNUM_BYTES(n * sizeof(T));
+    if constexpr (detail::tem_kernel_blas1<T>) {
+        if (incx == 1 && n >= detail::MINIMO_KERNEL_BLAS1)
+            return detail::nrm2(n, x);
+    }
+
+    auto somar = [&](T escala) {
+        return detail::somar_pareado<T>(n, [&](size_t inicio, size_t quantidade) {
+            T soma = T(0);
+            for (size_t i = inicio; i < inicio + quantidade; i++) {
+                const T u = x[i * incx] / escala;
+                soma += u * u;
+            }
+            return soma;
+        });
+    };
+
+    const T soma = somar(T(1));
+    if (n == 0 || detail::soma_quadrados_confiavel(soma))
+        return std::sqrt(soma);
+    const T escala = std::abs(x[iamax(n, x, incx) * incx]);
+    if (escala == T(0) || std::isinf(escala))
+        return escala;
+    return escala * std::sqrt(somar(escala));
+}
+
+/*!
+ * @brief Soma dos módulos, Σ |x[i]|.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T asum(size_t n, const T *x, size_t incx)
+{
+    IFNUM_FLOPS(n);
+    IFNUM_BYTES(n * sizeof(T));
+    if constexpr (detail::tem_kernel_blas1<T>) {
+        if (incx == 1 && n >= detail::MINIMO_KERNEL_BLAS1)
+            return detail::asum(n, x);
+    }
+    return detail::somar_pareado<T>(n, [&](size_t inicio, size_t quantidade) {
+        T soma = T(0);
+        for (size_t i = inicio; i < inicio + quantidade; i++)
+            soma += x[i * incx] < T(0) ? -x[i * incx] : x[i * incx];
+        return soma;
+    });
+}
+
+/*!
+ * @brief Índice (a partir de 0) do primeiro elemento de maior módulo.
+ *
+ * Elementos NaN são ignorados.
+ *
+ * @return Índice do maior |x[i]|, ou 0 se n = 0 ou se todos forem NaN.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+size_t iamax(size_t n, const T *x, size_t incx)
+{
+    IFNUM_BYTES(n * sizeof(T));
+    if constexpr (detail::tem_kernel_blas1<T>) {
+        if (incx == 1 && n >= detail::MINIMO_KERNEL_BLAS1)
+            return detail::iamax(n, x);
+    }
+
+    size_t indice = 0;
+    bool achou = false;
+    T maior = T(0);
+    for (size_t i = 0; i < n; i++) {
+        const T v = x[i * incx] < T(0) ? -x[i * incx] : x[i * incx];
+        if (!achou ? v == v : v > maior) {
+            maior = v;
+            indice = i;
+            achou = true;
+        }
+    }
+    return indice;
+}
+
+/*!
+ * @brief y += alfa * x, no lugar, para vetores contíguos.
+ *
+ * x e y podem ser o mesmo vetor, mas não podem se sobrepor parcialmente.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void axpy(size_t n, T alfa, const T *x, T *y)
+{
+    axpy(n, alfa, x, size_t(1), y, size_t(1));
+}
+
+/*!
+ * @brief y += alfa * x com passos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void axpy(size_t n, T alfa, const T *x, size_t incx, T *y, size_t incy)
+{
+    IFNUM_FLOPS(2 * n);
+    IFNUM_BYTES(3 * n * sizeof(T));
+    if constexpr (detail::tem_kernel_blas1<T>) {
+        if (incx == 1 && incy == 1 && n >= detail::MINIMO_KERNEL_BLAS1) {
+            detail::axpy(n, alfa, x, y);
+            return;
+        }
+    }
+    for (size_t i = 0; i < n; i++)
+        y[i * incy] += alfa * x[i * incx];
+}
+
+/*!
+ * @brief x *= alfa, no lugar.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void scal(size_t n, T alfa, T *x, size_t incx)
+{
+    IFNUM_FLOPS(n);
+    IFNUM_BYTES(2 * n * sizeof(T));
+    if constexpr (detail::tem_kernel_blas1<T>) {
+        if (incx == 1 && n >= detail::MINIMO_KERNEL_BLAS1) {
+            detail::scal(n, alfa, x);
+            return;
+        }
+    }
+    for (size_t i = 0; i < n; i++)
+        x[i * incx] *= alfa;
+}
+
+} // namespace ifnum::blas
@@ -0,0 +1,135 @@
+/*!
+ * @file Cholesky.hpp
+ * @brief Declaração das classes template Cholesky e LDLT (fatorações de matrizes simétricas).
+ *
+ * Para matrizes simétricas, as fatorações usam só o triângulo inferior de A e fazem metade
+ * das operações da LU. Como em LU.hpp, a fatoração é feita uma única vez e resolve qualquer
+ * quantidade de lados direitos em O(n²) cada.
+ */
+
+#pragma once
+#include "Matriz.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace ifnum
+{
+namespace detail
+{
+template <typename T, typename Resolver, typename ResolverTransposta>
+T estimar_norma1_inversa(size_t n, Resolver resolver, ResolverTransposta resolver_transposta);
+} // namespace detail
+
+/*!
+ * @brief Fatoração de Cholesky A = L * Lᵀ, para matrizes simétricas definidas positivas.
+ *
+ * Só o triângulo inferior de A é lido. A fatoração é blocada e "right-looking", como a LU:
+ * cada painel de colunas é fatorado e o triângulo restante é atualizado com o kernel GEMM.
+ * Se A não for definida positiva (um pivô não positivo), a fatoração para e a matriz é
+ * marcada (ver definida_positiva()); `resolver` lança exceção. Isso torna a fatoração um
+ * teste barato de positividade.
+ *
+ * @tparam T Tipo dos elementos (ponto flutuante).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+class Cholesky
+{
+  private:
+    size_t n_ = 0;
+    std::vector<T, AlocadorArena<T>> l_;
+    std::vector<T, AlocadorArena<T>> trabalho_;
+    T norma1_ = T(0);
+    bool definida_positiva_ = true;
+
+    static constexpr size_t bloco_ = 64;
+
+    bool fatorar_painel_(size_t k0, size_t kb);
+
+  public:
+    explicit Cholesky(const Matriz<T> &A);
+    explicit Cholesky(const ConstMatrizView<T> &A);
+    Cholesky(const ConstMatrizView<T> &A, Arena &area);
+
+    void fatorar(const Matriz<T> &A);
+    void fatorar(const ConstMatrizView<T> &A);
+
+    size_t ordem() const;
+    bool definida_positiva() const;
+
+    Matriz<T> L() const;
+    T determinante() const;
+    T log_determinante() const;
+    T condicao() const;
+
+    Matriz<T> resolver(const Matriz<T> &b) const;
+    Matriz<T> resolver(const ConstMatrizView<T> &b) const;
+    void resolver(const ConstMatrizView<T> &b, const MatrizView<T> &x) const;
+    void resolver(const T *b, T *x) const;
+};
+
+/*!
+ * @brief Inércia de uma matriz simétrica: quantos autovalores são positivos, negativos e nulos.
+ */
+struct Inercia {
+    size_t positivos = 0;
+    size_t negativos = 0;
+    size_t nulos = 0;
+};
+
+/*!
+ * @brief Fatoração A = L * D * Lᵀ de matrizes simétricas, com L unitária e D diagonal.
+ *
+ * Não usa raízes quadradas e aceita matrizes indefinidas, desde que os menores principais
+ * sejam não singulares: não há pivotamento, então um pivô nulo interrompe a fatoração (ver
+ * singular()) e pivôs pequenos amplificam erros. Para matrizes indefinidas quaisquer, use a
+ * LU. Pela lei da inércia de Sylvester, os sinais de D dão a inércia de A.
+ *
+ * @tparam T Tipo dos elementos (ponto flutuante).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+class LDLT
+{
+  private:
+    size_t n_ = 0;
+    std::vector<T, AlocadorArena<T>> l_;
+    std::vector<T, AlocadorArena<T>> trabalho_;
+    T norma1_ = T(0);
+    bool singular_ = false;
+
+    static constexpr size_t bloco_ = 64;
+
+    bool fatorar_painel_(size_t k0, size_t kb);
+
+  public:
+    explicit LDLT(const Matriz<T> &A);
+    explicit LDLT(const ConstMatrizView<T> &A);
+    LDLT(const ConstMatrizView<T> &A, Arena &area);
+
+    void fatorar(const Matriz<T> &A);
+    void fatorar(const ConstMatrizView<T> &A);
+
+    size_t ordem() const;
+    bool singular() const;
+    Inercia inercia() const;
+
+    Matriz<T> L() const;
+    Matriz<T> D() const;
+    T determinante() const;
+    T condicao() const;
+
+    Matriz<T> resolver(const Matriz<T> &b) const;
+    Matriz<T> resolver(const ConstMatrizView<T> &b) const;
+    void resolver(const ConstMatrizView<T> &b, const MatrizView<T> &x) const;
+    void resolver(const T *b, T *x) const;
+};
+
+} // namespace ifnum
+
+#include "Cholesky.tpp"
@@ -0,0 +1,988 @@
+/*!
+ * @file Cholesky.tpp
+ * @brief Implementação das classes template Cholesky e LDLT declaradas em Cholesky.hpp.
+ */
+
+#ifdef __INTELLISENSE__
+#include "Cholesky.hpp"
+#endif
+
+namespace ifnum
+{
+namespace detail
+{
+/*!
+ * @brief Copia o triângulo inferior de A para `a` (n x n, por linhas), zerando o superior.
+ *
+ * @return Norma 1 da matriz simétrica representada pelo triângulo inferior.
+ */
+template <typename T>
+T copiar_triangulo_inferior(const ConstMatrizView<T> &A, T *a)
+{
+    const size_t n = A.linhas();
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j <= i; j++)
+            a[i * n + j] = A.elemento(i, j);
+        for (size_t j = i + 1; j < n; j++)
+            a[i * n + j] = T(0);
+    }
+
+    // Coluna j da matriz simétrica = linha j até a diagonal + coluna j abaixo dela
+    T norma = T(0);
+    for (size_t j = 0; j < n; j++) {
+        T soma = T(0);
+        for (size_t k = 0; k <= j; k++)
+            soma += std::abs(a[j * n + k]);
+        for (size_t i = j + 1; i < n; i++)
+            soma += std::abs(a[i * n + j]);
+        norma = std::max(norma, soma);
+    }
+    return norma;
+}
+
+/*!
+ * @brief A22 -= L21 * W no triângulo inferior de A22, com W (kb x resto) já montada.
+ *
+ * A22 é percorrida em faixas de linhas; cada faixa vai só até a sua última coluna do
+ * triângulo, e o GEMM escreve alguns elementos acima da diagonal, que não são lidos.
+ */
+template <typename T>
+void atualizar_triangulo_inferior(T *a, size_t n, size_t k0, size_t kb, const T *W, size_t faixa)
+{
+    const size_t k1 = k0 + kb;
+    const size_t resto = n - k1;
+    for (size_t r0 = k1; r0 < n; r0 += faixa) {
+        const size_t r1 = std::min(r0 + faixa, n);
+        gemm(r1 - r0, r1 - k1, kb, T(-1), a + r0 * n + k0, n, W, resto, T(1), a + r0 * n + k1,
+             n);
+    }
+}
+
+/*!
+ * @brief Estima ||A⁻¹||₁ a partir de resoluções com A e com Aᵀ (método de Hager e Higham).
+ *
+ * Faz no máximo 5 pares de resoluções, em O(n²) cada, em vez das n resoluções necessárias
+ * para calcular A⁻¹. A estimativa é um limite inferior e, na prática, quase sempre acerta a
+ * ordem de grandeza.
+ *
+ * @param n Ordem de A.
+ * @param resolver Chamável `(const T *b, T *x)` que resolve A x = b.
+ * @param resolver_transposta Chamável `(const T *b, T *x)` que resolve Aᵀ x = b.
+ * @return Estimativa de ||A⁻¹||₁.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Resolver, typename ResolverTransposta>
+T estimar_norma1_inversa(size_t n, Resolver resolver, ResolverTransposta resolver_transposta)
+{
+    if (n == 0)
+        return T(0);
+
+    std::vector<T> x(n, T(1) / static_cast<T>(n)), y(n), sinal(n), z(n);
+    auto norma1 = [&](const std::vector<T> &v) {
+        T soma = T(0);
+        for (const T e : v)
+            soma += std::abs(e);
+        return soma;
+    };
+
+    T estimativa = T(0);
+    for (int iteracao = 0; iteracao < 5; iteracao++) {
+        resolver(x.data(), y.data());
+        const T nova = norma1(y);
+        if (iteracao > 0 && nova <= estimativa)
+            break;
+        estimativa = nova;
+
+        for (size_t i = 0; i < n; i++)
+            sinal[i] = y[i] >= T(0) ? T(1) : T(-1);
+        resolver_transposta(sinal.data(), z.data());
+
+        size_t j = 0;
+        T produto = T(0);
+        for (size_t i = 0; i < n; i++) {
+            if (std::abs(z[i]) > std::abs(z[j]))
+                j = i;
+            produto += z[i] * x[i];
+        }
+        if (iteracao > 0 && std::abs(z[j]) <= produto)
+            break;
+
+        std::fill(x.begin(), x.end(), T(0));
+        x[j] = T(1);
+    }
+
+    // Vetor alternado de Higham: protege contra os casos em que as iterações estagnam
+    for (size_t i = 0; i < n; i++) {
+        const T rampa = n > 1 ? static_cast<T>(i) / static_cast<T>(n - 1) : T(0);
+        x[i] = (i % 2 ? T(-1) : T(1)) * (T(1) + rampa);
+    }
+    resolver(x.data(), y.data());
+    return std::max(estimativa, T(2) * norma1(y) / (T(3) * static_cast<T>(n)));
+}
+} // namespace detail
+
+/*!
+ * @brief Fatora a matriz simétrica A (só o triângulo inferior é lido).
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Matriz quadrada a ser fatorada.
+ * @throws std::invalid_argument Se a matriz não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Cholesky<T>::Cholesky(const Matriz<T> &A)
+{
+    fatorar(A.visao());
+}
+
+/*!
+ * @brief Fatora a matriz simétrica vista por A (só o triângulo inferior é lido).
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Visão quadrada a ser fatorada; os dados não são alterados.
+ * @throws std::invalid_argument Se a visão não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Cholesky<T>::Cholesky(const ConstMatrizView<T> &A)
+{
+    fatorar(A);
+}
+
+/*!
+ * @brief Fatora A com o fator e o espaço de trabalho tirados de uma arena.
+ *
+ * O objeto não pode ser usado depois que a arena for zerada.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Visão quadrada a ser fatorada; os dados não são alterados.
+ * @param area Arena de onde vem a memória.
+ * @throws std::invalid_argument Se a visão não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Cholesky<T>::Cholesky(const ConstMatrizView<T> &A, Arena &area)
+    : l_(AlocadorArena<T>(area)), trabalho_(AlocadorArena<T>(area))
+{
+    fatorar(A);
+}
+
+/*!
+ * @brief Refatora com uma nova matriz, reaproveitando a memória já alocada.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Matriz quadrada a ser fatorada.
+ * @throws std::invalid_argument Se a matriz não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void Cholesky<T>::fatorar(const Matriz<T> &A)
+{
+    fatorar(A.visao());
+}
+
+/*!
+ * @brief Fatoração blocada (variante right-looking), a partir de uma visão.
+ *
+ * Para cada painel de `bloco_` colunas: fatora o painel e atualiza o triângulo inferior
+ * restante com A22 -= L21 * L21ᵀ, pelo kernel GEMM. Para no primeiro pivô não positivo.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Visão quadrada a ser fatorada.
+ * @throws std::invalid_argument Se a visão não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void Cholesky<T>::fatorar(const ConstMatrizView<T> &A)
+{
+    if (A.linhas() != A.colunas())
+        throw std::invalid_argument("Matriz não é quadrada.");
+
+    IFNUM_MEDIR("Cholesky::fatorar");
+    IFNUM_FLOPS(A.linhas() * A.linhas() * A.linhas() / 3);
+    IFNUM_BYTES(sizeof(T) * A.linhas() * A.linhas());
+    if (l_.capacity() < A.linhas() * A.linhas() && !l_.get_allocator().arena())
+        IFNUM_ALOCACAO(sizeof(T) * A.linhas() * A.linhas());
+
+    const size_t n = n_ = A.linhas();
+    l_.resize(n * n);
+    trabalho_.resize(std::min(bloco_, n) * n);
+    definida_positiva_ = true;
+    T *a = l_.data();
+    norma1_ = detail::copiar_triangulo_inferior(A, a);
+
+    for (size_t k0 = 0; k0 < n; k0 += bloco_) {
+        const size_t kb = std::min(bloco_, n - k0);
+        const size_t k1 = k0 + kb;
+        if (!fatorar_painel_(k0, kb)) {
+            definida_positiva_ = false;
+            return;
+        }
+
+        if (k1 >= n)
+            break;
+
+        // W = L21ᵀ, para que o GEMM leia as duas parcelas por linhas
+        const size_t resto = n - k1;
+        T *W = trabalho_.data();
+        paralelo::para(0, resto, kb, [&](size_t inicio, size_t fim) {
+            for (size_t r = inicio; r < fim; r++)
+                for (size_t p = 0; p < kb; p++)
+                    W[p * resto + r] = a[(k1 + r) * n + k0 + p];
+        });
+        detail::atualizar_triangulo_inferior(a, n, k0, kb, W, bloco_);
+    }
+}
+
+/*!
+ * @brief Fatora o painel de colunas [k0, k0 + kb).
+ *
+ * Só as colunas do próprio painel são atualizadas; o restante é atualizado em bloco por
+ * fatorar().
+ *
+ * @return Falso se um pivô não for positivo (ou for NaN).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+bool Cholesky<T>::fatorar_painel_(size_t k0, size_t kb)
+{
+    const size_t n = n_;
+    const size_t k1 = k0 + kb;
+    T *a = l_.data();
+
+    for (size_t k = k0; k < k1; k++) {
+        const T d = a[k * n + k];
+        if (!(d > T(0)))
+            return false;
+
+        const T lkk = std::sqrt(d);
+        a[k * n + k] = lkk;
+        // As linhas do painel são lidas pelas demais: escaladas antes
+        for (size_t i = k + 1; i < k1; i++)
+            a[i * n + k] /= lkk;
+
+        paralelo::para(k + 1, n, k1 - k, [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++) {
+                T *li = a + i * n;
+                if (i >= k1)
+                    li[k] /= lkk;
+                const T fator = li[k];
+                const size_t fim_j = std::min(i + 1, k1);
+                for (size_t j = k + 1; j < fim_j; j++)
+                    li[j] -= fator * a[j * n + k];
+            }
+        });
+    }
+    return true;
+}
+
+/*!
+ * @brief Retorna a ordem n da matriz fatorada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+size_t Cholesky<T>::ordem() const
+{
+    return n_;
+}
+
+/*!
+ * @brief Indica se a fatoração foi até o fim (todos os pivôs positivos).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+bool Cholesky<T>::definida_positiva() const
+{
+    return definida_positiva_;
+}
+
+/*!
+ * @brief Retorna L (triangular inferior, diagonal positiva) como uma nova Matriz.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> Cholesky<T>::L() const
+{
+    Matriz<T> L(n_, n_);
+    for (size_t i = 0; i < n_; i++)
+        for (size_t j = 0; j <= i; j++)
+            L.elemento(i, j) = l_[i * n_ + j];
+    return L;
+}
+
+/*!
+ * @brief Determinante de A, pelo quadrado do produto da diagonal de L.
+ *
+ * @throws std::runtime_error Se a matriz não for definida positiva.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T Cholesky<T>::determinante() const
+{
+    if (!definida_positiva_)
+        throw std::runtime_error("Matriz não é definida positiva");
+
+    T produto = T(1);
+    for (size_t i = 0; i < n_; i++)
+        produto *= l_[i * n_ + i];
+    return produto * produto;
+}
+
+/*!
+ * @brief Logaritmo natural do determinante, sem o overflow do produto em matrizes grandes.
+ *
+ * @throws std::runtime_error Se a matriz não for definida positiva.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T Cholesky<T>::log_determinante() const
+{
+    if (!definida_positiva_)
+        throw std::runtime_error("Matriz não é definida positiva");
+
+    T soma = T(0);
+    for (size_t i = 0; i < n_; i++)
+        soma += std::log(l_[i * n_ + i]);
+    return T(2) * soma;
+}
+
+/*!
+ * @brief Estimativa do número de condição κ₁(A) = ||A||₁ ||A⁻¹||₁.
+ *
+ * ||A||₁ é calculada na fatoração e ||A⁻¹||₁ é estimada com algumas resoluções (ver
+ * detail::estimar_norma1_inversa), em O(n²).
+ *
+ * @return Estimativa de κ₁(A), ou infinito se A não for definida positiva.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T Cholesky<T>::condicao() const
+{
+    if (!definida_positiva_)
+        return std::numeric_limits<T>::infinity();
+
+    IFNUM_MEDIR("Cholesky::condicao");
+    auto resolver = [this](const T *b, T *x) { this->resolver(b, x); };
+    return norma1_ * detail::estimar_norma1_inversa<T>(n_, resolver, resolver);
+}
+
+/*!
+ * @brief Resolve A * X = B para um ou mais lados direitos (uma coluna de B por sistema).
+ *
+ * @tparam T Tipo dos elementos.
+ * @param b Matriz n x m com os lados direitos.
+ * @return Matriz n x m com as soluções.
+ * @throws std::invalid_argument Se b não tiver n linhas.
+ * @throws std::runtime_error Se a matriz não for definida positiva.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> Cholesky<T>::resolver(const Matriz<T> &b) const
+{
+    return resolver(b.visao());
+}
+
+/*!
+ * @brief Resolve A * X = B com os lados direitos dados por uma visão.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param b Visão n x m com os lados direitos.
+ * @return Matriz n x m com as soluções.
+ * @throws std::invalid_argument Se b não tiver n linhas.
+ * @throws std::runtime_error Se a matriz não for definida positiva.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> Cholesky<T>::resolver(const ConstMatrizView<T> &b) const
+{
+    if (b.linhas() != n_)
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+
+    Matriz<T> x(n_, b.colunas());
+    resolver(b, x.visao());
+    return x;
+}
+
+/*!
+ * @brief Resolve A * X = B escrevendo as soluções em uma visão existente, sem alocar.
+ *
+ * Substituição direta com L e reversa com Lᵀ, no próprio destino e linha a linha em todas
+ * as colunas; a reversa percorre L por linhas (contíguas) em vez de montar Lᵀ. x não pode
+ * se sobrepor a b.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param b Visão n x m com os lados direitos.
+ * @param x Visão n x m que recebe as soluções.
+ * @throws std::invalid_argument Se b ou x não tiverem n linhas, ou se as colunas diferirem.
+ * @throws std::runtime_error Se a matriz não for definida positiva.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void Cholesky<T>::resolver(const ConstMatrizView<T> &b, const MatrizView<T> &x) const
+{
+    if (b.linhas() != n_ || x.linhas() != n_ || x.colunas() != b.colunas())
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+
+    if (!definida_positiva_)
+        throw std::runtime_error("Matriz não é definida positiva");
+
+    IFNUM_MEDIR("Cholesky::resolver");
+    IFNUM_FLOPS(2 * n_ * n_ * b.colunas());
+    IFNUM_BYTES(sizeof(T) * (n_ * n_ / 2 + 2 * n_ * b.colunas()));
+    const size_t n = n_;
+    const size_t m = b.colunas();
+    const T *a = l_.data();
+    T *y = x.data();
+    const size_t pl = x.passo_linha();
+
+    auto substituir = [&](auto pc) {
+        for (size_t i = 0; i < n; i++)
+            for (size_t c = 0; c < m; c++)
+                y[i * pl + c * pc] = b.elemento(i, c);
+
+        // L * z = b
+        for (size_t i = 0; i < n; i++) {
+            T *yi = y + i * pl;
+            for (size_t k = 0; k < i; k++) {
+                const T fator = a[i * n + k];
+                const T *yk = y + k * pl;
+                for (size_t c = 0; c < m; c++)
+                    yi[c * pc] -= fator * yk[c * pc];
+            }
+            const T pivo = a[i * n + i];
+            for (size_t c = 0; c < m; c++)
+                yi[c * pc] /= pivo;
+        }
+
+        // Lᵀ * w = z: cada incógnita pronta é eliminada das anteriores pela linha i de L
+        for (size_t i = n; i-- > 0;) {
+            T *yi = y + i * pl;
+            const T pivo = a[i * n + i];
+            for (size_t c = 0; c < m; c++)
+                yi[c * pc] /= pivo;
+            for (size_t k = 0; k < i; k++) {
+                const T fator = a[i * n + k];
+                T *yk = y + k * pl;
+                for (size_t c = 0; c < m; c++)
+                    yk[c * pc] -= fator * yi[c * pc];
+            }
+        }
+    };
+    if (x.passo_coluna() == 1)
+        substituir(std::integral_constant<size_t, 1>());
+    else
+        substituir(x.passo_coluna());
+}
+
+/*!
+ * @brief Resolve A * x = b para um único lado direito, sem alocar memória.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param b Lado direito (n elementos).
+ * @param x Saída (n elementos); pode coincidir com b.
+ * @throws std::runtime_error Se a matriz não for definida positiva.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void Cholesky<T>::resolver(const T *b, T *x) const
+{
+    if (!definida_positiva_)
+        throw std::runtime_error("Matriz não é definida positiva");
+
+    IFNUM_MEDIR("Cholesky::resolver");
+    IFNUM_FLOPS(2 * n_ * n_);
+    IFNUM_BYTES(sizeof(T) * (n_ * n_ / 2 + 2 * n_));
+    const size_t n = n_;
+    const T *a = l_.data();
+
+    for (size_t i = 0; i < n; i++) {
+        T soma = b[i];
+        for (size_t k = 0; k < i; k++)
+            soma -= a[i * n + k] * x[k];
+        x[i] = soma / a[i * n + i];
+    }
+    for (size_t i = n; i-- > 0;) {
+        const T xi = x[i] /= a[i * n + i];
+        for (size_t k = 0; k < i; k++)
+            x[k] -= a[i * n + k] * xi;
+    }
+}
+
+/*!
+ * @brief Fatora a matriz simétrica A (só o triângulo inferior é lido).
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Matriz quadrada a ser fatorada.
+ * @throws std::invalid_argument Se a matriz não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+LDLT<T>::LDLT(const Matriz<T> &A)
+{
+    fatorar(A.visao());
+}
+
+/*!
+ * @brief Fatora a matriz simétrica vista por A (só o triângulo inferior é lido).
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Visão quadrada a ser fatorada; os dados não são alterados.
+ * @throws std::invalid_argument Se a visão não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+LDLT<T>::LDLT(const ConstMatrizView<T> &A)
+{
+    fatorar(A);
+}
+
+/*!
+ * @brief Fatora A com os fatores e o espaço de trabalho tirados de uma arena.
+ *
+ * O objeto não pode ser usado depois que a arena for zerada.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Visão quadrada a ser fatorada; os dados não são alterados.
+ * @param area Arena de onde vem a memória.
+ * @throws std::invalid_argument Se a visão não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+LDLT<T>::LDLT(const ConstMatrizView<T> &A, Arena &area)
+    : l_(AlocadorArena<T>(area)), trabalho_(AlocadorArena<T>(area))
+{
+    fatorar(A);
+}
+
+/*!
+ * @brief Refatora com uma nova matriz, reaproveitando a memória já alocada.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Matriz quadrada a ser fatorada.
+ * @throws std::invalid_argument Se a matriz não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void LDLT<T>::fatorar(const Matriz<T> &A)
+{
+    fatorar(A.visao());
+}
+
+/*!
+ * @brief Fatoração blocada (variante right-looking), a partir de uma visão.
+ *
+ * L fica abaixo da diagonal e D na diagonal. Para cada painel: fatora o painel e atualiza
+ * o triângulo inferior restante com A22 -= L21 * (D1 * L21ᵀ), pelo kernel GEMM. Para no
+ * primeiro pivô nulo.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Visão quadrada a ser fatorada.
+ * @throws std::invalid_argument Se a visão não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void LDLT<T>::fatorar(const ConstMatrizView<T> &A)
+{
+    if (A.linhas() != A.colunas())
+        throw std::invalid_argument("Matriz não é quadrada.");
+
+    IFNUM_MEDIR("LDLT::fatorar");
+    IFNUM_FLOPS(A.linhas() * A.linhas() * A.linhas() / 3);
+    IFNUM_BYTES(sizeof(T) * A.linhas() * A.linhas());
+    if (l_.capacity() < A.linhas() * A.linhas() && !l_.get_allocator().arena())
+        IFNUM_ALOCACAO(sizeof(T) * A.linhas() * A.linhas());
+
+    const size_t n = n_ = A.linhas();
+    l_.resize(n * n);
+    trabalho_.resize(std::min(bloco_, n) * n);
+    singular_ = false;
+    T *a = l_.data();
+    norma1_ = detail::copiar_triangulo_inferior(A, a);
+
+    for (size_t k0 = 0; k0 < n; k0 += bloco_) {
+        const size_t kb = std::min(bloco_, n - k0);
+        const size_t k1 = k0 + kb;
+        if (!fatorar_painel_(k0, kb)) {
+            singular_ = true;
+            return;
+        }
+
+        if (k1 >= n)
+            break;
+
+        // W = D1 * L21ᵀ
+        const size_t resto = n - k1;
+        T *W = trabalho_.data();
+        paralelo::para(0, resto, kb, [&](size_t inicio, size_t fim) {
+            for (size_t r = inicio; r < fim; r++)
+                for (size_t p = 0; p < kb; p++)
+                    W[p * resto + r] = a[(k0 + p) * n + k0 + p] * a[(k1 + r) * n + k0 + p];
+        });
+        detail::atualizar_triangulo_inferior(a, n, k0, kb, W, bloco_);
+    }
+}
+
+/*!
+ * @brief Fatora o painel de colunas [k0, k0 + kb).
+ *
+ * @return Falso se um pivô for nulo (ou NaN).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+bool LDLT<T>::fatorar_painel_(size_t k0, size_t kb)
+{
+    const size_t n = n_;
+    const size_t k1 = k0 + kb;
+    T *a = l_.data();
+    T original[bloco_]; // d * l(i, k) das linhas do painel
+
+    for (size_t k = k0; k < k1; k++) {
+        const T d = a[k * n + k];
+        if (!(std::abs(d) > T(0)))
+            return false;
+
+        for (size_t i = k + 1; i < k1; i++) {
+            original[i - k0] = a[i * n + k];
+            a[i * n + k] /= d;
+        }
+
+        paralelo::para(k + 1, n, k1 - k, [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++) {
+                T *li = a + i * n;
+                if (i >= k1)
+                    li[k] /= d;
+                const T fator = li[k];
+                const size_t fim_j = std::min(i + 1, k1);
+                for (size_t j = k + 1; j < fim_j; j++)
+                    li[j] -= fator * original[j - k0];
+            }
+        });
+    }
+    return true;
+}
+
+/*!
+ * @brief Retorna a ordem n da matriz fatorada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+size_t LDLT<T>::ordem() const
+{
+    return n_;
+}
+
+/*!
+ * @brief Indica se a fatoração parou em um pivô nulo.
+ *
+ * Sem pivotamento, isso também acontece com matrizes não singulares cujo algum menor
+ * principal é singular (ex.: [[0, 1], [1, 0]]).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+bool LDLT<T>::singular() const
+{
+    return singular_;
+}
+
+/*!
+ * @brief Inércia de A, contada pelos sinais de D (lei de Sylvester).
+ *
+ * Com todos os pivôs não nulos, `nulos` é sempre zero; A é definida positiva se e só se
+ * `positivos == ordem()`.
+ *
+ * @throws std::runtime_error Se a fatoração parou em um pivô nulo.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Inercia LDLT<T>::inercia() const
+{
+    if (singular_)
+        throw std::runtime_error("Matriz singular");
+
+    Inercia resultado;
+    for (size_t i = 0; i < n_; i++) {
+        const T d = l_[i * n_ + i];
+        if (d > T(0))
+            resultado.positivos++;
+        else if (d < T(0))
+            resultado.negativos++;
+        else
+            resultado.nulos++;
+    }
+    return resultado;
+}
+
+/*!
+ * @brief Retorna L (triangular inferior, diagonal unitária) como uma nova Matriz.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> LDLT<T>::L() const
+{
+    Matriz<T> L(n_, n_);
+    for (size_t i = 0; i < n_; i++) {
+        for (size_t j = 0; j < i; j++)
+            L.elemento(i, j) = l_[i * n_ + j];
+        L.elemento(i, i) = T(1);
+    }
+    return L;
+}
+
+/*!
+ * @brief Retorna D (diagonal) como uma nova Matriz.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> LDLT<T>::D() const
+{
+    Matriz<T> D(n_, n_);
+    for (size_t i = 0; i < n_; i++)
+        D.elemento(i, i) = l_[i * n_ + i];
+    return D;
+}
+
+/*!
+ * @brief Determinante de A, pelo produto de D.
+ *
+ * @return Determinante (zero se a fatoração parou em um pivô nulo).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T LDLT<T>::determinante() const
+{
+    if (singular_)
+        return T(0);
+
+    T det = T(1);
+    for (size_t i = 0; i < n_; i++)
+        det *= l_[i * n_ + i];
+    return det;
+}
+
+/*!
+ * @brief Estimativa do número de condição κ₁(A) = ||A||₁ ||A⁻¹||₁ (ver Cholesky::condicao).
+ *
+ * @return Estimativa de κ₁(A), ou infinito se a fatoração parou em um pivô nulo.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T LDLT<T>::condicao() const
+{
+    if (singular_)
+        return std::numeric_limits<T>::infinity();
+
+    IFNUM_MEDIR("LDLT::condicao");
+    auto resolver = [this](const T *b, T *x) { this->resolver(b, x); };
+    return norma1_ * detail::estimar_norma1_inversa<T>(n_, resolver, resolver);
+}
+
+/*!
+ * @brief Resolve A * X = B para um ou mais lados direitos (uma coluna de B por sistema).
+ *
+ * @tparam T Tipo dos elementos.
+ * @param b Matriz n x m com os lados direitos.
+ * @return Matriz n x m com as soluções.
+ * @throws std::invalid_argument Se b não tiver n linhas.
+ * @throws std::runtime_error Se a fatoração parou em um pivô nulo.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> LDLT<T>::resolver(const Matriz<T> &b) const
+{
+    return resolver(b.visao());
+}
+
+/*!
+ * @brief Resolve A * X = B com os lados direitos dados por uma visão.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param b Visão n x m com os lados direitos.
+ * @return Matriz n x m com as soluções.
+ * @throws std::invalid_argument Se b não tiver n linhas.
+ * @throws std::runtime_error Se a fatoração parou em um pivô nulo.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> LDLT<T>::resolver(const ConstMatrizView<T> &b) const
+{
+    if (b.linhas() != n_)
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+
+    Matriz<T> x(n_, b.colunas());
+    resolver(b, x.visao());
+    return x;
+}
+
+/*!
+ * @brief Resolve A * X = B escrevendo as soluções em uma visão existente, sem alocar.
+ *
+ * Substituição direta com L, divisão por D e substituição reversa com Lᵀ (percorrendo L por
+ * linhas). x não pode se sobrepor a b.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param b Visão n x m com os lados direitos.
+ * @param x Visão n x m que recebe as soluções.
+ * @throws std::invalid_argument Se b ou x não tiverem n linhas, ou se as colunas diferirem.
+ * @throws std::runtime_error Se a fatoração parou em um pivô nulo.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void LDLT<T>::resolver(const ConstMatrizView<T> &b, const MatrizView<T> &x) const
+{
+    if (b.linhas() != n_ || x.linhas() != n_ || x.colunas() != b.colunas())
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+
+    if (singular_)
+        throw std::runtime_error("Matriz singular");
+
+    IFNUM_MEDIR("LDLT::resolver");
+    IFNUM_FLOPS(2 * n_ * n_ * b.colunas());
+    IFNUM_BYTES(sizeof(T) * (n_ * n_ / 2 + 2 * n_ * b.colunas()));
+    const size_t n = n_;
+    const size_t m = b.colunas();
+    const T *a = l_.data();
+    T *y = x.data();
+    const size_t pl = x.passo_linha();
+
+    auto substituir = [&](auto pc) {
+        for (size_t i = 0; i < n; i++)
+            for (size_t c = 0; c < m; c++)
+                y[i * pl + c * pc] = b.elemento(i, c);
+
+        for (size_t i = 0; i < n; i++) {
+            T *yi = y + i * pl;
+            for (size_t k = 0; k < i; k++) {
+                const T fator = a[i * n + k];
+                const T *yk = y + k * pl;
+                for (size_t c = 0; c < m; c++)
+                    yi[c * pc] -= fator * yk[c * pc];
+            }
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            const T d = a[i * n + i];
+            for (size_t c = 0; c < m; c++)
+                y[i * pl + c * pc] /= d;
+        }
+
+        for (size_t i = n; i-- > 0;) {
+            const T *yi = y + i * pl;
+            for (size_t k = 0; k < i; k++) {
+                const T fator = a[i * n + k];
+                T *yk = y + k * pl;
+                for (size_t c = 0; c < m; c++)
+                    yk[c * pc] -= fator * yi[c * pc];
+            }
+        }
+    };
+    if (x.passo_coluna() == 1)
+        substituir(std::integral_constant<size_t, 1>());
+    else
+        substituir(x.passo_coluna());
+}
+
+/*!
+ * @brief Resolve A * x = b para um único lado direito, sem alocar memória.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param b Lado direito (n elementos).
+ * @param x Saída (n elementos); pode coincidir com b.
+ * @throws std::runtime_error Se a fatoração parou em um pivô nulo.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void LDLT<T>::resolver(const T *b, T *x) const
+{
+    if (singular_)
+        throw std::runtime_error("Matriz singular");
+
+    IFNUM_MEDIR("LDLT::resolver");
+    IFNUM_FLOPS(2 * n_ * n_);
+    IFNUM_BYTES(sizeof(T) * (n_ * n_ / 2 + 2 * n_));
+    const size_t n = n_;
+    const T *a = l_.data();
+
+    for (size_t i = 0; i < n; i++) {
+        T soma = b[i];
+        for (size_t k = 0; k < i; k++)
+            soma -= a[i * n + k] * x[k];
+        x[i] = soma;
+    }
+    for (size_t i = 0; i < n; i++)
+        x[i] /= a[i * n + i];
+    for (size_t i = n; i-- > 0;) {
+        const T xi = x[i];
+        for (size_t k = 0; k < i; k++)
+            x[k] -= a[i * n + k] * xi;
+    }
+}
+
+} // namespace ifnum
@@ -0,0 +1,42 @@
+/*!
+ * @file Configuracao.hpp
+ * @brief Opções de compilação da biblioteca.
+ *
+ * `IFNUM_CHECKED` escolhe, em tempo de compilação, a política de verificação de limites
+ * dos acessos a elementos (`Matriz::operator()`, `Matriz::elemento` e as visões):
+ *
+ * - `1`: os índices são verificados e acessos inválidos lançam std::out_of_range.
+ * - `0`: os acessos não fazem nenhuma verificação e são `noexcept`, o que permite ao
+ *   compilador vetorizar os laços internos dos algoritmos.
+ *
+ * Se não for definida, vale `0` em builds com `NDEBUG` e `1` nos demais. Todas as unidades
+ * de compilação de um mesmo programa (inclusive a biblioteca) devem usar o mesmo valor.
+ *
+ * `IFNUM_INSTRUMENTAR` liga (`1`) a instrumentação de Instrumentacao.hpp: cronômetros por
+ * ponto de chamada e contadores de operações, bytes e alocações. O padrão é `0`, em que as
+ * macros de instrumentação não geram código algum.
+ */
+
+#pragma once
+
+#ifndef IFNUM_CHECKED
+#ifdef NDEBUG
+#define IFNUM_CHECKED 0
+#else
+#define IFNUM_CHECKED 1
+#endif
+#endif
+
+#ifndef IFNUM_INSTRUMENTAR
+#define IFNUM_INSTRUMENTAR 0
+#endif
+
+namespace ifnum::detail
+{
+/*! @brief true se os acessos a elementos verificam os limites (ver IFNUM_CHECKED). */
+inline constexpr bool checado = IFNUM_CHECKED != 0;
+
+/*! @brief true se a instrumentação está ligada (ver IFNUM_INSTRUMENTAR). */
+inline constexpr bool instrumentado = IFNUM_INSTRUMENTAR != 0;
+
+} // namespace ifnum::detail
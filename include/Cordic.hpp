@@ -4,8 +4,15 @@
  *
  * Define a interface de funções que implementam seno, cosseno e rotação vetorial
  * usando o método iterativo CORDIC.
+ *
+ * Além do modo de rotação, há o modo vetorial circular (conversão para coordenadas polares:
+ * atan2 e hypot) e os modos hiperbólicos (exp, log e sqrt), todos com 30 iterações sobre
+ * tabelas de arcos e constantes de ganho fixas. Cada função tem uma versão em lote, que
+ * processa os valores em blocos (as iterações vetorizam entre elementos) e divide lotes
+ * grandes entre as threads do pool.
  */
 #pragma once
+#include <cstddef>
 #include <utility>
 
 namespace ifnum::cordic
@@ -15,4 +22,19 @@ std::pair<double, double> rotate(double x, double y, double angle);
 double sin(double angle);
 double cos(double angle);
 
+std::pair<double, double> polar(double x, double y);
+double atan2(double y, double x);
+double hypot(double x, double y);
+double exp(double x);
+double log(double x);
+double sqrt(double x);
+
+void sin(const double *angle, double *result, size_t n);
+void cos(const double *angle, double *result, size_t n);
+void atan2(const double *y, const double *x, double *result, size_t n);
+void hypot(const double *x, const double *y, double *result, size_t n);
+void exp(const double *x, double *result, size_t n);
+void log(const double *x, double *result, size_t n);
+void sqrt(const double *x, double *result, size_t n);
+
 } // namespace ifnum::cordic
@@ -0,0 +1,520 @@
+/*!
+ * @file CordicFixo.tpp
+ * @brief Implementações do motor CORDIC em ponto fixo.
+ *
+ * O corpo das iterações é escrito uma única vez sobre um tipo de "faixa" genérico: int32_t
+ * para as chamadas escalares e um vetor de 8 inteiros (extensões vetoriais do GCC/Clang)
+ * para os lotes. A variante AVX2 do lote é escolhida em tempo de execução, como nos
+ * kernels de Gemm.cpp.
+ */
+
+#ifdef __INTELLISENSE__
+#include "CordicFixo.hpp"
+#endif
+
+#include "Cpu.hpp"
+
+#if defined(__GNUC__)
+#define IFNUM_CORDIC_VETOR 1
+#endif
+
+#if defined(IFNUM_CORDIC_VETOR) && (defined(__x86_64__) || defined(__i386__))
+#define IFNUM_CORDIC_X86 1
+#endif
+
+namespace ifnum
+{
+namespace detail
+{
+inline constexpr double cordic_pi = 3.14159265358979323846264338327950288;
+inline constexpr double cordic_volta = 4294967296.0; // 2^32: uma volta completa em fase
+
+/*!
+ * @brief atan(x) pela série de Taylor, utilizável em `constexpr` (|x| <= 1/2).
+ */
+constexpr double cordic_atan_serie(double x)
+{
+    const double x2 = x * x;
+    double termo = x;
+    double soma = x;
+    for (int k = 1; k < 64; ++k) {
+        termo *= -x2;
+        soma += termo / (2 * k + 1);
+    }
+    return soma;
+}
+
+/*!
+ * @brief Raiz quadrada por Newton, utilizável em `constexpr` (v > 0).
+ */
+constexpr double cordic_raiz(double v)
+{
+    double x = v > 1 ? v : 1;
+    for (int k = 0; k < 128; ++k)
+        x = 0.5 * (x + v / x);
+    return x;
+}
+
+/*!
+ * @brief Tabela de atan(2⁻ⁱ) em unidades de fase (uma volta = 2³²).
+ *
+ * atan(1) = π/4 é exatamente 2²⁹; os demais termos são arredondados ao inteiro mais próximo.
+ */
+template <int N>
+constexpr std::array<int32_t, N> cordic_tabela_atan()
+{
+    std::array<int32_t, N> tabela{};
+    double potencia = 1.0;
+    for (int i = 0; i < N; ++i) {
+        if (i == 0) {
+            tabela[i] = int32_t(1) << 29;
+        } else {
+            const double fase = cordic_atan_serie(potencia) / (2 * cordic_pi) * cordic_volta;
+            tabela[i] = static_cast<int32_t>(fase + 0.5);
+        }
+        potencia *= 0.5;
+    }
+    return tabela;
+}
+
+/*!
+ * @brief Valor inicial de x: o inverso do ganho do CORDIC após N iterações, em Q(F).
+ */
+template <int N, int F>
+constexpr int32_t cordic_x0()
+{
+    double produto = 1.0; // prod (1 + 2^-2i)
+    double potencia = 1.0;
+    for (int i = 0; i < N; ++i) {
+        produto *= 1.0 + potencia;
+        potencia *= 0.25;
+    }
+    const double escala = static_cast<double>(int64_t(1) << F);
+    return static_cast<int32_t>(escala / cordic_raiz(produto) + 0.5);
+}
+
+template <int N>
+inline constexpr std::array<int32_t, N> cordic_atan = cordic_tabela_atan<N>();
+
+inline double cordic_escala(cordic::Unidade unidade) noexcept
+{
+    return unidade == cordic::Unidade::graus ? cordic_volta / 360.0
+                                             : cordic_volta / (2 * cordic_pi);
+}
+
+/*!
+ * @brief Ângulo em graus reduzido a uma volta, sem erro de arredondamento.
+ *
+ * Abaixo de 2⁴⁶, subtrai 360·q, com q o inteiro mais próximo de angulo / 360 (arredondado
+ * pela soma de 1.5·2⁵²): 360·q é inteiro e o resultado, múltiplo do ulp do ângulo e não
+ * maior que ele, é representável. São só somas e produtos, que vetorizam nos lotes. Acima,
+ * usa std::fmod, também exato.
+ *
+ * @return Ângulo congruente módulo 360, em [-180, 180] (ou em (-360, 360) pelo fmod).
+ */
+inline double cordic_reduzir_graus(double angulo) noexcept
+{
+    if (!(std::fabs(angulo) < 0x1p46))
+        return std::fmod(angulo, 360.0);
+    const double q = (angulo * (1.0 / 360.0) + 0x1.8p52) - 0x1.8p52;
+    return angulo - q * 360.0;
+}
+
+/*!
+ * @brief Converte um ângulo para fase binária de 32 bits (uma volta = 2³²).
+ *
+ * Em graus, o ângulo é reduzido antes a uma volta (cordic_reduzir_graus, exato);
+ * multiplicar primeiro pela escala 2³²/360, que já é arredondada, ampliaria o erro dela
+ * junto com o ângulo. Em radianos não há volta exata: o ângulo é multiplicado pela escala e
+ * só a fase é reduzida, com fmod quando |fase| >= 2⁵¹.
+ *
+ * Por fim, soma 1.5·2⁵² para que os bits baixos da mantissa sejam o inteiro arredondado, já
+ * reduzido módulo 2³².
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+inline uint32_t cordic_fase(double angulo, cordic::Unidade unidade) noexcept
+{
+    double v;
+    if (unidade == cordic::Unidade::graus) {
+        v = cordic_reduzir_graus(angulo) * cordic_escala(unidade);
+    } else {
+        v = angulo * cordic_escala(unidade);
+        if (!(std::fabs(v) < 0x1p51))
+            v = std::fmod(v, cordic_volta);
+    }
+    const double deslocado = v + 0x1.8p52;
+    uint64_t bits;
+    std::memcpy(&bits, &deslocado, sizeof(bits));
+    return static_cast<uint32_t>(bits);
+}
+
+/*!
+ * @brief Calcula seno e cosseno em Q(F) a partir das fases, em qualquer tipo de faixa.
+ *
+ * `V` é int32_t ou um vetor de int32_t; `U` é o correspondente sem sinal. A fase é reduzida
+ * ao quadrante mais próximo ([-45°, 45°]), a rotação é feita sem desvios (o sinal de z vira
+ * uma máscara) e o quadrante é reaplicado trocando x e y e invertendo sinais por máscaras.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <int N, int F, typename V, typename U>
+[[gnu::always_inline]] inline void cordic_nucleo(const U &fase, V &seno, V &cosseno) noexcept
+{
+    const U q = (fase + 0x20000000u) >> 30;
+    V z = (V)(fase - (q << 30));
+    V x = z * 0 + cordic_x0<N, F>();
+    V y = z * 0;
+
+#pragma GCC unroll 32
+    for (int i = 0; i < N; ++i) {
+        const V s = z >> 31; // 0 se z >= 0, -1 se z < 0
+        const V dx = ((y >> i) ^ s) - s;
+        const V dy = ((x >> i) ^ s) - s;
+        x -= dx;
+        y += dy;
+        z -= (cordic_atan<N>[i] ^ s) - s;
+    }
+
+    const V qs = (V)q;
+    const V troca = -(qs & 1);
+    const V neg_cos = -(((qs + 1) >> 1) & 1);
+    const V neg_sen = -((qs >> 1) & 1);
+    const V c = (x & ~troca) | (y & troca);
+    const V s = (y & ~troca) | (x & troca);
+    cosseno = (c ^ neg_cos) - neg_cos;
+    seno = (s ^ neg_sen) - neg_sen;
+}
+
+#ifdef IFNUM_CORDIC_VETOR
+typedef int32_t cordic_v8i __attribute__((vector_size(32)));
+typedef uint32_t cordic_v8u __attribute__((vector_size(32)));
+
+/*!
+ * @brief Corpo dos lotes: processa blocos de 8 ângulos por vez.
+ *
+ * Só as iterações usam os tipos vetoriais; a conversão para fase e de volta para double são
+ * laços simples sobre os 8 elementos, que o compilador vetoriza. Blocos com algum ângulo
+ * fora da faixa rápida (2⁴⁶ em graus, fase de 2⁵¹ em radianos) ou não finito refazem a
+ * conversão com cordic_fase; nos dois casos, o resultado é o mesmo da versão escalar. Ângulos não finitos
+ * produzem NaN. `seno` ou `cosseno` podem ser nulos, e qualquer um deles pode coincidir com
+ * `angulos` (cada bloco é lido inteiro antes de ser escrito).
+ */
+template <int N, int F>
+[[gnu::always_inline]] inline void cordic_lote_(const double *angulos, double *seno,
+                                                double *cosseno, size_t n,
+                                                cordic::Unidade unidade)
+{
+    constexpr size_t W = 8;
+    constexpr double quantum = 1.0 / static_cast<double>(int64_t(1) << F);
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const bool graus = unidade == cordic::Unidade::graus;
+    const double escala = cordic_escala(unidade);
+
+    for (size_t inicio = 0; inicio < n; inicio += W) {
+        const size_t m = n - inicio < W ? n - inicio : W;
+        double a[W] = {};
+        if (m == W)
+            std::memcpy(a, angulos + inicio, sizeof(a)); // tamanho constante: sem chamada
+        else
+            std::memcpy(a, angulos + inicio, m * sizeof(double));
+
+        uint32_t fases[W];
+        bool dentro = true; // falso também para NaN
+        for (size_t k = 0; k < W; ++k) {
+            double v;
+            if (graus) {
+                dentro &= std::fabs(a[k]) < 0x1p46;
+                const double q = (a[k] * (1.0 / 360.0) + 0x1.8p52) - 0x1.8p52;
+                v = (a[k] - q * 360.0) * escala; // como em cordic_reduzir_graus
+            } else {
+                v = a[k] * escala;
+                dentro &= std::fabs(v) < 0x1p51;
+            }
+            const double deslocado = v + 0x1.8p52;
+            uint64_t bits;
+            std::memcpy(&bits, &deslocado, sizeof(bits));
+            fases[k] = static_cast<uint32_t>(bits);
+        }
+
+        bool finito[W];
+        bool invalido = false;
+        if (!dentro) {
+            for (size_t k = 0; k < W; ++k) {
+                fases[k] = cordic_fase(a[k], unidade);
+                finito[k] = std::isfinite(a[k]);
+                invalido |= !finito[k];
+            }
+        }
+
+        cordic_v8u fase;
+        std::memcpy(&fase, fases, sizeof(fase));
+        cordic_v8i sv, cv;
+        cordic_nucleo<N, F>(fase, sv, cv);
+
+        int32_t si[W], ci[W];
+        std::memcpy(si, &sv, sizeof(si));
+        std::memcpy(ci, &cv, sizeof(ci));
+        double sd[W], cd[W];
+        for (size_t k = 0; k < W; ++k) {
+            sd[k] = si[k] * quantum;
+            cd[k] = ci[k] * quantum;
+        }
+        if (invalido) {
+            for (size_t k = 0; k < W; ++k) {
+                if (!finito[k])
+                    sd[k] = cd[k] = nan;
+            }
+        }
+
+        if (m == W) {
+            if (seno)
+                std::memcpy(seno + inicio, sd, sizeof(sd));
+            if (cosseno)
+                std::memcpy(cosseno + inicio, cd, sizeof(cd));
+        } else {
+            if (seno)
+                std::memcpy(seno + inicio, sd, m * sizeof(double));
+            if (cosseno)
+                std::memcpy(cosseno + inicio, cd, m * sizeof(double));
+        }
+    }
+}
+
+template <int N, int F>
+void cordic_lote_padrao(const double *angulos, double *seno, double *cosseno, size_t n,
+                        cordic::Unidade unidade)
+{
+    cordic_lote_<N, F>(angulos, seno, cosseno, n, unidade);
+}
+
+#ifdef IFNUM_CORDIC_X86
+template <int N, int F>
+__attribute__((target("avx2"))) void cordic_lote_avx2(const double *angulos, double *seno,
+                                                      double *cosseno, size_t n,
+                                                      cordic::Unidade unidade)
+{
+    cordic_lote_<N, F>(angulos, seno, cosseno, n, unidade);
+}
+#endif
+#endif // IFNUM_CORDIC_VETOR
+
+/*!
+ * @brief Seno e cosseno de um intervalo de ângulos, na melhor variante disponível.
+ */
+template <int N, int F>
+void cordic_lote(const double *angulos, double *seno, double *cosseno, size_t n,
+                 cordic::Unidade unidade)
+{
+#ifdef IFNUM_CORDIC_VETOR
+#ifdef IFNUM_CORDIC_X86
+    if (recursos_cpu().avx2) {
+        cordic_lote_avx2<N, F>(angulos, seno, cosseno, n, unidade);
+        return;
+    }
+#endif
+    cordic_lote_padrao<N, F>(angulos, seno, cosseno, n, unidade);
+#else
+    constexpr double quantum = 1.0 / static_cast<double>(int64_t(1) << F);
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (size_t k = 0; k < n; ++k) {
+        int32_t s, c;
+        cordic_nucleo<N, F>(cordic_fase(angulos[k], unidade), s, c);
+        const bool finito = std::isfinite(angulos[k]);
+        if (seno)
+            seno[k] = finito ? s * quantum : nan;
+        if (cosseno)
+            cosseno[k] = finito ? c * quantum : nan;
+    }
+#endif
+}
+
+/*!
+ * @brief Divide um lote entre as threads do pool, em blocos de 8 ângulos.
+ */
+template <int N, int F>
+void cordic_lote_paralelo(const double *angulos, double *seno, double *cosseno, size_t n,
+                          cordic::Unidade unidade)
+{
+    constexpr size_t bloco = 8;
+    const size_t blocos = (n + bloco - 1) / bloco;
+    paralelo::para(0, blocos, bloco * N, [&](size_t inicio, size_t fim) {
+        const size_t primeiro = inicio * bloco;
+        const size_t ultimo = fim * bloco < n ? fim * bloco : n;
+        cordic_lote<N, F>(angulos + primeiro, seno ? seno + primeiro : nullptr,
+                          cosseno ? cosseno + primeiro : nullptr, ultimo - primeiro, unidade);
+    });
+}
+} // namespace detail
+
+namespace cordic
+{
+/*!
+ * @brief Limite superior do erro absoluto de seno e cosseno nesta configuração.
+ *
+ * Soma o ângulo residual após as iterações (atan(2^-(N-1)) < 2^-(N-1)), o erro de
+ * truncamento dos deslocamentos (cerca de 2^-F por iteração) e a quantização da fase.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <int Iteracoes, int BitsFracao>
+constexpr double CordicFixo<Iteracoes, BitsFracao>::erro_estimado()
+{
+    double residual = 1.0;
+    for (int i = 1; i < Iteracoes; ++i)
+        residual *= 0.5;
+    const double quantum = 1.0 / static_cast<double>(int64_t(1) << BitsFracao);
+    return residual + (Iteracoes + 2) * quantum + 2 * detail::cordic_pi / detail::cordic_volta;
+}
+
+/*!
+ * @brief Converte um ângulo para a fase binária usada internamente (uma volta = 2³²).
+ *
+ * Em graus, o ângulo é reduzido a uma volta por detail::cordic_reduzir_graus (a − 360·q,
+ * com q arredondado pela soma de 1.5·2⁵², exato; std::fmod só para |ângulo| >= 2⁴⁶), e só
+ * então multiplicado por 2³²/360: antes do arredondamento, a fase erra por menos de 10⁻⁶
+ * unidade, para qualquer ângulo finito. Em radianos, 2π não é representável e a redução é
+ * feita sobre a fase já multiplicada; o erro cresce com o ângulo, cerca de
+ * 2·10⁻⁷ · |ângulo| unidades de fase (uma unidade é 2π/2³² ≈ 1,5·10⁻⁹ rad).
+ *
+ * @param angulo Ângulo finito.
+ * @param unidade Unidade do ângulo.
+ * @return Fase módulo 2³².
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <int Iteracoes, int BitsFracao>
+uint32_t CordicFixo<Iteracoes, BitsFracao>::fase(double angulo, Unidade unidade) noexcept
+{
+    return detail::cordic_fase(angulo, unidade);
+}
+
+/*!
+ * @brief Seno e cosseno de uma fase, em ponto fixo Q(BitsFracao).
+ *
+ * @param fase Fase binária (uma volta = 2³²), como devolvida por fase().
+ * @return Par {seno, cosseno}, cada um escalado por 2^BitsFracao.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <int Iteracoes, int BitsFracao>
+std::pair<int32_t, int32_t> CordicFixo<Iteracoes, BitsFracao>::sincos_fixo(uint32_t fase) noexcept
+{
+    int32_t s, c;
+    detail::cordic_nucleo<Iteracoes, BitsFracao>(fase, s, c);
+    return {s, c};
+}
+
+/*!
+ * @brief Calcula seno e cosseno de um ângulo arbitrário.
+ *
+ * @param angulo Ângulo em graus ou radianos (ver `unidade`).
+ * @param unidade Unidade do ângulo.
+ * @return Par {seno, cosseno}; NaN se o ângulo não for finito.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <int Iteracoes, int BitsFracao>
+std::pair<double, double> CordicFixo<Iteracoes, BitsFracao>::sincos(double angulo,
+                                                                    Unidade unidade) noexcept
+{
+    if (!std::isfinite(angulo)) {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        return {nan, nan};
+    }
+    constexpr double escala = 1.0 / static_cast<double>(int64_t(1) << BitsFracao);
+    const auto [s, c] = sincos_fixo(fase(angulo, unidade));
+    return {s * escala, c * escala};
+}
+
+/*!
+ * @brief Calcula o seno de um ângulo arbitrário.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <int Iteracoes, int BitsFracao>
+double CordicFixo<Iteracoes, BitsFracao>::sin(double angulo, Unidade unidade) noexcept
+{
+    return sincos(angulo, unidade).first;
+}
+
+/*!
+ * @brief Calcula o cosseno de um ângulo arbitrário.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <int Iteracoes, int BitsFracao>
+double CordicFixo<Iteracoes, BitsFracao>::cos(double angulo, Unidade unidade) noexcept
+{
+    return sincos(angulo, unidade).second;
+}
+
+/*!
+ * @brief Calcula o seno de n ângulos.
+ *
+ * Os ângulos são processados 8 por vez com SIMD (AVX2 quando disponível) e lotes grandes
+ * são divididos entre as threads do pool. `senos` pode coincidir com `angulos`.
+ *
+ * @param angulos Ângulos de entrada.
+ * @param senos Saída com n posições.
+ * @param n Número de ângulos.
+ * @param unidade Unidade dos ângulos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <int Iteracoes, int BitsFracao>
+void CordicFixo<Iteracoes, BitsFracao>::sin(const double *angulos, double *senos, size_t n,
+                                            Unidade unidade)
+{
+    IFNUM_MEDIR("CordicFixo::sin (lote)");
+    IFNUM_BYTES(2 * sizeof(double) * n);
+    detail::cordic_lote_paralelo<Iteracoes, BitsFracao>(angulos, senos, nullptr, n, unidade);
+}
+
+/*!
+ * @brief Calcula o cosseno de n ângulos (ver a versão em lote de sin).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <int Iteracoes, int BitsFracao>
+void CordicFixo<Iteracoes, BitsFracao>::cos(const double *angulos, double *cossenos, size_t n,
+                                            Unidade unidade)
+{
+    IFNUM_MEDIR("CordicFixo::cos (lote)");
+    IFNUM_BYTES(2 * sizeof(double) * n);
+    detail::cordic_lote_paralelo<Iteracoes, BitsFracao>(angulos, nullptr, cossenos, n, unidade);
+}
+
+/*!
+ * @brief Calcula seno e cosseno de n ângulos em uma só passada.
+ *
+ * @param angulos Ângulos de entrada.
+ * @param senos Saída dos senos, com n posições.
+ * @param cossenos Saída dos cossenos, com n posições (distinta de `senos`).
+ * @param n Número de ângulos.
+ * @param unidade Unidade dos ângulos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <int Iteracoes, int BitsFracao>
+void CordicFixo<Iteracoes, BitsFracao>::sincos(const double *angulos, double *senos,
+                                               double *cossenos, size_t n, Unidade unidade)
+{
+    IFNUM_MEDIR("CordicFixo::sincos (lote)");
+    IFNUM_BYTES(3 * sizeof(double) * n);
+    detail::cordic_lote_paralelo<Iteracoes, BitsFracao>(angulos, senos, cossenos, n, unidade);
+}
+
+} // namespace cordic
+} // namespace ifnum
@@ -0,0 +1,28 @@
+/*!
+ * @file Cpu.hpp
+ * @brief Detecção, em tempo de execução, dos recursos SIMD do processador.
+ *
+ * Usado pelos kernels numéricos para escolher a variante vetorizada adequada
+ * sem exigir que a biblioteca inteira seja compilada com `-march=native`.
+ */
+
+#pragma once
+
+namespace ifnum::detail
+{
+/*!
+ * @brief Conjunto de extensões SIMD disponíveis no processador atual.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+struct RecursosCpu {
+    bool sse2 = false;
+    bool avx2 = false;
+    bool fma = false;
+    bool avx512f = false;
+};
+
+const RecursosCpu &recursos_cpu();
+
+} // namespace ifnum::detail
@@ -0,0 +1,373 @@
+/*!
+ * @file Expressao.hpp
+ * @brief Templates de expressão para a aritmética elemento a elemento de Matriz.
+ *
+ * Operações como `A * 2.0 + B - C` não criam matrizes intermediárias: cada operador
+ * retorna um nó leve que apenas referencia seus operandos. A expressão inteira é
+ * avaliada em um único laço (e uma única alocação) quando atribuída a uma Matriz,
+ * e `+=`/`-=` escrevem diretamente no buffer de destino.
+ *
+ * Matrizes temporárias usadas como operandos (resultados de produtos e de funções) são
+ * movidas para dentro da expressão; matrizes nomeadas são referenciadas e devem viver até a
+ * avaliação. Com `auto r = A + B;`, `r` é uma expressão, não uma Matriz: declare
+ * `Matriz<double> r` ou use `(A + B).avaliar()` para materializar na hora.
+ */
+
+#pragma once
+#include "Alocador.hpp"
+#include "Configuracao.hpp"
+#include "Gemm.hpp"
+#include "Instrumentacao.hpp"
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ifnum
+{
+template <typename T, typename Alloc = AlocadorAlinhado<T>>
+class Matriz;
+template <typename T>
+class ConstMatrizView;
+
+/*!
+ * @brief Base CRTP de toda expressão matricial (inclusive a própria Matriz).
+ *
+ * Toda classe derivada `E` expõe `valor_tipo`, `linhas()`, `colunas()`,
+ * `elemento(i, j)`, que só verifica limites nas folhas (Matriz e visões) e apenas com
+ * IFNUM_CHECKED ativo, e `conflita(destino)`, que
+ * indica se a expressão lê a memória de `destino` em posições diferentes das escritas
+ * (nesse caso ela precisa ser avaliada em uma matriz temporária).
+ *
+ * @tparam E Tipo concreto da expressão.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename E>
+class ExpressaoMatriz
+{
+  public:
+    const E &derivada() const
+    {
+        return static_cast<const E &>(*this);
+    }
+
+    auto operator()(size_t linha, size_t coluna) const noexcept(!detail::checado);
+
+    auto avaliar() const;
+
+    // Métodos de Matriz que recebem a expressão já avaliada, para que `(A + B).transposta()`
+    // e afins continuem valendo.
+    auto vector() const;
+    void imprimir() const;
+    auto determinante() const;
+    auto modulo() const;
+    auto transposta() const;
+    auto linha(int indice) const;
+    auto coluna(int indice) const;
+    template <typename E2>
+    bool operator==(const ExpressaoMatriz<E2> &outra) const;
+    template <typename E2>
+    bool operator!=(const ExpressaoMatriz<E2> &outra) const;
+};
+
+namespace detail
+{
+/*!
+ * @brief Forma como um operando é guardado dentro de um nó de expressão.
+ *
+ * Matrizes são guardadas por referência (não são copiadas); nós de expressão, que são
+ * temporários baratos, são guardados por valor.
+ */
+template <typename E>
+struct OperandoExpressao {
+    using tipo = const E;
+};
+
+template <typename T, typename Alloc>
+struct OperandoExpressao<Matriz<T, Alloc>> {
+    using tipo = const Matriz<T, Alloc> &;
+};
+
+/*!
+ * @brief Operando que guarda uma Matriz temporária (rvalue) dentro da expressão.
+ *
+ * Uma Matriz temporária, como em `A * Matriz<double>(x) - b`, é destruída ao fim da
+ * expressão completa; se o nó guardasse só a referência, `auto r = A * x - b` leria memória
+ * liberada ao ser avaliado. A matriz é movida (sem copiar os elementos) para um
+ * shared_ptr, e os nós que a contêm podem ser copiados sem copiar a matriz.
+ *
+ * @tparam T Tipo dos elementos.
+ * @tparam Alloc Alocador da matriz.
+ */
+template <typename T, typename Alloc>
+class MatrizTemporaria : public ExpressaoMatriz<MatrizTemporaria<T, Alloc>>
+{
+  private:
+    std::shared_ptr<const Matriz<T, Alloc>> matriz_;
+
+  public:
+    using valor_tipo = T;
+
+    explicit MatrizTemporaria(Matriz<T, Alloc> &&matriz)
+        : matriz_(std::make_shared<const Matriz<T, Alloc>>(std::move(matriz)))
+    {
+    }
+
+    size_t linhas() const
+    {
+        return matriz_->linhas();
+    }
+
+    size_t colunas() const
+    {
+        return matriz_->colunas();
+    }
+
+    T elemento(size_t linha, size_t coluna) const
+    {
+        return matriz_->elemento(linha, coluna);
+    }
+
+    template <typename U>
+    bool conflita(const ConstMatrizView<U> &destino) const
+    {
+        return matriz_->conflita(destino);
+    }
+};
+
+/*! @brief Operações elemento a elemento usadas nos nós de expressão. */
+struct Soma {
+    template <typename T>
+    static T aplicar(const T &a, const T &b)
+    {
+        return a + b;
+    }
+};
+
+struct Subtracao {
+    template <typename T>
+    static T aplicar(const T &a, const T &b)
+    {
+        return a - b;
+    }
+};
+
+struct Multiplicacao {
+    template <typename T>
+    static T aplicar(const T &a, const T &b)
+    {
+        return a * b;
+    }
+};
+
+struct Divisao {
+    template <typename T>
+    static T aplicar(const T &a, const T &b)
+    {
+        return a / b;
+    }
+};
+} // namespace detail
+
+/*!
+ * @brief Nó de expressão para uma operação elemento a elemento entre duas expressões.
+ *
+ * @tparam E1 Expressão à esquerda.
+ * @tparam E2 Expressão à direita.
+ * @tparam Op Operação aplicada (detail::Soma, detail::Subtracao).
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename E1, typename E2, typename Op>
+class ExpressaoBinaria : public ExpressaoMatriz<ExpressaoBinaria<E1, E2, Op>>
+{
+  private:
+    typename detail::OperandoExpressao<E1>::tipo a_;
+    typename detail::OperandoExpressao<E2>::tipo b_;
+
+  public:
+    using valor_tipo = typename E1::valor_tipo;
+
+    ExpressaoBinaria(const E1 &a, const E2 &b);
+
+    size_t linhas() const
+    {
+        return a_.linhas();
+    }
+
+    size_t colunas() const
+    {
+        return a_.colunas();
+    }
+
+    valor_tipo elemento(size_t linha, size_t coluna) const
+    {
+        return Op::aplicar(a_.elemento(linha, coluna), b_.elemento(linha, coluna));
+    }
+
+    template <typename U>
+    bool conflita(const ConstMatrizView<U> &destino) const
+    {
+        return a_.conflita(destino) || b_.conflita(destino);
+    }
+};
+
+/*!
+ * @brief Nó de expressão para uma operação entre uma expressão e um escalar.
+ *
+ * @tparam E Expressão operando.
+ * @tparam Op Operação aplicada (detail::Multiplicacao, detail::Divisao).
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename E, typename Op>
+class ExpressaoEscalar : public ExpressaoMatriz<ExpressaoEscalar<E, Op>>
+{
+  public:
+    using valor_tipo = typename E::valor_tipo;
+
+  private:
+    typename detail::OperandoExpressao<E>::tipo a_;
+    valor_tipo escalar_;
+
+  public:
+    ExpressaoEscalar(const E &a, valor_tipo escalar);
+
+    size_t linhas() const
+    {
+        return a_.linhas();
+    }
+
+    size_t colunas() const
+    {
+        return a_.colunas();
+    }
+
+    valor_tipo elemento(size_t linha, size_t coluna) const
+    {
+        return Op::aplicar(a_.elemento(linha, coluna), escalar_);
+    }
+
+    template <typename U>
+    bool conflita(const ConstMatrizView<U> &destino) const
+    {
+        return a_.conflita(destino);
+    }
+};
+
+/*!
+ * @brief Nó de expressão para a negação elemento a elemento.
+ *
+ * @tparam E Expressão operando.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename E>
+class ExpressaoNegacao : public ExpressaoMatriz<ExpressaoNegacao<E>>
+{
+  private:
+    typename detail::OperandoExpressao<E>::tipo a_;
+
+  public:
+    using valor_tipo = typename E::valor_tipo;
+
+    explicit ExpressaoNegacao(const E &a);
+
+    size_t linhas() const
+    {
+        return a_.linhas();
+    }
+
+    size_t colunas() const
+    {
+        return a_.colunas();
+    }
+
+    valor_tipo elemento(size_t linha, size_t coluna) const
+    {
+        return static_cast<valor_tipo>(-a_.elemento(linha, coluna));
+    }
+
+    template <typename U>
+    bool conflita(const ConstMatrizView<U> &destino) const
+    {
+        return a_.conflita(destino);
+    }
+};
+
+template <typename E1, typename E2>
+ExpressaoBinaria<E1, E2, detail::Soma> operator+(const ExpressaoMatriz<E1> &a,
+                                                 const ExpressaoMatriz<E2> &b);
+
+template <typename E1, typename E2>
+ExpressaoBinaria<E1, E2, detail::Subtracao> operator-(const ExpressaoMatriz<E1> &a,
+                                                      const ExpressaoMatriz<E2> &b);
+
+template <typename E>
+ExpressaoNegacao<E> operator-(const ExpressaoMatriz<E> &a);
+
+template <typename E>
+ExpressaoEscalar<E, detail::Multiplicacao> operator*(const ExpressaoMatriz<E> &a,
+                                                     typename E::valor_tipo escalar);
+
+template <typename E>
+ExpressaoEscalar<E, detail::Multiplicacao> operator*(typename E::valor_tipo escalar,
+                                                     const ExpressaoMatriz<E> &a);
+
+template <typename E>
+ExpressaoEscalar<E, detail::Divisao> operator/(const ExpressaoMatriz<E> &a,
+                                               typename E::valor_tipo escalar);
+
+// Sobrecargas para operandos Matriz temporários, guardados por valor (ver
+// detail::MatrizTemporaria).
+template <typename T, typename A, typename E2>
+ExpressaoBinaria<detail::MatrizTemporaria<T, A>, E2, detail::Soma>
+operator+(Matriz<T, A> &&a, const ExpressaoMatriz<E2> &b);
+template <typename E1, typename T, typename A>
+ExpressaoBinaria<E1, detail::MatrizTemporaria<T, A>, detail::Soma>
+operator+(const ExpressaoMatriz<E1> &a, Matriz<T, A> &&b);
+template <typename T, typename A, typename T2, typename A2>
+ExpressaoBinaria<detail::MatrizTemporaria<T, A>, detail::MatrizTemporaria<T2, A2>, detail::Soma>
+operator+(Matriz<T, A> &&a, Matriz<T2, A2> &&b);
+
+template <typename T, typename A, typename E2>
+ExpressaoBinaria<detail::MatrizTemporaria<T, A>, E2, detail::Subtracao>
+operator-(Matriz<T, A> &&a, const ExpressaoMatriz<E2> &b);
+template <typename E1, typename T, typename A>
+ExpressaoBinaria<E1, detail::MatrizTemporaria<T, A>, detail::Subtracao>
+operator-(const ExpressaoMatriz<E1> &a, Matriz<T, A> &&b);
+template <typename T, typename A, typename T2, typename A2>
+ExpressaoBinaria<detail::MatrizTemporaria<T, A>, detail::MatrizTemporaria<T2, A2>,
+                 detail::Subtracao>
+operator-(Matriz<T, A> &&a, Matriz<T2, A2> &&b);
+
+template <typename T, typename A>
+ExpressaoNegacao<detail::MatrizTemporaria<T, A>> operator-(Matriz<T, A> &&a);
+
+template <typename T, typename A>
+ExpressaoEscalar<detail::MatrizTemporaria<T, A>, detail::Multiplicacao>
+operator*(Matriz<T, A> &&a, typename detail::MatrizTemporaria<T, A>::valor_tipo escalar);
+template <typename T, typename A>
+ExpressaoEscalar<detail::MatrizTemporaria<T, A>, detail::Multiplicacao>
+operator*(typename detail::MatrizTemporaria<T, A>::valor_tipo escalar, Matriz<T, A> &&a);
+template <typename T, typename A>
+ExpressaoEscalar<detail::MatrizTemporaria<T, A>, detail::Divisao>
+operator/(Matriz<T, A> &&a, typename detail::MatrizTemporaria<T, A>::valor_tipo escalar);
+
+template <typename E1, typename E2>
+Matriz<typename E1::valor_tipo> operator*(const ExpressaoMatriz<E1> &a,
+                                          const ExpressaoMatriz<E2> &b);
+
+template <typename E>
+std::ostream &operator<<(std::ostream &os, const ExpressaoMatriz<E> &e);
+
+} // namespace ifnum
+
+#include "Expressao.tpp"
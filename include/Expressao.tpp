@@ -0,0 +1,576 @@
+/*!
+ * @file Expressao.tpp
+ * @brief Implementação dos templates de expressão declarados em Expressao.hpp.
+ */
+
+#ifdef __INTELLISENSE__
+#include "Expressao.hpp"
+#endif
+
+namespace ifnum
+{
+/*!
+ * @brief Avalia um único elemento da expressão.
+ *
+ * @param linha Índice da linha (inicia em 0).
+ * @param coluna Índice da coluna (inicia em 0).
+ * @return Valor do elemento na posição (linha, coluna).
+ * @throws std::out_of_range Se IFNUM_CHECKED estiver ativo e os índices estiverem fora dos
+ *         limites.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename E>
+auto ExpressaoMatriz<E>::operator()(size_t linha, size_t coluna) const
+    noexcept(!detail::checado)
+{
+    if constexpr (detail::checado) {
+        if (linha >= derivada().linhas() || coluna >= derivada().colunas())
+            throw std::out_of_range("Índices fora dos limites da matriz.");
+    }
+
+    return derivada().elemento(linha, coluna);
+}
+
+/*!
+ * @brief Constrói o nó verificando se os operandos têm a mesma ordem.
+ *
+ * @throws std::invalid_argument Se as dimensões forem diferentes.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename E1, typename E2, typename Op>
+ExpressaoBinaria<E1, E2, Op>::ExpressaoBinaria(const E1 &a, const E2 &b) : a_(a), b_(b)
+{
+    if (a.linhas() != b.linhas() || a.colunas() != b.colunas())
+        throw std::invalid_argument("Matrizes de ordens diferentes.");
+}
+
+/*!
+ * @brief Constrói o nó guardando o operando e o escalar.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename E, typename Op>
+ExpressaoEscalar<E, Op>::ExpressaoEscalar(const E &a, valor_tipo escalar)
+    : a_(a), escalar_(escalar)
+{
+}
+
+/*!
+ * @brief Constrói o nó de negação.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename E>
+ExpressaoNegacao<E>::ExpressaoNegacao(const E &a) : a_(a)
+{
+}
+
+/*!
+ * @brief Soma elemento a elemento de duas expressões (avaliação preguiçosa).
+ *
+ * @param a Expressão à esquerda.
+ * @param b Expressão à direita.
+ * @return Nó de expressão representando `a + b`.
+ * @throws std::invalid_argument Se as dimensões forem diferentes.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename E1, typename E2>
+ExpressaoBinaria<E1, E2, detail::Soma> operator+(const ExpressaoMatriz<E1> &a,
+                                                 const ExpressaoMatriz<E2> &b)
+{
+    return ExpressaoBinaria<E1, E2, detail::Soma>(a.derivada(), b.derivada());
+}
+
+/*!
+ * @brief Subtração elemento a elemento de duas expressões (avaliação preguiçosa).
+ *
+ * @param a Expressão à esquerda.
+ * @param b Expressão à direita.
+ * @return Nó de expressão representando `a - b`.
+ * @throws std::invalid_argument Se as dimensões forem diferentes.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename E1, typename E2>
+ExpressaoBinaria<E1, E2, detail::Subtracao> operator-(const ExpressaoMatriz<E1> &a,
+                                                      const ExpressaoMatriz<E2> &b)
+{
+    return ExpressaoBinaria<E1, E2, detail::Subtracao>(a.derivada(), b.derivada());
+}
+
+/*!
+ * @brief Negação elemento a elemento (avaliação preguiçosa).
+ *
+ * @param a Expressão operando.
+ * @return Nó de expressão representando `-a`.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename E>
+ExpressaoNegacao<E> operator-(const ExpressaoMatriz<E> &a)
+{
+    return ExpressaoNegacao<E>(a.derivada());
+}
+
+/*!
+ * @brief Multiplicação por escalar (avaliação preguiçosa).
+ *
+ * @param a Expressão operando.
+ * @param escalar Valor escalar multiplicador.
+ * @return Nó de expressão representando `a * escalar`.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename E>
+ExpressaoEscalar<E, detail::Multiplicacao> operator*(const ExpressaoMatriz<E> &a,
+                                                     typename E::valor_tipo escalar)
+{
+    return ExpressaoEscalar<E, detail::Multiplicacao>(a.derivada(), escalar);
+}
+
+/*!
+ * @brief Multiplicação por escalar, com o escalar à esquerda (avaliação preguiçosa).
+ *
+ * @param escalar Valor escalar multiplicador.
+ * @param a Expressão operando.
+ * @return Nó de expressão representando `a * escalar`.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename E>
+ExpressaoEscalar<E, detail::Multiplicacao> operator*(typename E::valor_tipo escalar,
+                                                     const ExpressaoMatriz<E> &a)
+{
+    return ExpressaoEscalar<E, detail::Multiplicacao>(a.derivada(), escalar);
+}
+
+/*!
+ * @brief Divisão por escalar (avaliação preguiçosa).
+ *
+ * @param a Expressão operando.
+ * @param escalar Valor escalar divisor.
+ * @return Nó de expressão representando `a / escalar`.
+ * @throws std::invalid_argument Se o escalar for zero.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename E>
+ExpressaoEscalar<E, detail::Divisao> operator/(const ExpressaoMatriz<E> &a,
+                                               typename E::valor_tipo escalar)
+{
+    if (escalar == 0)
+        throw std::invalid_argument("Divisão por zero.");
+
+    return ExpressaoEscalar<E, detail::Divisao>(a.derivada(), escalar);
+}
+
+/*!
+ * @brief Soma com uma Matriz temporária à esquerda, que é movida para dentro do nó (ver
+ *        detail::MatrizTemporaria).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename A, typename E2>
+ExpressaoBinaria<detail::MatrizTemporaria<T, A>, E2, detail::Soma>
+operator+(Matriz<T, A> &&a, const ExpressaoMatriz<E2> &b)
+{
+    return {detail::MatrizTemporaria<T, A>(std::move(a)), b.derivada()};
+}
+
+/*!
+ * @brief Soma com uma Matriz temporária à direita.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename E1, typename T, typename A>
+ExpressaoBinaria<E1, detail::MatrizTemporaria<T, A>, detail::Soma>
+operator+(const ExpressaoMatriz<E1> &a, Matriz<T, A> &&b)
+{
+    return {a.derivada(), detail::MatrizTemporaria<T, A>(std::move(b))};
+}
+
+/*!
+ * @brief Soma de duas Matrizes temporárias.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename A, typename T2, typename A2>
+ExpressaoBinaria<detail::MatrizTemporaria<T, A>, detail::MatrizTemporaria<T2, A2>, detail::Soma>
+operator+(Matriz<T, A> &&a, Matriz<T2, A2> &&b)
+{
+    return {detail::MatrizTemporaria<T, A>(std::move(a)),
+            detail::MatrizTemporaria<T2, A2>(std::move(b))};
+}
+
+/*!
+ * @brief Subtração com uma Matriz temporária à esquerda.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename A, typename E2>
+ExpressaoBinaria<detail::MatrizTemporaria<T, A>, E2, detail::Subtracao>
+operator-(Matriz<T, A> &&a, const ExpressaoMatriz<E2> &b)
+{
+    return {detail::MatrizTemporaria<T, A>(std::move(a)), b.derivada()};
+}
+
+/*!
+ * @brief Subtração com uma Matriz temporária à direita.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename E1, typename T, typename A>
+ExpressaoBinaria<E1, detail::MatrizTemporaria<T, A>, detail::Subtracao>
+operator-(const ExpressaoMatriz<E1> &a, Matriz<T, A> &&b)
+{
+    return {a.derivada(), detail::MatrizTemporaria<T, A>(std::move(b))};
+}
+
+/*!
+ * @brief Subtração de duas Matrizes temporárias.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename A, typename T2, typename A2>
+ExpressaoBinaria<detail::MatrizTemporaria<T, A>, detail::MatrizTemporaria<T2, A2>,
+                 detail::Subtracao>
+operator-(Matriz<T, A> &&a, Matriz<T2, A2> &&b)
+{
+    return {detail::MatrizTemporaria<T, A>(std::move(a)),
+            detail::MatrizTemporaria<T2, A2>(std::move(b))};
+}
+
+/*!
+ * @brief Negação de uma Matriz temporária.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename A>
+ExpressaoNegacao<detail::MatrizTemporaria<T, A>> operator-(Matriz<T, A> &&a)
+{
+    return ExpressaoNegacao<detail::MatrizTemporaria<T, A>>(
+        detail::MatrizTemporaria<T, A>(std::move(a)));
+}
+
+/*!
+ * @brief Multiplicação de uma Matriz temporária por escalar.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename A>
+ExpressaoEscalar<detail::MatrizTemporaria<T, A>, detail::Multiplicacao>
+operator*(Matriz<T, A> &&a, typename detail::MatrizTemporaria<T, A>::valor_tipo escalar)
+{
+    return {detail::MatrizTemporaria<T, A>(std::move(a)), escalar};
+}
+
+/*!
+ * @brief Multiplicação de uma Matriz temporária por escalar, com o escalar à esquerda.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename A>
+ExpressaoEscalar<detail::MatrizTemporaria<T, A>, detail::Multiplicacao>
+operator*(typename detail::MatrizTemporaria<T, A>::valor_tipo escalar, Matriz<T, A> &&a)
+{
+    return {detail::MatrizTemporaria<T, A>(std::move(a)), escalar};
+}
+
+/*!
+ * @brief Divisão de uma Matriz temporária por escalar.
+ *
+ * @throws std::invalid_argument Se o escalar for zero.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename A>
+ExpressaoEscalar<detail::MatrizTemporaria<T, A>, detail::Divisao>
+operator/(Matriz<T, A> &&a, typename detail::MatrizTemporaria<T, A>::valor_tipo escalar)
+{
+    if (escalar == 0)
+        throw std::invalid_argument("Divisão por zero.");
+
+    return {detail::MatrizTemporaria<T, A>(std::move(a)), escalar};
+}
+
+namespace detail
+{
+/*! @brief true se E é uma Matriz (com qualquer alocador). */
+template <typename E>
+struct eh_matriz : std::false_type {
+};
+
+template <typename T, typename Alloc>
+struct eh_matriz<Matriz<T, Alloc>> : std::true_type {
+};
+
+/*!
+ * @brief Materializa uma expressão em Matriz; uma Matriz é repassada sem cópia.
+ */
+template <typename T, typename Alloc>
+const Matriz<T, Alloc> &avaliar(const Matriz<T, Alloc> &m)
+{
+    return m;
+}
+
+template <typename E>
+Matriz<typename E::valor_tipo> avaliar(const ExpressaoMatriz<E> &e)
+{
+    return Matriz<typename E::valor_tipo>(e);
+}
+
+} // namespace detail
+
+/*!
+ * @brief Avalia a expressão em uma nova Matriz.
+ *
+ * Útil com `auto`, que guardaria a expressão (e referências aos operandos) em vez do
+ * resultado: `auto r = (A * x - b).avaliar();`.
+ *
+ * @return Matriz com o resultado.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename E>
+auto ExpressaoMatriz<E>::avaliar() const
+{
+    return Matriz<typename E::valor_tipo>(derivada());
+}
+
+/*!
+ * @brief Elementos da expressão avaliada, em ordem de linhas (ver Matriz::vector).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename E>
+auto ExpressaoMatriz<E>::vector() const
+{
+    return avaliar().vector();
+}
+
+/*!
+ * @brief Imprime a expressão avaliada (ver Matriz::imprimir).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename E>
+void ExpressaoMatriz<E>::imprimir() const
+{
+    avaliar().imprimir();
+}
+
+/*!
+ * @brief Determinante da expressão avaliada (ver Matriz::determinante).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename E>
+auto ExpressaoMatriz<E>::determinante() const
+{
+    return avaliar().determinante();
+}
+
+/*!
+ * @brief Norma euclidiana da expressão avaliada (ver Matriz::modulo).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename E>
+auto ExpressaoMatriz<E>::modulo() const
+{
+    return avaliar().modulo();
+}
+
+/*!
+ * @brief Transposta da expressão avaliada, como nova Matriz (ver Matriz::transposta).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename E>
+auto ExpressaoMatriz<E>::transposta() const
+{
+    return avaliar().transposta();
+}
+
+/*!
+ * @brief Cópia de uma linha da expressão avaliada (ver Matriz::linha).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename E>
+auto ExpressaoMatriz<E>::linha(int indice) const
+{
+    return avaliar().linha(indice);
+}
+
+/*!
+ * @brief Cópia de uma coluna da expressão avaliada (ver Matriz::coluna).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename E>
+auto ExpressaoMatriz<E>::coluna(int indice) const
+{
+    return avaliar().coluna(indice);
+}
+
+/*!
+ * @brief Compara a expressão avaliada com outra expressão (ver Matriz::operator==).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename E>
+template <typename E2>
+bool ExpressaoMatriz<E>::operator==(const ExpressaoMatriz<E2> &outra) const
+{
+    return avaliar() == detail::avaliar(outra.derivada());
+}
+
+/*!
+ * @brief Negação de operator==.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename E>
+template <typename E2>
+bool ExpressaoMatriz<E>::operator!=(const ExpressaoMatriz<E2> &outra) const
+{
+    return !(*this == outra);
+}
+
+namespace detail
+{
+/*!
+ * @brief Operando do kernel GEMM: ponteiro e passo de linha sobre dados contíguos por linha.
+ *
+ * Matrizes e visões com linhas contíguas são repassadas sem cópia (blocos, linhas e
+ * colunas de outra matriz inclusive). Visões transpostas e demais expressões são
+ * materializadas em uma matriz temporária, que vive enquanto o operando existir.
+ *
+ * @tparam T Tipo dos elementos.
+ */
+template <typename T>
+class OperandoGemm
+{
+  private:
+    std::optional<Matriz<T>> copia_;
+    ConstMatrizView<T> visao_;
+
+    template <typename E>
+    ConstMatrizView<T> preparar_(const E &e)
+    {
+        if constexpr (eh_matriz<E>::value) {
+            return e.visao();
+        } else {
+            if constexpr (std::is_same_v<E, ConstMatrizView<T>>)
+                if (e.linhas_contiguas())
+                    return e;
+
+            copia_.emplace(e);
+            return copia_->visao();
+        }
+    }
+
+  public:
+    template <typename E>
+    explicit OperandoGemm(const ExpressaoMatriz<E> &e) : visao_(preparar_(e.derivada()))
+    {
+    }
+
+    OperandoGemm(const OperandoGemm &) = delete;
+    OperandoGemm &operator=(const OperandoGemm &) = delete;
+
+    const ConstMatrizView<T> &visao() const
+    {
+        return visao_;
+    }
+};
+} // namespace detail
+
+/*!
+ * @brief Produto matricial entre duas expressões.
+ *
+ * O produto não é elemento a elemento, então é sempre avaliado imediatamente pelo kernel
+ * GEMM. Matrizes e visões com linhas contíguas (blocos, linhas e colunas) são lidas no
+ * lugar; visões transpostas e demais expressões são materializadas antes.
+ *
+ * @param a Matriz (ou expressão) à esquerda.
+ * @param b Matriz (ou expressão) à direita.
+ * @return Nova matriz resultante do produto.
+ * @throws std::invalid_argument Se o número de colunas de `a` for diferente do número de
+ *         linhas de `b`.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename E1, typename E2>
+Matriz<typename E1::valor_tipo> operator*(const ExpressaoMatriz<E1> &a,
+                                          const ExpressaoMatriz<E2> &b)
+{
+    using T = typename E1::valor_tipo;
+    IFNUM_MEDIR("operator*");
+
+    const detail::OperandoGemm<T> oa(a);
+    const detail::OperandoGemm<T> ob(b);
+    const ConstMatrizView<T> &va = oa.visao();
+    const ConstMatrizView<T> &vb = ob.visao();
+
+    if (va.colunas() != vb.linhas())
+        throw std::invalid_argument("Matrizes com dimensões incompatíveis para multiplicação.");
+
+    IFNUM_FLOPS(2 * va.linhas() * vb.colunas() * va.colunas());
+    IFNUM_BYTES(sizeof(T) * (va.linhas() * va.colunas() + vb.linhas() * vb.colunas() +
+                             va.linhas() * vb.colunas()));
+    Matriz<T> novo(va.linhas(), vb.colunas());
+    detail::gemm(va.linhas(), vb.colunas(), va.colunas(), T(1), va.data(), va.passo_linha(),
+                 vb.data(), vb.passo_linha(), T(0), novo.data(), novo.colunas());
+
+    return novo;
+}
+
+/*!
+ * @brief Imprime uma expressão, avaliando-a em uma Matriz temporária.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename E>
+std::ostream &operator<<(std::ostream &os, const ExpressaoMatriz<E> &e)
+{
+    return os << detail::avaliar(e.derivada());
+}
+
+} // namespace ifnum
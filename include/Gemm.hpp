@@ -0,0 +1,47 @@
+/*!
+ * @file Gemm.hpp
+ * @brief Declaração do kernel de multiplicação de matrizes (GEMM) usado pela classe Matriz.
+ *
+ * Implementa C = alfa * A * B + beta * C sobre buffers contíguos em ordem de linha,
+ * com empacotamento de painéis, blocagem para as caches L1/L2 e micro-kernels com
+ * blocagem em registradores. As versões para `float` e `double` escolhem em tempo
+ * de execução um micro-kernel AVX2/FMA, quando disponível.
+ */
+
+#pragma once
+#include "Paralelo.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ifnum::detail
+{
+/*!
+ * @brief Assinatura de um micro-kernel: C[MR x NR] += A_empacotado * B_empacotado.
+ *
+ * @tparam T Tipo dos elementos.
+ */
+template <typename T>
+using MicroKernel = void (*)(size_t kc, const T *a, const T *b, T *c, size_t ldc);
+
+template <typename T, size_t MR, size_t NR>
+void micro_kernel_generico(size_t kc, const T *a, const T *b, T *c, size_t ldc);
+
+template <typename T, size_t MR, size_t NR>
+void gemm_blocado(size_t m, size_t n, size_t k, T alfa, const T *A, size_t lda, const T *B,
+                  size_t ldb, T beta, T *C, size_t ldc, MicroKernel<T> kernel, size_t mc_max,
+                  size_t kc_max, size_t nc_max);
+
+template <typename T>
+void gemm(size_t m, size_t n, size_t k, T alfa, const T *A, size_t lda, const T *B, size_t ldb,
+          T beta, T *C, size_t ldc);
+
+void gemm(size_t m, size_t n, size_t k, float alfa, const float *A, size_t lda, const float *B,
+          size_t ldb, float beta, float *C, size_t ldc);
+
+void gemm(size_t m, size_t n, size_t k, double alfa, const double *A, size_t lda,
+          const double *B, size_t ldb, double beta, double *C, size_t ldc);
+
+} // namespace ifnum::detail
+
+#include "Gemm.tpp"
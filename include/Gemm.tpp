@@ -0,0 +1,334 @@
+/*!
+ * @file Gemm.tpp
+ * @brief Implementação dos templates do kernel GEMM declarados em Gemm.hpp.
+ */
+
+#ifdef __INTELLISENSE__
+#include "Gemm.hpp"
+#endif
+
+namespace ifnum::detail
+{
+/*!
+ * @brief Aplica o fator beta em um bloco m x n de C.
+ *
+ * Quando beta é zero o bloco é zerado, sem ler C (evita propagar NaN/lixo).
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+void escalar_c(size_t m, size_t n, T beta, T *C, size_t ldc)
+{
+    if (beta == T(1))
+        return;
+
+    for (size_t i = 0; i < m; i++) {
+        T *c = C + i * ldc;
+        if (beta == T(0))
+            std::fill_n(c, n, T(0));
+        else
+            for (size_t j = 0; j < n; j++)
+                c[j] *= beta;
+    }
+}
+
+/*!
+ * @brief GEMM direto em ordem i-k-j, sem empacotamento.
+ *
+ * Usado para produtos pequenos, onde o custo de empacotar os painéis não compensa.
+ * Cada elemento de C acumula os produtos na mesma ordem (k crescente) do laço ingênuo.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+void gemm_simples(size_t m, size_t n, size_t k, T alfa, const T *A, size_t lda, const T *B,
+                  size_t ldb, T *C, size_t ldc)
+{
+    for (size_t i = 0; i < m; i++) {
+        T *c = C + i * ldc;
+        for (size_t p = 0; p < k; p++) {
+            const T a = alfa * A[i * lda + p];
+            const T *b = B + p * ldb;
+            for (size_t j = 0; j < n; j++)
+                c[j] += a * b[j];
+        }
+    }
+}
+
+/*!
+ * @brief Empacota um bloco mc x kc de A (multiplicado por alfa) em fatias de MR linhas.
+ *
+ * Dentro de cada fatia os elementos ficam em ordem de coluna, que é a ordem em que
+ * o micro-kernel os consome. Linhas que faltam na última fatia são preenchidas com zero.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T, size_t MR>
+void empacotar_a(size_t mc, size_t kc, T alfa, const T *A, size_t lda, T *destino)
+{
+    for (size_t ir = 0; ir < mc; ir += MR) {
+        const size_t mr = std::min(MR, mc - ir);
+        for (size_t p = 0; p < kc; p++) {
+            for (size_t i = 0; i < mr; i++)
+                destino[i] = alfa * A[(ir + i) * lda + p];
+            for (size_t i = mr; i < MR; i++)
+                destino[i] = T(0);
+            destino += MR;
+        }
+    }
+}
+
+/*!
+ * @brief Empacota um bloco kc x nc de B em fatias de NR colunas.
+ *
+ * Dentro de cada fatia os elementos ficam em ordem de linha; colunas que faltam na
+ * última fatia são preenchidas com zero.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T, size_t NR>
+void empacotar_b(size_t kc, size_t nc, const T *B, size_t ldb, T *destino)
+{
+    for (size_t jr = 0; jr < nc; jr += NR) {
+        const size_t nr = std::min(NR, nc - jr);
+        for (size_t p = 0; p < kc; p++) {
+            const T *b = B + p * ldb + jr;
+            for (size_t j = 0; j < nr; j++)
+                destino[j] = b[j];
+            for (size_t j = nr; j < NR; j++)
+                destino[j] = T(0);
+            destino += NR;
+        }
+    }
+}
+
+/*!
+ * @brief Micro-kernel portável: acumula um bloco MR x NR em registradores e soma em C.
+ *
+ * Escrito com limites constantes para que o compilador desenrole e vetorize os laços
+ * quando possível. Serve a qualquer tipo T com `+` e `*`.
+ *
+ * @tparam T Tipo dos elementos.
+ * @tparam MR Linhas do bloco de registradores.
+ * @tparam NR Colunas do bloco de registradores.
+ * @param kc Profundidade do painel.
+ * @param a Fatia empacotada de A (kc x MR).
+ * @param b Fatia empacotada de B (kc x NR).
+ * @param c Canto superior esquerdo do bloco de C.
+ * @param ldc Distância entre linhas consecutivas de C.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T, size_t MR, size_t NR>
+void micro_kernel_generico(size_t kc, const T *a, const T *b, T *c, size_t ldc)
+{
+    T acc[MR][NR];
+    for (size_t i = 0; i < MR; i++)
+        for (size_t j = 0; j < NR; j++)
+            acc[i][j] = T(0);
+
+    for (size_t p = 0; p < kc; p++) {
+        for (size_t i = 0; i < MR; i++)
+            for (size_t j = 0; j < NR; j++)
+                acc[i][j] += a[i] * b[j];
+        a += MR;
+        b += NR;
+    }
+
+    for (size_t i = 0; i < MR; i++)
+        for (size_t j = 0; j < NR; j++)
+            c[i * ldc + j] += acc[i][j];
+}
+
+/*!
+ * @brief Calcula um bloco mc x nc de C a partir dos painéis já empacotados.
+ *
+ * Blocos de borda (menores que MR x NR) são calculados em um buffer temporário e
+ * apenas a parte válida é somada em C.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T, size_t MR, size_t NR>
+void macro_kernel(size_t mc, size_t nc, size_t kc, const T *a, const T *b, T *C, size_t ldc,
+                  MicroKernel<T> kernel)
+{
+    for (size_t jr = 0; jr < nc; jr += NR) {
+        const size_t nr = std::min(NR, nc - jr);
+        for (size_t ir = 0; ir < mc; ir += MR) {
+            const size_t mr = std::min(MR, mc - ir);
+            T *c = C + ir * ldc + jr;
+
+            if (mr == MR && nr == NR) {
+                kernel(kc, a + ir * kc, b + jr * kc, c, ldc);
+                continue;
+            }
+
+            T borda[MR * NR];
+            std::fill_n(borda, MR * NR, T(0));
+            kernel(kc, a + ir * kc, b + jr * kc, borda, NR);
+            for (size_t i = 0; i < mr; i++)
+                for (size_t j = 0; j < nr; j++)
+                    c[i * ldc + j] += borda[i * NR + j];
+        }
+    }
+}
+
+/*!
+ * @brief Buffer de empacotamento reaproveitado entre chamadas na mesma thread.
+ *
+ * Empresta um buffer `thread_local` (identificado por `Id`); se ele já estiver em uso
+ * nesta thread (chamada reentrante, por exemplo ao executar outra tarefa do pool
+ * enquanto espera), usa um buffer próprio.
+ *
+ * @tparam T Tipo dos elementos.
+ * @tparam Id Identificador do buffer (painel de A ou de B).
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T, int Id>
+class PainelEmpacotado
+{
+  private:
+    struct Cache {
+        std::vector<T> dados;
+        bool ocupado = false;
+    };
+
+    static Cache &cache()
+    {
+        thread_local Cache c;
+        return c;
+    }
+
+    std::vector<T> proprio_;
+    T *dados_;
+    bool emprestado_ = false;
+
+  public:
+    explicit PainelEmpacotado(size_t tamanho)
+    {
+        Cache &c = cache();
+        if (c.ocupado) {
+            proprio_.resize(tamanho);
+            dados_ = proprio_.data();
+            return;
+        }
+
+        c.ocupado = emprestado_ = true;
+        if (c.dados.size() < tamanho)
+            c.dados.resize(tamanho);
+        dados_ = c.dados.data();
+    }
+
+    ~PainelEmpacotado()
+    {
+        if (emprestado_)
+            cache().ocupado = false;
+    }
+
+    PainelEmpacotado(const PainelEmpacotado &) = delete;
+    PainelEmpacotado &operator=(const PainelEmpacotado &) = delete;
+
+    T *data()
+    {
+        return dados_;
+    }
+};
+
+/*!
+ * @brief Driver GEMM blocado: C = alfa * A * B + beta * C (ordem de linha).
+ *
+ * Segue a organização clássica em cinco laços: B é empacotado em painéis kc x nc
+ * (dimensionados para a L2/L3), A em blocos mc x kc (dimensionados para a L2) e o
+ * micro-kernel percorre blocos MR x NR mantidos em registradores. Os buffers de
+ * empacotamento são reutilizados entre chamadas na mesma thread.
+ *
+ * Os blocos de linhas de A (laço `ic`) são distribuídos no pool de threads; cada bloco
+ * escreve linhas distintas de C e acumula na mesma ordem que a versão serial.
+ *
+ * @tparam T Tipo dos elementos.
+ * @tparam MR Linhas do micro-kernel.
+ * @tparam NR Colunas do micro-kernel.
+ * @param kernel Micro-kernel a ser utilizado.
+ * @param mc_max Altura máxima dos blocos de A.
+ * @param kc_max Profundidade máxima dos painéis.
+ * @param nc_max Largura máxima dos painéis de B.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T, size_t MR, size_t NR>
+void gemm_blocado(size_t m, size_t n, size_t k, T alfa, const T *A, size_t lda, const T *B,
+                  size_t ldb, T beta, T *C, size_t ldc, MicroKernel<T> kernel, size_t mc_max,
+                  size_t kc_max, size_t nc_max)
+{
+    escalar_c(m, n, beta, C, ldc);
+
+    if (m == 0 || n == 0 || k == 0 || alfa == T(0))
+        return;
+
+    // Produtos pequenos: empacotar custa mais do que economiza.
+    if (m * n * k <= 32 * 32 * 32) {
+        gemm_simples(m, n, k, alfa, A, lda, B, ldb, C, ldc);
+        return;
+    }
+
+    // Com várias threads, reduz a altura dos blocos de A para gerar trabalho para todas.
+    const size_t t = paralelo::threads();
+    const size_t mc_alvo = t > 1 ? std::min(mc_max, (m + 2 * t - 1) / (2 * t)) : mc_max;
+    const size_t mc_passo = (std::min(std::max(mc_alvo, MR), m) + MR - 1) / MR * MR;
+    const size_t nc_passo = (std::min(nc_max, n) + NR - 1) / NR * NR;
+    const size_t kc_passo = std::min(kc_max, k);
+    const size_t blocos_m = (m + mc_passo - 1) / mc_passo;
+
+    PainelEmpacotado<T, 1> painel_b(kc_passo * nc_passo);
+
+    for (size_t jc = 0; jc < n; jc += nc_passo) {
+        const size_t nc = std::min(nc_passo, n - jc);
+
+        for (size_t pc = 0; pc < k; pc += kc_passo) {
+            const size_t kc = std::min(kc_passo, k - pc);
+            empacotar_b<T, NR>(kc, nc, B + pc * ldb + jc, ldb, painel_b.data());
+
+            paralelo::para(0, blocos_m, mc_passo * nc * kc, [&](size_t inicio, size_t fim) {
+                PainelEmpacotado<T, 0> painel_a(mc_passo * kc_passo);
+                for (size_t bloco = inicio; bloco < fim; bloco++) {
+                    const size_t ic = bloco * mc_passo;
+                    const size_t mc = std::min(mc_passo, m - ic);
+                    empacotar_a<T, MR>(mc, kc, alfa, A + ic * lda + pc, lda, painel_a.data());
+                    macro_kernel<T, MR, NR>(mc, nc, kc, painel_a.data(), painel_b.data(),
+                                            C + ic * ldc + jc, ldc, kernel);
+                }
+            });
+        }
+    }
+}
+
+/*!
+ * @brief GEMM genérico: C = alfa * A * B + beta * C, com A (m x k), B (k x n) e C (m x n).
+ *
+ * Todas as matrizes estão em ordem de linha; lda, ldb e ldc são as distâncias entre
+ * linhas consecutivas. Para `float` e `double` são usadas as sobrecargas não-template,
+ * que podem escolher micro-kernels SIMD.
+ *
+ * @tparam T Tipo dos elementos.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+void gemm(size_t m, size_t n, size_t k, T alfa, const T *A, size_t lda, const T *B, size_t ldb,
+          T beta, T *C, size_t ldc)
+{
+    gemm_blocado<T, 4, 4>(m, n, k, alfa, A, lda, B, ldb, beta, C, ldc,
+                          micro_kernel_generico<T, 4, 4>, 64, 256, 1024);
+}
+
+} // namespace ifnum::detail
@@ -0,0 +1,130 @@
+/*!
+ * @file Instrumentacao.hpp
+ * @brief Instrumentação de baixo custo: cronômetros por ponto de chamada e contadores.
+ *
+ * Com `IFNUM_INSTRUMENTAR=1`, as funções da biblioteca marcadas com `IFNUM_MEDIR` acumulam,
+ * por ponto de chamada, o número de chamadas e o tempo total e máximo, além das operações
+ * de ponto flutuante, dos bytes movidos e das alocações e cópias de `Matriz` feitas
+ * enquanto o ponto estava ativo. Os tempos são inclusivos (uma chamada aninhada também
+ * conta no ponto externo); os contadores vão só para o ponto mais interno.
+ *
+ * Cada thread acumula em seus próprios contadores, sem travas nem instruções atômicas
+ * com lock; `instantaneo()` soma os valores de todas as threads. Com `IFNUM_INSTRUMENTAR=0`
+ * (padrão) as macros não geram código, mas a API de consulta continua disponível (e
+ * retorna tudo zerado).
+ *
+ * @code
+ * IFNUM_MEDIR("minha_funcao");  // cronometra até o fim do escopo
+ * IFNUM_FLOPS(2 * n * n * n);
+ * ...
+ * std::cout << ifnum::debug::instantaneo().json();
+ * @endcode
+ */
+
+#pragma once
+#include "Configuracao.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ifnum::debug
+{
+/*!
+ * @brief Ponto de chamada instrumentado, identificado pelo nome.
+ *
+ * Pontos com o mesmo nome (por exemplo, instâncias diferentes de um template) compartilham
+ * os mesmos contadores. Cabem até 256 nomes distintos; os excedentes não são medidos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+class Ponto
+{
+  private:
+    size_t id_;
+
+  public:
+    explicit Ponto(const char *nome);
+    size_t id() const;
+};
+
+/*!
+ * @brief Cronômetro de escopo: mede do construtor ao destrutor e atribui ao ponto.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+class Cronometro
+{
+  private:
+    size_t id_;
+    size_t anterior_;
+    uint64_t inicio_;
+
+  public:
+    explicit Cronometro(const Ponto &ponto);
+    ~Cronometro();
+    Cronometro(const Cronometro &) = delete;
+    Cronometro &operator=(const Cronometro &) = delete;
+};
+
+void contar_flops(uint64_t quantidade);
+void contar_bytes(uint64_t quantidade);
+void contar_alocacao(uint64_t bytes);
+void contar_copia(uint64_t bytes);
+
+/*!
+ * @brief Estatísticas acumuladas de um ponto de chamada.
+ */
+struct Registro {
+    std::string nome;
+    uint64_t chamadas = 0;
+    uint64_t ns_total = 0;
+    uint64_t ns_max = 0;
+    uint64_t flops = 0;
+    uint64_t bytes = 0;
+    uint64_t alocacoes = 0;
+    uint64_t bytes_alocados = 0;
+    uint64_t copias = 0;
+    uint64_t bytes_copiados = 0;
+};
+
+/*!
+ * @brief Estado agregado (todas as threads) em um instante.
+ *
+ * `pontos` contém só os pontos com alguma atividade; contadores registrados fora de
+ * qualquer cronômetro aparecem no ponto "(fora de medições)". `total` soma os contadores
+ * de todos os pontos (chamadas e tempos não são somados, por serem inclusivos).
+ */
+struct Instantaneo {
+    std::vector<Registro> pontos;
+    Registro total;
+
+    std::string json() const;
+};
+
+Instantaneo instantaneo();
+void zerar();
+
+} // namespace ifnum::debug
+
+#if IFNUM_INSTRUMENTAR
+#define IFNUM_CONCATENAR_(a, b) a##b
+#define IFNUM_CONCATENAR(a, b) IFNUM_CONCATENAR_(a, b)
+/*! @brief Cronometra o restante do escopo atual sob o nome dado. */
+#define IFNUM_MEDIR(nome)                                                                          \
+    static const ::ifnum::debug::Ponto IFNUM_CONCATENAR(ifnum_ponto_, __LINE__)(nome);             \
+    const ::ifnum::debug::Cronometro IFNUM_CONCATENAR(ifnum_cronometro_, __LINE__)(                \
+        IFNUM_CONCATENAR(ifnum_ponto_, __LINE__))
+#define IFNUM_FLOPS(n) ::ifnum::debug::contar_flops(static_cast<uint64_t>(n))
+#define IFNUM_BYTES(n) ::ifnum::debug::contar_bytes(static_cast<uint64_t>(n))
+#define IFNUM_ALOCACAO(bytes) ::ifnum::debug::contar_alocacao(static_cast<uint64_t>(bytes))
+#define IFNUM_COPIA(bytes) ::ifnum::debug::contar_copia(static_cast<uint64_t>(bytes))
+#else
+#define IFNUM_MEDIR(nome) ((void)0)
+#define IFNUM_FLOPS(n) ((void)0)
+#define IFNUM_BYTES(n) ((void)0)
+#define IFNUM_ALOCACAO(bytes) ((void)0)
+#define IFNUM_COPIA(bytes) ((void)0)
+#endif
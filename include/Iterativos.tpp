@@ -0,0 +1,529 @@
+/*!
+ * @file Iterativos.tpp
+ * @brief Implementações dos métodos iterativos e precondicionadores declarados em Iterativos.hpp.
+ */
+
+#ifdef __INTELLISENSE__
+#include "Iterativos.hpp"
+#endif
+
+namespace ifnum
+{
+namespace detail
+{
+/*!
+ * @brief Produto interno de dois vetores de tamanho n, em paralelo.
+ *
+ * Os vetores são divididos em blocos de tamanho fixo, cada um somado por blas::dot, e as
+ * somas parciais são acumuladas em ordem, então o resultado não depende do número de threads.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T produto_interno(const T *a, const T *b, size_t n)
+{
+    constexpr size_t bloco = 4096;
+    if (n <= bloco) // um único bloco: mesma ordem de soma, sem alocar o vetor de parciais
+        return blas::dot(n, a, b);
+    const size_t blocos = (n + bloco - 1) / bloco;
+    std::vector<T> parciais(blocos, T(0));
+    paralelo::para(0, blocos, bloco, [&](size_t inicio, size_t fim) {
+        for (size_t p = inicio; p < fim; p++) {
+            const size_t ultimo = std::min(n, (p + 1) * bloco);
+            parciais[p] = blas::dot(ultimo - p * bloco, a + p * bloco, b + p * bloco);
+        }
+    });
+    T total = 0;
+    for (const T &parcial : parciais)
+        total += parcial;
+    return total;
+}
+
+template <typename T>
+double norma(const std::vector<T> &v)
+{
+    return std::sqrt(static_cast<double>(produto_interno(v.data(), v.data(), v.size())));
+}
+
+/*!
+ * @brief Valida A, b e x0 e retorna o chute inicial (zeros se x0 estiver vazio).
+ *
+ * @throws std::invalid_argument Se A não for quadrada ou as dimensões não baterem.
+ */
+template <typename T>
+std::vector<T> chute_inicial(const MatrizEsparsa<T> &A, const std::vector<T> &b,
+                             const std::vector<T> &x0)
+{
+    if (A.linhas() != A.colunas())
+        throw std::invalid_argument("Matriz não é quadrada.");
+    if (b.size() != A.linhas() || (!x0.empty() && x0.size() != A.linhas()))
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+    return x0.empty() ? std::vector<T>(A.linhas(), T(0)) : x0;
+}
+
+/*!
+ * @brief Referência para A em CSR; converte para `copia` apenas se A estiver em CSC.
+ */
+template <typename T>
+const MatrizEsparsa<T> &como_csr(const MatrizEsparsa<T> &A,
+                                 std::optional<MatrizEsparsa<T>> &copia)
+{
+    if (A.formato() == FormatoEsparso::csr)
+        return A;
+    copia.emplace(A.converter(FormatoEsparso::csr));
+    return *copia;
+}
+
+/*!
+ * @brief Precondicionador escolhido em tempo de execução para os métodos de Krylov.
+ */
+template <typename T>
+class AplicadorPrecondicionador
+{
+  private:
+    std::optional<PrecondicionadorJacobi<T>> jacobi_;
+    std::optional<ILU0<T>> ilu0_;
+    size_t n_;
+
+  public:
+    AplicadorPrecondicionador(const MatrizEsparsa<T> &A, Precondicionador tipo) : n_(A.linhas())
+    {
+        if (tipo == Precondicionador::jacobi)
+            jacobi_.emplace(A);
+        else if (tipo == Precondicionador::ilu0)
+            ilu0_.emplace(A);
+    }
+
+    void aplicar(const T *r, T *z) const
+    {
+        if (jacobi_)
+            jacobi_->aplicar(r, z);
+        else if (ilu0_)
+            ilu0_->aplicar(r, z);
+        else
+            std::copy(r, r + n_, z);
+    }
+};
+} // namespace detail
+
+/*!
+ * @brief Constrói o precondicionador de Jacobi a partir da diagonal de A.
+ *
+ * @throws std::runtime_error Se algum elemento da diagonal for nulo.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+PrecondicionadorJacobi<T>::PrecondicionadorJacobi(const MatrizEsparsa<T> &A)
+    : inversa_diagonal_(A.diagonal())
+{
+    for (T &d : inversa_diagonal_) {
+        if (d == T(0))
+            throw std::runtime_error("Elemento nulo na diagonal.");
+        d = T(1) / d;
+    }
+}
+
+/*!
+ * @brief z = D⁻¹ r.
+ */
+template <typename T>
+void PrecondicionadorJacobi<T>::aplicar(const T *r, T *z) const
+{
+    const size_t n = inversa_diagonal_.size();
+    paralelo::para(0, n, 1, [&](size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++)
+            z[i] = r[i] * inversa_diagonal_[i];
+    });
+}
+
+/*!
+ * @brief Calcula a fatoração ILU(0) de A.
+ *
+ * Eliminação de Gauss linha a linha (variante IKJ) em que só são atualizadas as posições
+ * que já existem em A; o preenchimento é descartado.
+ *
+ * @throws std::invalid_argument Se A não for quadrada.
+ * @throws std::runtime_error Se faltar um elemento da diagonal ou surgir um pivô nulo.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+ILU0<T>::ILU0(const MatrizEsparsa<T> &A) : lu_(A.converter(FormatoEsparso::csr))
+{
+    if (A.linhas() != A.colunas())
+        throw std::invalid_argument("Matriz não é quadrada.");
+
+    const size_t n = lu_.linhas();
+    const std::vector<size_t> &ponteiros = lu_.ponteiros();
+    const std::vector<size_t> &indices = lu_.indices();
+    std::vector<T> &valores = lu_.valores();
+
+    diagonal_.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        const auto inicio = indices.begin() + ponteiros[i];
+        const auto fim = indices.begin() + ponteiros[i + 1];
+        const auto it = std::lower_bound(inicio, fim, i);
+        if (it == fim || *it != i)
+            throw std::runtime_error("Elemento nulo na diagonal.");
+        diagonal_[i] = it - indices.begin();
+    }
+
+    const size_t ausente = static_cast<size_t>(-1);
+    std::vector<size_t> posicao(n, ausente); // posição de cada coluna na linha i
+    for (size_t i = 0; i < n; i++) {
+        for (size_t e = ponteiros[i]; e < ponteiros[i + 1]; e++)
+            posicao[indices[e]] = e;
+
+        for (size_t e = ponteiros[i]; e < diagonal_[i]; e++) {
+            const size_t k = indices[e];
+            valores[e] /= valores[diagonal_[k]];
+            for (size_t f = diagonal_[k] + 1; f < ponteiros[k + 1]; f++) {
+                const size_t destino = posicao[indices[f]];
+                if (destino != ausente)
+                    valores[destino] -= valores[e] * valores[f];
+            }
+        }
+        if (valores[diagonal_[i]] == T(0))
+            throw std::runtime_error("Pivô nulo na fatoração ILU(0).");
+
+        for (size_t e = ponteiros[i]; e < ponteiros[i + 1]; e++)
+            posicao[indices[e]] = ausente;
+    }
+}
+
+/*!
+ * @brief Resolve L U z = r (substituição direta com L unitária e reversa com U).
+ */
+template <typename T>
+void ILU0<T>::aplicar(const T *r, T *z) const
+{
+    const size_t n = lu_.linhas();
+    const std::vector<size_t> &ponteiros = lu_.ponteiros();
+    const std::vector<size_t> &indices = lu_.indices();
+    const std::vector<T> &valores = lu_.valores();
+
+    for (size_t i = 0; i < n; i++) {
+        T soma = r[i];
+        for (size_t e = ponteiros[i]; e < diagonal_[i]; e++)
+            soma -= valores[e] * z[indices[e]];
+        z[i] = soma;
+    }
+    for (size_t i = n; i-- > 0;) {
+        T soma = z[i];
+        for (size_t e = diagonal_[i] + 1; e < ponteiros[i + 1]; e++)
+            soma -= valores[e] * z[indices[e]];
+        z[i] = soma / valores[diagonal_[i]];
+    }
+}
+
+/*!
+ * @brief Resolve A x = b pelo método de Jacobi.
+ *
+ * x ← x + D⁻¹ (b - A x). Converge para matrizes diagonalmente dominantes. Cada iteração
+ * é um produto esparso e uma atualização elemento a elemento, ambos paralelos.
+ *
+ * @param A Matriz quadrada (CSR; CSC é convertida).
+ * @param b Vetor de constantes.
+ * @param tolerancia Resíduo relativo ||b - A x|| / ||b|| aceitável.
+ * @param r Número máximo de iterações.
+ * @param x0 Chute inicial (zeros se vazio).
+ * @return Solução aproximada, iterações, resíduo final e se houve convergência.
+ * @throws std::invalid_argument Se A não for quadrada ou as dimensões não baterem.
+ * @throws std::runtime_error Se algum elemento da diagonal for nulo.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+ResultadoIterativo<T> jacobi(const MatrizEsparsa<T> &A, const std::vector<T> &b,
+                             double tolerancia, int r, const std::vector<T> &x0)
+{
+    ResultadoIterativo<T> res;
+    res.x = detail::chute_inicial(A, b, x0);
+    std::optional<MatrizEsparsa<T>> copia;
+    const MatrizEsparsa<T> &M = detail::como_csr(A, copia);
+    const PrecondicionadorJacobi<T> D(M);
+
+    const size_t n = b.size();
+    const double norma_b = detail::norma(b);
+    if (norma_b == 0) {
+        std::fill(res.x.begin(), res.x.end(), T(0));
+        res.convergiu = true;
+        return res;
+    }
+
+    std::vector<T> residuo(n), correcao(n);
+    M.multiplicar(res.x.data(), residuo.data());
+    for (size_t i = 0; i < n; i++)
+        residuo[i] = b[i] - residuo[i];
+    res.residuo = detail::norma(residuo) / norma_b;
+
+    while (res.residuo > tolerancia && res.iteracoes < r) {
+        D.aplicar(residuo.data(), correcao.data());
+        paralelo::para(0, n, 1, [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++)
+                res.x[i] += correcao[i];
+        });
+        M.multiplicar(res.x.data(), residuo.data());
+        paralelo::para(0, n, 1, [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++)
+                residuo[i] = b[i] - residuo[i];
+        });
+        res.residuo = detail::norma(residuo) / norma_b;
+        res.iteracoes++;
+    }
+    res.convergiu = res.residuo <= tolerancia;
+    return res;
+}
+
+/*!
+ * @brief Resolve A x = b pelo método de Gauss-Seidel.
+ *
+ * Cada varredura usa os valores de x já atualizados na mesma iteração, o que costuma
+ * convergir em cerca de metade das iterações de Jacobi; em compensação, a varredura é
+ * sequencial (só o cálculo do resíduo é paralelo).
+ *
+ * @param A Matriz quadrada (CSR; CSC é convertida).
+ * @param b Vetor de constantes.
+ * @param tolerancia Resíduo relativo ||b - A x|| / ||b|| aceitável.
+ * @param r Número máximo de iterações.
+ * @param x0 Chute inicial (zeros se vazio).
+ * @return Solução aproximada, iterações, resíduo final e se houve convergência.
+ * @throws std::invalid_argument Se A não for quadrada ou as dimensões não baterem.
+ * @throws std::runtime_error Se algum elemento da diagonal for nulo.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+ResultadoIterativo<T> gauss_seidel(const MatrizEsparsa<T> &A, const std::vector<T> &b,
+                                   double tolerancia, int r, const std::vector<T> &x0)
+{
+    ResultadoIterativo<T> res;
+    res.x = detail::chute_inicial(A, b, x0);
+    std::optional<MatrizEsparsa<T>> copia;
+    const MatrizEsparsa<T> &M = detail::como_csr(A, copia);
+
+    const size_t n = b.size();
+    const std::vector<T> diagonal = M.diagonal();
+    for (const T &d : diagonal) {
+        if (d == T(0))
+            throw std::runtime_error("Elemento nulo na diagonal.");
+    }
+
+    const double norma_b = detail::norma(b);
+    if (norma_b == 0) {
+        std::fill(res.x.begin(), res.x.end(), T(0));
+        res.convergiu = true;
+        return res;
+    }
+
+    const std::vector<size_t> &ponteiros = M.ponteiros();
+    const std::vector<size_t> &indices = M.indices();
+    const std::vector<T> &valores = M.valores();
+    std::vector<T> residuo(n);
+
+    auto calcular_residuo = [&] {
+        M.multiplicar(res.x.data(), residuo.data());
+        for (size_t i = 0; i < n; i++)
+            residuo[i] = b[i] - residuo[i];
+        res.residuo = detail::norma(residuo) / norma_b;
+    };
+
+    calcular_residuo();
+    while (res.residuo > tolerancia && res.iteracoes < r) {
+        for (size_t i = 0; i < n; i++) {
+            T soma = b[i];
+            for (size_t e = ponteiros[i]; e < ponteiros[i + 1]; e++) {
+                if (indices[e] != i)
+                    soma -= valores[e] * res.x[indices[e]];
+            }
+            res.x[i] = soma / diagonal[i];
+        }
+        calcular_residuo();
+        res.iteracoes++;
+    }
+    res.convergiu = res.residuo <= tolerancia;
+    return res;
+}
+
+/*!
+ * @brief Resolve A x = b pelo método do Gradiente Conjugado (precondicionado).
+ *
+ * Exige A simétrica positiva definida (e, com ILU(0), um precondicionador também
+ * simétrico na prática, como ocorre para matrizes de difusão). Cada iteração faz um
+ * produto esparso, dois produtos internos e uma aplicação do precondicionador.
+ *
+ * @param A Matriz simétrica positiva definida (CSR; CSC é convertida).
+ * @param b Vetor de constantes.
+ * @param tolerancia Resíduo relativo ||b - A x|| / ||b|| aceitável.
+ * @param r Número máximo de iterações.
+ * @param precondicionador Precondicionador a usar.
+ * @param x0 Chute inicial (zeros se vazio).
+ * @return Solução aproximada, iterações, resíduo final e se houve convergência.
+ * @throws std::invalid_argument Se A não for quadrada ou as dimensões não baterem.
+ * @throws std::runtime_error Se o precondicionador não puder ser construído.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+ResultadoIterativo<T> gradiente_conjugado(const MatrizEsparsa<T> &A, const std::vector<T> &b,
+                                          double tolerancia, int r,
+                                          Precondicionador precondicionador,
+                                          const std::vector<T> &x0)
+{
+    ResultadoIterativo<T> res;
+    res.x = detail::chute_inicial(A, b, x0);
+    std::optional<MatrizEsparsa<T>> copia;
+    const MatrizEsparsa<T> &M = detail::como_csr(A, copia);
+    const detail::AplicadorPrecondicionador<T> P(M, precondicionador);
+
+    const size_t n = b.size();
+    const double norma_b = detail::norma(b);
+    if (norma_b == 0) {
+        std::fill(res.x.begin(), res.x.end(), T(0));
+        res.convergiu = true;
+        return res;
+    }
+
+    std::vector<T> residuo(n), z(n), p(n), q(n);
+    M.multiplicar(res.x.data(), residuo.data());
+    for (size_t i = 0; i < n; i++)
+        residuo[i] = b[i] - residuo[i];
+    res.residuo = detail::norma(residuo) / norma_b;
+
+    P.aplicar(residuo.data(), z.data());
+    p = z;
+    T rz = detail::produto_interno(residuo.data(), z.data(), n);
+
+    while (res.residuo > tolerancia && res.iteracoes < r) {
+        M.multiplicar(p.data(), q.data());
+        const T pq = detail::produto_interno(p.data(), q.data(), n);
+        if (pq == T(0))
+            break;
+        const T alfa = rz / pq;
+        paralelo::para(0, n, 2, [&](size_t inicio, size_t fim) {
+            blas::axpy(fim - inicio, alfa, p.data() + inicio, res.x.data() + inicio);
+            blas::axpy(fim - inicio, -alfa, q.data() + inicio, residuo.data() + inicio);
+        });
+        res.residuo = detail::norma(residuo) / norma_b;
+        res.iteracoes++;
+        if (res.residuo <= tolerancia)
+            break;
+
+        P.aplicar(residuo.data(), z.data());
+        const T rz_novo = detail::produto_interno(residuo.data(), z.data(), n);
+        const T beta = rz_novo / rz;
+        rz = rz_novo;
+        paralelo::para(0, n, 1, [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++)
+                p[i] = z[i] + beta * p[i];
+        });
+    }
+    res.convergiu = res.residuo <= tolerancia;
+    return res;
+}
+
+/*!
+ * @brief Resolve A x = b pelo método BiCGSTAB (precondicionado à direita).
+ *
+ * Serve para matrizes não simétricas. Cada iteração faz dois produtos esparsos e duas
+ * aplicações do precondicionador. Se o método sofrer uma quebra (ρ ou ω nulos), ele para
+ * e retorna a melhor aproximação obtida, com `convergiu == false`.
+ *
+ * @param A Matriz quadrada (CSR; CSC é convertida).
+ * @param b Vetor de constantes.
+ * @param tolerancia Resíduo relativo ||b - A x|| / ||b|| aceitável.
+ * @param r Número máximo de iterações.
+ * @param precondicionador Precondicionador a usar.
+ * @param x0 Chute inicial (zeros se vazio).
+ * @return Solução aproximada, iterações, resíduo final e se houve convergência.
+ * @throws std::invalid_argument Se A não for quadrada ou as dimensões não baterem.
+ * @throws std::runtime_error Se o precondicionador não puder ser construído.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+ResultadoIterativo<T> bicgstab(const MatrizEsparsa<T> &A, const std::vector<T> &b,
+                               double tolerancia, int r, Precondicionador precondicionador,
+                               const std::vector<T> &x0)
+{
+    ResultadoIterativo<T> res;
+    res.x = detail::chute_inicial(A, b, x0);
+    std::optional<MatrizEsparsa<T>> copia;
+    const MatrizEsparsa<T> &M = detail::como_csr(A, copia);
+    const detail::AplicadorPrecondicionador<T> P(M, precondicionador);
+
+    const size_t n = b.size();
+    const double norma_b = detail::norma(b);
+    if (norma_b == 0) {
+        std::fill(res.x.begin(), res.x.end(), T(0));
+        res.convergiu = true;
+        return res;
+    }
+
+    std::vector<T> residuo(n), sombra(n), p(n, T(0)), v(n, T(0)), p_chapeu(n), s(n),
+        s_chapeu(n), t(n);
+    M.multiplicar(res.x.data(), residuo.data());
+    for (size_t i = 0; i < n; i++)
+        residuo[i] = b[i] - residuo[i];
+    sombra = residuo;
+    res.residuo = detail::norma(residuo) / norma_b;
+
+    T rho = 1, alfa = 1, omega = 1;
+    while (res.residuo > tolerancia && res.iteracoes < r) {
+        const T rho_novo = detail::produto_interno(sombra.data(), residuo.data(), n);
+        if (rho_novo == T(0))
+            break;
+        const T beta = (rho_novo / rho) * (alfa / omega);
+        rho = rho_novo;
+        paralelo::para(0, n, 2, [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++)
+                p[i] = residuo[i] + beta * (p[i] - omega * v[i]);
+        });
+
+        P.aplicar(p.data(), p_chapeu.data());
+        M.multiplicar(p_chapeu.data(), v.data());
+        const T sv = detail::produto_interno(sombra.data(), v.data(), n);
+        if (sv == T(0))
+            break;
+        alfa = rho / sv;
+        paralelo::para(0, n, 1, [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++)
+                s[i] = residuo[i] - alfa * v[i];
+        });
+
+        res.iteracoes++;
+        const double norma_s = detail::norma(s) / norma_b;
+        if (norma_s <= tolerancia) {
+            for (size_t i = 0; i < n; i++)
+                res.x[i] += alfa * p_chapeu[i];
+            res.residuo = norma_s;
+            break;
+        }
+
+        P.aplicar(s.data(), s_chapeu.data());
+        M.multiplicar(s_chapeu.data(), t.data());
+        const T tt = detail::produto_interno(t.data(), t.data(), n);
+        omega = tt == T(0) ? T(0) : detail::produto_interno(t.data(), s.data(), n) / tt;
+        paralelo::para(0, n, 3, [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++) {
+                res.x[i] += alfa * p_chapeu[i] + omega * s_chapeu[i];
+                residuo[i] = s[i] - omega * t[i];
+            }
+        });
+        res.residuo = detail::norma(residuo) / norma_b;
+        if (omega == T(0))
+            break;
+    }
+    res.convergiu = res.residuo <= tolerancia;
+    return res;
+}
+
+} // namespace ifnum
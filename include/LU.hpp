@@ -0,0 +1,91 @@
+/*!
+ * @file LU.hpp
+ * @brief Declaração da classe template LU (fatoração LU reutilizável).
+ *
+ * A fatoração é feita uma única vez e pode então resolver qualquer quantidade de sistemas
+ * com a mesma matriz de coeficientes, em O(n²) por vetor do lado direito.
+ */
+
+#pragma once
+#include "Matriz.hpp"
+#include <utility>
+#include <vector>
+
+namespace ifnum
+{
+/*!
+ * @brief Estratégia de pivotamento da fatoração LU.
+ */
+enum class Pivotamento {
+    parcial,  //!< Troca apenas linhas (busca na coluna). Versão blocada, padrão.
+    completo, //!< Troca linhas e colunas (busca na submatriz inteira).
+};
+
+/*!
+ * @brief Fatoração LU com pivotamento: P * A * Q = L * U.
+ *
+ * L (triangular inferior com diagonal unitária) e U (triangular superior) ficam
+ * empacotadas em uma única matriz n x n. As permutações P e Q são guardadas como vetores
+ * de índices, e não como matrizes densas.
+ *
+ * Com pivotamento parcial (padrão), a fatoração é blocada e "right-looking": cada painel
+ * de colunas é fatorado, a faixa de U à direita é resolvida e o restante da matriz é
+ * atualizado com o kernel GEMM. Uma matriz singular não lança exceção na fatoração;
+ * ela é marcada (ver singular()) e `resolver` lança exceção.
+ *
+ * Refatorar (`fatorar`) reaproveita a memória, e `resolver` com destino não aloca. Criada
+ * com uma Arena, a fatoração também tira dela o seu espaço de trabalho e não chama o malloc.
+ *
+ * @tparam T Tipo dos elementos (ponto flutuante).
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+class LU
+{
+  public:
+    using Permutacao = std::vector<size_t, AlocadorArena<size_t>>;
+
+  private:
+    size_t n_ = 0;
+    std::vector<T, AlocadorArena<T>> lu_;
+    Permutacao perm_linhas_;
+    Permutacao perm_colunas_;
+    int sinal_ = 1;
+    bool singular_ = false;
+    Pivotamento pivotamento_;
+
+    static constexpr size_t bloco_ = 64;
+
+    void eliminar_painel_(size_t k0, size_t kb);
+    void fatorar_parcial_();
+    void fatorar_completo_();
+
+  public:
+    explicit LU(const Matriz<T> &A, Pivotamento pivotamento = Pivotamento::parcial);
+    explicit LU(const ConstMatrizView<T> &A, Pivotamento pivotamento = Pivotamento::parcial);
+    LU(const ConstMatrizView<T> &A, Arena &area, Pivotamento pivotamento = Pivotamento::parcial);
+
+    void fatorar(const Matriz<T> &A);
+    void fatorar(const ConstMatrizView<T> &A);
+
+    size_t ordem() const;
+    bool singular() const;
+    Pivotamento pivotamento() const;
+    const Permutacao &permutacao_linhas() const;
+    const Permutacao &permutacao_colunas() const;
+
+    Matriz<T> L() const;
+    Matriz<T> U() const;
+    T determinante() const;
+
+    Matriz<T> resolver(const Matriz<T> &b) const;
+    Matriz<T> resolver(const ConstMatrizView<T> &b) const;
+    void resolver(const ConstMatrizView<T> &b, const MatrizView<T> &x) const;
+    void resolver(const T *b, T *x) const;
+};
+
+} // namespace ifnum
+
+#include "LU.tpp"
@@ -0,0 +1,588 @@
+/*!
+ * @file LU.tpp
+ * @brief Implementação da classe template LU declarada em LU.hpp.
+ */
+
+#ifdef __INTELLISENSE__
+#include "LU.hpp"
+#endif
+
+namespace ifnum
+{
+/*!
+ * @brief Fatora a matriz A.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Matriz quadrada a ser fatorada.
+ * @param pivotamento Estratégia de pivotamento (parcial por padrão).
+ * @throws std::invalid_argument Se a matriz não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+LU<T>::LU(const Matriz<T> &A, Pivotamento pivotamento) : pivotamento_(pivotamento)
+{
+    fatorar(A.visao());
+}
+
+/*!
+ * @brief Fatora a matriz vista por A (um bloco de outra matriz ou um buffer externo).
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Visão quadrada a ser fatorada; os dados não são alterados.
+ * @param pivotamento Estratégia de pivotamento (parcial por padrão).
+ * @throws std::invalid_argument Se a visão não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+LU<T>::LU(const ConstMatrizView<T> &A, Pivotamento pivotamento) : pivotamento_(pivotamento)
+{
+    fatorar(A);
+}
+
+/*!
+ * @brief Fatora A com o espaço de trabalho (fatores e permutações) tirado de uma arena.
+ *
+ * O objeto não pode ser usado depois que a arena for zerada.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Visão quadrada a ser fatorada; os dados não são alterados.
+ * @param area Arena de onde vem a memória.
+ * @param pivotamento Estratégia de pivotamento (parcial por padrão).
+ * @throws std::invalid_argument Se a visão não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+LU<T>::LU(const ConstMatrizView<T> &A, Arena &area, Pivotamento pivotamento)
+    : lu_(AlocadorArena<T>(area)), perm_linhas_(AlocadorArena<size_t>(area)),
+      perm_colunas_(AlocadorArena<size_t>(area)), pivotamento_(pivotamento)
+{
+    fatorar(A);
+}
+
+/*!
+ * @brief Refatora com uma nova matriz, reaproveitando a memória já alocada.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Matriz quadrada a ser fatorada.
+ * @throws std::invalid_argument Se a matriz não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+void LU<T>::fatorar(const Matriz<T> &A)
+{
+    fatorar(A.visao());
+}
+
+/*!
+ * @brief Refatora a partir de uma visão, reaproveitando a memória já alocada.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Visão quadrada a ser fatorada.
+ * @throws std::invalid_argument Se a visão não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void LU<T>::fatorar(const ConstMatrizView<T> &A)
+{
+    if (A.linhas() != A.colunas())
+        throw std::invalid_argument("Matriz não é quadrada.");
+
+    IFNUM_MEDIR("LU::fatorar");
+    IFNUM_FLOPS(2 * A.linhas() * A.linhas() * A.linhas() / 3);
+    IFNUM_BYTES(2 * sizeof(T) * A.linhas() * A.linhas());
+    if (lu_.capacity() < A.linhas() * A.linhas() && !lu_.get_allocator().arena())
+        IFNUM_ALOCACAO(sizeof(T) * A.linhas() * A.linhas());
+
+    n_ = A.linhas();
+    lu_.resize(n_ * n_);
+    perm_linhas_.resize(n_);
+    perm_colunas_.resize(n_);
+    sinal_ = 1;
+    singular_ = false;
+
+    for (size_t i = 0; i < n_; i++) {
+        perm_linhas_[i] = perm_colunas_[i] = i;
+        for (size_t j = 0; j < n_; j++)
+            lu_[i * n_ + j] = A.elemento(i, j);
+    }
+
+    if (pivotamento_ == Pivotamento::completo)
+        fatorar_completo_();
+    else
+        fatorar_parcial_();
+}
+
+/*!
+ * @brief Fatora o painel de colunas [k0, k0 + kb) com pivotamento parcial.
+ *
+ * As trocas de linha são aplicadas às linhas inteiras (inclusive à parte de L já
+ * calculada e às colunas à direita do painel). A eliminação só atualiza as colunas
+ * do próprio painel; o restante é atualizado em bloco por fatorar_parcial_().
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+void LU<T>::eliminar_painel_(size_t k0, size_t kb)
+{
+    const size_t n = n_;
+    const size_t fim_painel = k0 + kb;
+    T *a = lu_.data();
+
+    for (size_t k = k0; k < fim_painel; k++) {
+        size_t p = k;
+        T maior = std::abs(a[k * n + k]);
+        for (size_t i = k + 1; i < n; i++) {
+            if (std::abs(a[i * n + k]) > maior) {
+                maior = std::abs(a[i * n + k]);
+                p = i;
+            }
+        }
+
+        if (maior == T(0)) {
+            singular_ = true;
+            continue;
+        }
+
+        if (p != k) {
+            // Linhas são contíguas: a troca é uma única cópia de n elementos.
+            std::swap_ranges(a + k * n, a + (k + 1) * n, a + p * n);
+            std::swap(perm_linhas_[k], perm_linhas_[p]);
+            sinal_ = -sinal_;
+        }
+
+        const T pivo = a[k * n + k];
+        const T *lk = a + k * n;
+        paralelo::para(k + 1, n, fim_painel - k, [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++) {
+                T *li = a + i * n;
+                li[k] /= pivo;
+                const T fator = li[k];
+                for (size_t j = k + 1; j < fim_painel; j++)
+                    li[j] -= fator * lk[j];
+            }
+        });
+    }
+}
+
+/*!
+ * @brief Fatoração blocada com pivotamento parcial (variante right-looking).
+ *
+ * Para cada painel de `bloco_` colunas: fatora o painel, resolve U12 = L11⁻¹ A12 e
+ * atualiza A22 -= L21 * U12 com o kernel GEMM (que concentra quase todo o trabalho).
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+void LU<T>::fatorar_parcial_()
+{
+    const size_t n = n_;
+    T *a = lu_.data();
+
+    for (size_t k0 = 0; k0 < n; k0 += bloco_) {
+        const size_t kb = std::min(bloco_, n - k0);
+        const size_t k1 = k0 + kb;
+        eliminar_painel_(k0, kb);
+
+        if (k1 >= n)
+            break;
+
+        // U12 = L11⁻¹ * A12 (L11 unitária); colunas independentes entre si.
+        paralelo::para(k1, n, kb * kb, [&](size_t inicio, size_t fim) {
+            for (size_t k = k0; k < k1; k++) {
+                const T *lk = a + k * n;
+                for (size_t i = k + 1; i < k1; i++) {
+                    T *li = a + i * n;
+                    const T fator = li[k];
+                    for (size_t j = inicio; j < fim; j++)
+                        li[j] -= fator * lk[j];
+                }
+            }
+        });
+
+        // A22 -= L21 * U12
+        const size_t resto = n - k1;
+        detail::gemm(resto, resto, kb, T(-1), a + k1 * n + k0, n, a + k0 * n + k1, n, T(1),
+                     a + k1 * n + k1, n);
+    }
+}
+
+/*!
+ * @brief Fatoração com pivotamento completo (troca de linhas e colunas).
+ *
+ * Mais estável para matrizes mal condicionadas, mas exige uma busca O(n²) por passo e
+ * trocas de colunas com acesso espaçado; por isso não é blocada.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+void LU<T>::fatorar_completo_()
+{
+    const size_t n = n_;
+    T *a = lu_.data();
+
+    for (size_t k = 0; k < n; k++) {
+        size_t p = k, q = k;
+        T maior = T(0);
+        for (size_t i = k; i < n; i++) {
+            for (size_t j = k; j < n; j++) {
+                if (std::abs(a[i * n + j]) > maior) {
+                    maior = std::abs(a[i * n + j]);
+                    p = i;
+                    q = j;
+                }
+            }
+        }
+
+        if (maior == T(0)) {
+            singular_ = true;
+            return; // Toda a submatriz restante é nula.
+        }
+
+        if (p != k) {
+            std::swap_ranges(a + k * n, a + (k + 1) * n, a + p * n);
+            std::swap(perm_linhas_[k], perm_linhas_[p]);
+            sinal_ = -sinal_;
+        }
+
+        if (q != k) {
+            for (size_t i = 0; i < n; i++)
+                std::swap(a[i * n + k], a[i * n + q]);
+            std::swap(perm_colunas_[k], perm_colunas_[q]);
+            sinal_ = -sinal_;
+        }
+
+        const T pivo = a[k * n + k];
+        const T *lk = a + k * n;
+        paralelo::para(k + 1, n, n - k, [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++) {
+                T *li = a + i * n;
+                li[k] /= pivo;
+                const T fator = li[k];
+                for (size_t j = k + 1; j < n; j++)
+                    li[j] -= fator * lk[j];
+            }
+        });
+    }
+}
+
+/*!
+ * @brief Retorna a ordem n da matriz fatorada.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+size_t LU<T>::ordem() const
+{
+    return n_;
+}
+
+/*!
+ * @brief Indica se algum pivô nulo foi encontrado durante a fatoração.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+bool LU<T>::singular() const
+{
+    return singular_;
+}
+
+/*!
+ * @brief Retorna a estratégia de pivotamento usada.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+Pivotamento LU<T>::pivotamento() const
+{
+    return pivotamento_;
+}
+
+/*!
+ * @brief Permutação de linhas: a linha i de P * A é a linha `permutacao_linhas()[i]` de A.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+const typename LU<T>::Permutacao &LU<T>::permutacao_linhas() const
+{
+    return perm_linhas_;
+}
+
+/*!
+ * @brief Permutação de colunas: a coluna j de A * Q é a coluna `permutacao_colunas()[j]` de A.
+ *
+ * Com pivotamento parcial, é sempre a identidade.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+const typename LU<T>::Permutacao &LU<T>::permutacao_colunas() const
+{
+    return perm_colunas_;
+}
+
+/*!
+ * @brief Retorna L (triangular inferior, diagonal unitária) como uma nova Matriz.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+Matriz<T> LU<T>::L() const
+{
+    Matriz<T> L(n_, n_);
+    for (size_t i = 0; i < n_; i++) {
+        for (size_t j = 0; j < i; j++)
+            L.elemento(i, j) = lu_[i * n_ + j];
+        L.elemento(i, i) = T(1);
+    }
+    return L;
+}
+
+/*!
+ * @brief Retorna U (triangular superior) como uma nova Matriz.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+Matriz<T> LU<T>::U() const
+{
+    Matriz<T> U(n_, n_);
+    for (size_t i = 0; i < n_; i++)
+        for (size_t j = i; j < n_; j++)
+            U.elemento(i, j) = lu_[i * n_ + j];
+    return U;
+}
+
+/*!
+ * @brief Determinante de A, pelo produto da diagonal de U e pela paridade das permutações.
+ *
+ * @return Determinante (zero se a matriz for singular).
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+T LU<T>::determinante() const
+{
+    if (singular_)
+        return T(0);
+
+    T det = static_cast<T>(sinal_);
+    for (size_t i = 0; i < n_; i++)
+        det *= lu_[i * n_ + i];
+
+    return det;
+}
+
+/*!
+ * @brief Resolve A * X = B para um ou mais lados direitos.
+ *
+ * Cada coluna de B é um lado direito. Aplica a permutação de linhas (O(n)), as
+ * substituições direta (L) e reversa (U), em O(n²) por coluna, e a permutação de colunas.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param b Matriz n x m com os lados direitos.
+ * @return Matriz n x m com as soluções.
+ * @throws std::invalid_argument Se b não tiver n linhas.
+ * @throws std::runtime_error Se a matriz for singular.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T>
+Matriz<T> LU<T>::resolver(const Matriz<T> &b) const
+{
+    return resolver(b.visao());
+}
+
+/*!
+ * @brief Resolve A * X = B com os lados direitos dados por uma visão (ex.: colunas de
+ *        uma matriz maior), sem copiá-los antes.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param b Visão n x m com os lados direitos.
+ * @return Matriz n x m com as soluções.
+ * @throws std::invalid_argument Se b não tiver n linhas.
+ * @throws std::runtime_error Se a matriz for singular.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> LU<T>::resolver(const ConstMatrizView<T> &b) const
+{
+    if (b.linhas() != n_)
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+
+    Matriz<T> x(n_, b.colunas());
+    resolver(b, x.visao());
+    return x;
+}
+
+/*!
+ * @brief Resolve A * X = B escrevendo as soluções em uma visão existente, sem alocar.
+ *
+ * As substituições são feitas no próprio destino, linha a linha em todas as colunas, e a
+ * permutação de colunas (pivotamento completo) é aplicada trocando as linhas de x ao longo
+ * de cada ciclo. x não pode se sobrepor a b.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param b Visão n x m com os lados direitos.
+ * @param x Visão n x m que recebe as soluções.
+ * @throws std::invalid_argument Se b ou x não tiverem n linhas, ou se as colunas diferirem.
+ * @throws std::runtime_error Se a matriz for singular.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void LU<T>::resolver(const ConstMatrizView<T> &b, const MatrizView<T> &x) const
+{
+    if (b.linhas() != n_ || x.linhas() != n_ || x.colunas() != b.colunas())
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+
+    if (singular_)
+        throw std::runtime_error("Matriz singular");
+
+    IFNUM_MEDIR("LU::resolver");
+    IFNUM_FLOPS(2 * n_ * n_ * b.colunas());
+    IFNUM_BYTES(sizeof(T) * (n_ * n_ + 2 * n_ * b.colunas()));
+    const size_t n = n_;
+    const size_t m = b.colunas();
+    const T *a = lu_.data();
+    T *y = x.data();
+    const size_t pl = x.passo_linha();
+
+    // pc é uma constante de compilação no caso comum (colunas contíguas), para vetorizar
+    auto substituir = [&](auto pc) {
+        // y = P * b
+        for (size_t i = 0; i < n; i++)
+            for (size_t c = 0; c < m; c++)
+                y[i * pl + c * pc] = b.elemento(perm_linhas_[i], c);
+
+        // L * z = y (diagonal unitária) e depois U * w = z
+        for (size_t i = 0; i < n; i++) {
+            T *yi = y + i * pl;
+            for (size_t k = 0; k < i; k++) {
+                const T fator = a[i * n + k];
+                const T *yk = y + k * pl;
+                for (size_t c = 0; c < m; c++)
+                    yi[c * pc] -= fator * yk[c * pc];
+            }
+        }
+
+        for (size_t i = n; i-- > 0;) {
+            T *yi = y + i * pl;
+            for (size_t k = i + 1; k < n; k++) {
+                const T fator = a[i * n + k];
+                const T *yk = y + k * pl;
+                for (size_t c = 0; c < m; c++)
+                    yi[c * pc] -= fator * yk[c * pc];
+            }
+            const T pivo = a[i * n + i];
+            for (size_t c = 0; c < m; c++)
+                yi[c * pc] /= pivo;
+        }
+    };
+    if (x.passo_coluna() == 1)
+        substituir(std::integral_constant<size_t, 1>());
+    else
+        substituir(x.passo_coluna());
+
+    if (pivotamento_ != Pivotamento::completo)
+        return;
+
+    // x = Q * w: a linha `inicio` carrega os valores ao longo do ciclo (ver a versão por
+    // ponteiro)
+    for (size_t inicio = 0; inicio < n; inicio++) {
+        size_t j = perm_colunas_[inicio];
+        while (j > inicio)
+            j = perm_colunas_[j];
+        if (j < inicio)
+            continue;
+
+        for (j = perm_colunas_[inicio]; j != inicio; j = perm_colunas_[j])
+            x.trocar_linhas(inicio, j);
+    }
+}
+
+/*!
+ * @brief Resolve A * x = b para um único lado direito, sem alocar memória.
+ *
+ * Versão para laços que resolvem o mesmo sistema muitas vezes (ex.: iteração inversa).
+ * O resultado é escrito em x, que deve ter n elementos e não pode se sobrepor a b.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param b Lado direito (n elementos).
+ * @param x Saída (n elementos).
+ * @throws std::runtime_error Se a matriz for singular.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void LU<T>::resolver(const T *b, T *x) const
+{
+    if (singular_)
+        throw std::runtime_error("Matriz singular");
+
+    IFNUM_MEDIR("LU::resolver");
+    IFNUM_FLOPS(2 * n_ * n_);
+    IFNUM_BYTES(sizeof(T) * (n_ * n_ + 2 * n_));
+    const size_t n = n_;
+    const T *a = lu_.data();
+
+    for (size_t i = 0; i < n; i++) {
+        T soma = b[perm_linhas_[i]];
+        for (size_t k = 0; k < i; k++)
+            soma -= a[i * n + k] * x[k];
+        x[i] = soma;
+    }
+    for (size_t i = n; i-- > 0;) {
+        T soma = x[i];
+        for (size_t k = i + 1; k < n; k++)
+            soma -= a[i * n + k] * x[k];
+        x[i] = soma / a[i * n + i];
+    }
+
+    if (pivotamento_ != Pivotamento::completo)
+        return;
+
+    // x = Q * w no próprio vetor: percorre cada ciclo da permutação a partir do seu menor
+    // índice, levando w[j] para a posição perm_colunas_[j].
+    for (size_t inicio = 0; inicio < n; inicio++) {
+        size_t j = perm_colunas_[inicio];
+        while (j > inicio)
+            j = perm_colunas_[j];
+        if (j < inicio)
+            continue;
+
+        T levado = x[inicio];
+        for (j = perm_colunas_[inicio]; j != inicio; j = perm_colunas_[j])
+            std::swap(levado, x[j]);
+        x[inicio] = levado;
+    }
+}
+
+} // namespace ifnum
@@ -0,0 +1,92 @@
+/*!
+ * @file Lote.hpp
+ * @brief Resolução em lote de muitos sistemas lineares pequenos e independentes.
+ *
+ * Para milhões de sistemas de ordem 3 a 8 (um por pixel, por partícula...), criar uma
+ * Matriz e chamar `gauss` ou `resolverLU` em cada um custa alocações e código escalar.
+ * `resolver_lote` recebe os sistemas em estrutura de vetores (SoA): o coeficiente (i, j)
+ * de todos os sistemas fica contíguo, de modo que a eliminação processa um sistema por
+ * faixa SIMD e os blocos de sistemas são divididos entre as threads.
+ *
+ * Layout, para o sistema s (0 <= s < quantidade) e passo >= quantidade:
+ *
+ *     A[(i * ordem + j) * passo + s]   coeficiente (i, j)
+ *     b[i * passo + s]                 termo independente i
+ *     x[i * passo + s]                 incógnita i (saída; pode ser o próprio b)
+ *
+ * Um sistema singular não lança exceção: recebe a marca em `singular[s]` e tem a solução
+ * preenchida com NaN, sem afetar os demais.
+ */
+
+#pragma once
+#include "Alocador.hpp"
+#include "Matriz.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace ifnum
+{
+namespace detail
+{
+size_t resolver_lote(size_t ordem, size_t quantidade, size_t passo, const double *A,
+                     const double *b, double *x, uint8_t *singular, bool pivotar,
+                     double tolerancia);
+size_t resolver_lote(size_t ordem, size_t quantidade, size_t passo, const float *A,
+                     const float *b, float *x, uint8_t *singular, bool pivotar,
+                     float tolerancia);
+} // namespace detail
+
+template <typename T>
+size_t resolver_lote(size_t ordem, size_t quantidade, size_t passo, const T *A, const T *b,
+                     T *x, uint8_t *singular = nullptr, bool pivotar = true, T tolerancia = T(0));
+
+/*!
+ * @brief Lote de sistemas lineares de mesma ordem, já no layout SoA de resolver_lote.
+ *
+ * Os vetores de cada coeficiente começam em endereços alinhados a 64 bytes (o passo é a
+ * quantidade arredondada para uma linha de cache). Os sistemas podem ser preenchidos um a
+ * um (`a`, `b`, `definir`) ou, mais rápido, coeficiente a coeficiente (`coeficientes`,
+ * `termos`).
+ *
+ * @tparam T float ou double.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+class LoteSistemas
+{
+  private:
+    size_t ordem_;
+    size_t quantidade_;
+    size_t passo_;
+    std::vector<T, AlocadorAlinhado<T>> A_;
+    std::vector<T, AlocadorAlinhado<T>> b_;
+    std::vector<T, AlocadorAlinhado<T>> x_;
+    std::vector<uint8_t> singular_;
+
+  public:
+    LoteSistemas(size_t ordem, size_t quantidade);
+
+    size_t ordem() const;
+    size_t quantidade() const;
+    size_t passo() const;
+
+    T &a(size_t sistema, size_t linha, size_t coluna);
+    T &b(size_t sistema, size_t linha);
+    T x(size_t sistema, size_t linha) const;
+    bool singular(size_t sistema) const;
+
+    T *coeficientes(size_t linha, size_t coluna);
+    T *termos(size_t linha);
+    const T *incognitas(size_t linha) const;
+
+    void definir(size_t sistema, const ConstMatrizView<T> &A, const ConstMatrizView<T> &b);
+    Matriz<T> solucao(size_t sistema) const;
+
+    size_t resolver(bool pivotar = true, T tolerancia = T(0));
+};
+
+} // namespace ifnum
+
+#include "Lote.tpp"
@@ -0,0 +1,188 @@
+/*!
+ * @file Lote.tpp
+ * @brief Implementação das partes template da resolução em lote (ver Lote.hpp).
+ */
+
+#ifdef __INTELLISENSE__
+#include "Lote.hpp"
+#endif
+
+namespace ifnum
+{
+/*!
+ * @brief Resolve `quantidade` sistemas lineares de ordem `ordem` em layout SoA.
+ *
+ * Eliminação de Gauss com pivotamento parcial (por sistema) ou sem pivotamento, com um
+ * sistema por faixa SIMD. Ordens até 8 usam kernels desenrolados. Sistemas com algum
+ * pivô de módulo menor ou igual a `tolerancia` (ou NaN) são marcados como singulares e
+ * têm a solução preenchida com NaN.
+ *
+ * @tparam T float ou double.
+ * @param ordem Ordem dos sistemas.
+ * @param quantidade Número de sistemas.
+ * @param passo Distância, em elementos, entre os vetores de coeficientes consecutivos.
+ * @param A Coeficientes, `ordem * ordem * passo` elementos (não é alterado).
+ * @param b Termos independentes, `ordem * passo` elementos.
+ * @param x Saída, `ordem * passo` elementos; pode coincidir com `b`.
+ * @param singular Marcas por sistema (1 = singular), ou nulo.
+ * @param pivotar Se falso, usa os pivôs da diagonal (mais rápido, menos estável).
+ * @param tolerancia Menor módulo aceito para um pivô.
+ * @return Número de sistemas singulares.
+ * @throws std::invalid_argument Se `passo` for menor que `quantidade`.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+size_t resolver_lote(size_t ordem, size_t quantidade, size_t passo, const T *A, const T *b,
+                     T *x, uint8_t *singular, bool pivotar, T tolerancia)
+{
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                  "resolver_lote só está disponível para float e double.");
+    if (passo < quantidade)
+        throw std::invalid_argument("Passo do lote menor que a quantidade de sistemas.");
+    IFNUM_MEDIR("resolver_lote");
+    IFNUM_FLOPS(quantidade * (2 * ordem * ordem * ordem / 3 + 2 * ordem * ordem));
+    IFNUM_BYTES(quantidade * (ordem * ordem + 2 * ordem) * sizeof(T));
+
+    return detail::resolver_lote(ordem, quantidade, passo, A, b, x, singular, pivotar,
+                                 tolerancia);
+}
+
+/*!
+ * @brief Cria um lote de `quantidade` sistemas de ordem `ordem`, todos zerados.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+LoteSistemas<T>::LoteSistemas(size_t ordem, size_t quantidade)
+    : ordem_(ordem), quantidade_(quantidade)
+{
+    constexpr size_t linha_cache = alinhamento_padrao / sizeof(T);
+    passo_ = (quantidade + linha_cache - 1) / linha_cache * linha_cache;
+    A_.assign(ordem * ordem * passo_, T(0));
+    b_.assign(ordem * passo_, T(0));
+    x_.assign(ordem * passo_, T(0));
+    singular_.assign(quantidade, 0);
+}
+
+template <typename T>
+size_t LoteSistemas<T>::ordem() const
+{
+    return ordem_;
+}
+
+template <typename T>
+size_t LoteSistemas<T>::quantidade() const
+{
+    return quantidade_;
+}
+
+/*! @brief Distância entre os vetores de coeficientes (quantidade arredondada). */
+template <typename T>
+size_t LoteSistemas<T>::passo() const
+{
+    return passo_;
+}
+
+/*! @brief Coeficiente (linha, coluna) do sistema `sistema`. */
+template <typename T>
+T &LoteSistemas<T>::a(size_t sistema, size_t linha, size_t coluna)
+{
+    return A_[(linha * ordem_ + coluna) * passo_ + sistema];
+}
+
+/*! @brief Termo independente `linha` do sistema `sistema`. */
+template <typename T>
+T &LoteSistemas<T>::b(size_t sistema, size_t linha)
+{
+    return b_[linha * passo_ + sistema];
+}
+
+/*! @brief Incógnita `linha` do sistema `sistema`, após resolver(). */
+template <typename T>
+T LoteSistemas<T>::x(size_t sistema, size_t linha) const
+{
+    return x_[linha * passo_ + sistema];
+}
+
+/*! @brief Se o sistema foi marcado como singular no último resolver(). */
+template <typename T>
+bool LoteSistemas<T>::singular(size_t sistema) const
+{
+    return singular_[sistema] != 0;
+}
+
+/*! @brief Coeficiente (linha, coluna) de todos os sistemas, em sequência. */
+template <typename T>
+T *LoteSistemas<T>::coeficientes(size_t linha, size_t coluna)
+{
+    return A_.data() + (linha * ordem_ + coluna) * passo_;
+}
+
+/*! @brief Termo independente `linha` de todos os sistemas, em sequência. */
+template <typename T>
+T *LoteSistemas<T>::termos(size_t linha)
+{
+    return b_.data() + linha * passo_;
+}
+
+/*! @brief Incógnita `linha` de todos os sistemas, em sequência. */
+template <typename T>
+const T *LoteSistemas<T>::incognitas(size_t linha) const
+{
+    return x_.data() + linha * passo_;
+}
+
+/*!
+ * @brief Copia o sistema A x = b para a posição `sistema` do lote.
+ *
+ * @throws std::invalid_argument Se A não for quadrada da ordem do lote ou se b não for um
+ *         vetor coluna compatível.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void LoteSistemas<T>::definir(size_t sistema, const ConstMatrizView<T> &A,
+                              const ConstMatrizView<T> &b)
+{
+    if (A.linhas() != ordem_ || A.colunas() != ordem_)
+        throw std::invalid_argument("Matriz não é quadrada.");
+    if (b.linhas() != ordem_ || b.colunas() != 1)
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+
+    for (size_t i = 0; i < ordem_; i++) {
+        for (size_t j = 0; j < ordem_; j++)
+            a(sistema, i, j) = A.elemento(i, j);
+        this->b(sistema, i) = b.elemento(i, 0);
+    }
+}
+
+/*! @brief Solução do sistema `sistema` como vetor coluna. */
+template <typename T>
+Matriz<T> LoteSistemas<T>::solucao(size_t sistema) const
+{
+    Matriz<T> resultado(ordem_, 1);
+    for (size_t i = 0; i < ordem_; i++)
+        resultado(i, 0) = x(sistema, i);
+    return resultado;
+}
+
+/*!
+ * @brief Resolve todos os sistemas do lote (ver resolver_lote).
+ *
+ * @return Número de sistemas singulares.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+size_t LoteSistemas<T>::resolver(bool pivotar, T tolerancia)
+{
+    return resolver_lote(ordem_, quantidade_, passo_, A_.data(), b_.data(), x_.data(),
+                         singular_.data(), pivotar, tolerancia);
+}
+
+} // namespace ifnum
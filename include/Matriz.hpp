@@ -7,23 +7,44 @@
  */
 
 #pragma once
+#include "Alocador.hpp"
+#include "Blas1.hpp"
+#include "Configuracao.hpp"
+#include "Expressao.hpp"
+#include "Gemm.hpp"
+#include "Instrumentacao.hpp"
+#include "MatrizView.hpp"
+#include "Paralelo.hpp"
 #include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace ifnum
 {
+template <typename T>
+class LU;
+
 /*!
  * @brief Classe genérica para representação e manipulação de matrizes.
  *
  * Suporta operações matemáticas, transformações e utilitários com sintaxe intuitiva
- * por meio de sobrecarga de operadores e métodos auxiliares.
+ * por meio de sobrecarga de operadores e métodos auxiliares. As operações elemento a
+ * elemento (`+`, `-`, `*` e `/` por escalar) são avaliadas de forma preguiçosa, por
+ * templates de expressão (ver Expressao.hpp). Linhas, colunas, blocos e a transposta
+ * também podem ser acessados sem cópia, por visões (ver MatrizView.hpp).
+ *
+ * Os elementos ficam em um buffer contíguo, em ordem de linha, obtido de `Alloc`: por padrão
+ * AlocadorAlinhado (endereço múltiplo de 64 bytes), ou AlocadorArena para tirar a memória de
+ * uma Arena (ver MatrizArena). As funções livres da biblioteca recebem `Matriz<T>` ou visões;
+ * matrizes com outro alocador são passadas por `visao()`.
  *
  * @tparam T Tipo dos elementos da matriz (ex: int, float, double).
+ * @tparam Alloc Alocador do buffer (padrão: AlocadorAlinhado<T>).
  *
  * @author Samuel Veras
  * @author Lucas Andrei
@@ -32,56 +53,112 @@ namespace ifnum
  * @author Giovani Zanella
  * @date Março de 2025
  */
-template <typename T>
-class Matriz
+template <typename T, typename Alloc>
+class Matriz : public ExpressaoMatriz<Matriz<T, Alloc>>
 {
   private:
     size_t linhas_;
     size_t colunas_;
-    std::vector<T> matriz_;
+    std::vector<T, Alloc> matriz_;
 
     T sarrus_() const;
+    void contar_alocacao_(size_t elementos) const;
 
   public:
-    Matriz(size_t linhas, size_t colunas, const std::vector<T> &dados);
-    Matriz(size_t linhas, size_t colunas);
+    using valor_tipo = T;
+    using alocador_tipo = Alloc;
+
+    Matriz(size_t linhas, size_t colunas, const std::vector<T> &dados,
+           const Alloc &alocador = Alloc());
+    Matriz(size_t linhas, size_t colunas, const Alloc &alocador = Alloc());
+    template <typename E>
+    Matriz(const ExpressaoMatriz<E> &expressao, const Alloc &alocador = Alloc());
+    Matriz(const Matriz &outra);
+    Matriz(Matriz &&outra) noexcept = default;
+    Matriz &operator=(const Matriz &outra);
+    Matriz &operator=(Matriz &&outra) noexcept = default;
 
     size_t linhas() const;
     size_t colunas() const;
     std::vector<T> vector() const;
+    T *data();
+    const T *data() const;
+    Alloc alocador() const;
 
     void imprimir() const;
     T determinante() const;
     T modulo() const;
-    Matriz<T> transposta() const;
-    double autovalor(const Matriz<T> &other, double tolerancia, int r) const;
+    Matriz transposta() const;
+    double autovalor(const Matriz &other, double tolerancia, int r) const;
+
+    Matriz linha(int indice) const;
+    Matriz coluna(int indice) const;
+
+    MatrizView<T> visao();
+    ConstMatrizView<T> visao() const;
+    MatrizView<T> visao_linha(size_t indice);
+    ConstMatrizView<T> visao_linha(size_t indice) const;
+    MatrizView<T> visao_coluna(size_t indice);
+    ConstMatrizView<T> visao_coluna(size_t indice) const;
+    MatrizView<T> bloco(size_t linha, size_t coluna, size_t linhas, size_t colunas);
+    ConstMatrizView<T> bloco(size_t linha, size_t coluna, size_t linhas, size_t colunas) const;
+    MatrizView<T> visao_transposta();
+    ConstMatrizView<T> visao_transposta() const;
+    operator MatrizView<T>();
+    operator ConstMatrizView<T>() const;
 
-    Matriz<T> linha(int indice) const;
-    Matriz<T> coluna(int indice) const;
     void redimensionar(int linhas, int colunas);
     void trocar_linhas(int indice1, int indice2);
     void trocar_colunas(int indice1, int indice2);
 
-    T operator()(int linha, int coluna) const;
-    T &operator()(int linha, int coluna);
-    Matriz<T> operator-() const;
-    Matriz<T> operator+(const Matriz<T> &outro) const;
-    Matriz<T> operator-(const Matriz<T> &outro) const;
-    Matriz<T> operator*(const Matriz<T> &outro) const;
-    Matriz<T> operator*(T escalar) const;
-    Matriz<T> operator/(T escalar) const;
-    Matriz<T> &operator+=(const Matriz<T> &outro);
-    Matriz<T> &operator-=(const Matriz<T> &outro);
-    Matriz<T> &operator*=(T escalar);
-    Matriz<T> &operator/=(T escalar);
-    bool operator==(const Matriz<T> &outro) const;
-    bool operator!=(const Matriz<T> &outro) const;
-
-    template <typename U>
-    friend std::ostream &operator<<(std::ostream &os, const Matriz<U> &u);
+    T &elemento(size_t linha, size_t coluna) noexcept(!detail::checado);
+    const T &elemento(size_t linha, size_t coluna) const noexcept(!detail::checado);
     template <typename U>
-    friend Matriz<U> operator*(U escalar, const Matriz<U> &matriz);
+    bool conflita(const ConstMatrizView<U> &destino) const;
+
+    T operator()(int linha, int coluna) const noexcept(!detail::checado);
+    T &operator()(int linha, int coluna) noexcept(!detail::checado);
+    template <typename E>
+    Matriz &operator=(const ExpressaoMatriz<E> &expressao);
+    template <typename E>
+    Matriz &operator+=(const ExpressaoMatriz<E> &expressao);
+    template <typename E>
+    Matriz &operator-=(const ExpressaoMatriz<E> &expressao);
+    Matriz &operator*=(T escalar);
+    Matriz &operator/=(T escalar);
+    bool operator==(const Matriz &outro) const;
+    bool operator!=(const Matriz &outro) const;
+
+    template <typename U, typename A>
+    friend std::ostream &operator<<(std::ostream &os, const Matriz<U, A> &u);
 };
+
+/*!
+ * @brief Matriz cujo buffer vem de uma Arena: `MatrizArena<double> m(linhas, colunas, area)`.
+ *
+ * Não pode ser usada depois que a arena for zerada (ou restaurada a uma marca anterior).
+ */
+template <typename T>
+using MatrizArena = Matriz<T, AlocadorArena<T>>;
+
+namespace detail
+{
+/*! @brief Impede a dedução de T a partir de um parâmetro (conversões implícitas valem). */
+template <typename T>
+struct identidade {
+    using tipo = T;
+};
+} // namespace detail
+
+template <typename T>
+void gemm(Matriz<T> &C, T alfa, const Matriz<T> &A, const Matriz<T> &B, T beta);
+
+template <typename T>
+void gemm(typename detail::identidade<MatrizView<T>>::tipo C, T alfa,
+          typename detail::identidade<ConstMatrizView<T>>::tipo A,
+          typename detail::identidade<ConstMatrizView<T>>::tipo B, T beta);
+
 } // namespace ifnum
 
-#include "Matriz.tpp"
\ No newline at end of file
+#include "Matriz.tpp"
+#include "LU.hpp"
\ No newline at end of file
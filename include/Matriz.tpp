@@ -23,21 +23,35 @@ namespace ifnum
  * @author Samuel Veras
  * @date 20/03/2025
  */
-template <typename T>
-T Matriz<T>::sarrus_() const
+template <typename T, typename Alloc>
+T Matriz<T, Alloc>::sarrus_() const
 {
-    auto m = this;
+    const T *m = matriz_.data();
     if (linhas_ == 2)
-        return (*m)(0, 0) * (*m)(1, 1) - (*m)(0, 1) * (*m)(1, 0);
+        return m[0] * m[3] - m[1] * m[2];
 
     if (linhas_ == 3)
-        return (*m)(0, 0) * (*m)(1, 1) * (*m)(2, 2) + (*m)(0, 1) * (*m)(1, 2) * (*m)(2, 0) +
-               (*m)(0, 2) * (*m)(1, 0) * (*m)(2, 1) - (*m)(0, 2) * (*m)(1, 1) * (*m)(2, 0) -
-               (*m)(0, 0) * (*m)(1, 2) * (*m)(2, 1) - (*m)(0, 1) * (*m)(1, 0) * (*m)(2, 2);
+        return m[0] * m[4] * m[8] + m[1] * m[5] * m[6] + m[2] * m[3] * m[7] -
+               m[2] * m[4] * m[6] - m[0] * m[5] * m[7] - m[1] * m[3] * m[8];
 
     return 0; // matrix 0x0?
 }
 
+/*!
+ * @brief Registra na instrumentação (IFNUM_INSTRUMENTAR) uma alocação do buffer.
+ *
+ * Buffers tirados de uma Arena não contam: a arena registra os seus próprios blocos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+void Matriz<T, Alloc>::contar_alocacao_([[maybe_unused]] size_t elementos) const
+{
+    if (detail::usa_heap(matriz_.get_allocator()))
+        IFNUM_ALOCACAO(elementos * sizeof(T));
+}
+
 /*!
  * @brief Construtor da matriz com dados iniciais.
  *
@@ -48,14 +62,17 @@ T Matriz<T>::sarrus_() const
  * @param linhas Número de linhas da matriz.
  * @param colunas Número de colunas da matriz.
  * @param dados Vetor com os elementos a serem copiados para a matriz.
+ * @param alocador Alocador do buffer (ex.: uma Arena, com MatrizArena).
  *
  * @author Samuel Veras
  * @date 27/02/2025
  */
-template <typename T>
-Matriz<T>::Matriz(size_t linhas, size_t colunas, const std::vector<T> &dados)
-    : linhas_(linhas), colunas_(colunas), matriz_(linhas * colunas)
+template <typename T, typename Alloc>
+Matriz<T, Alloc>::Matriz(size_t linhas, size_t colunas, const std::vector<T> &dados,
+                         const Alloc &alocador)
+    : linhas_(linhas), colunas_(colunas), matriz_(linhas * colunas, alocador)
 {
+    contar_alocacao_(matriz_.size());
     size_t count = std::min(matriz_.size(), dados.size());
     std::copy_n(dados.begin(), count, matriz_.begin());
 }
@@ -69,14 +86,91 @@ Matriz<T>::Matriz(size_t linhas, size_t colunas, const std::vector<T> &dados)
  * @tparam T Tipo dos elementos da matriz.
  * @param linhas Número de linhas da matriz.
  * @param colunas Número de colunas da matriz.
+ * @param alocador Alocador do buffer (ex.: uma Arena, com MatrizArena).
  *
  * @author Samuel Veras
  * @date 27/02/2025
  */
-template <typename T>
-Matriz<T>::Matriz(size_t linhas, size_t colunas)
-    : linhas_(linhas), colunas_(colunas), matriz_(linhas * colunas, 0)
+template <typename T, typename Alloc>
+Matriz<T, Alloc>::Matriz(size_t linhas, size_t colunas, const Alloc &alocador)
+    : linhas_(linhas), colunas_(colunas), matriz_(linhas * colunas, T(0), alocador)
+{
+    contar_alocacao_(matriz_.size());
+}
+
+/*!
+ * @brief Construtor a partir de uma expressão matricial.
+ *
+ * Avalia a expressão (por exemplo `A * 2.0 + B - C`) em um único laço, com uma única
+ * alocação para o resultado.
+ *
+ * @tparam T Tipo dos elementos da matriz.
+ * @tparam E Tipo da expressão.
+ * @param expressao Expressão a ser avaliada.
+ * @param alocador Alocador do buffer (ex.: uma Arena, com MatrizArena).
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename T, typename Alloc>
+template <typename E>
+Matriz<T, Alloc>::Matriz(const ExpressaoMatriz<E> &expressao, const Alloc &alocador)
+    : linhas_(expressao.derivada().linhas()), colunas_(expressao.derivada().colunas()),
+      matriz_(linhas_ * colunas_, alocador)
+{
+    contar_alocacao_(matriz_.size());
+    const E &e = expressao.derivada();
+
+    paralelo::para(0, linhas_, colunas_, [&](size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++)
+            for (size_t j = 0; j < colunas_; j++)
+                matriz_[i * colunas_ + j] = e.elemento(i, j);
+    });
+}
+
+/*!
+ * @brief Construtor de cópia.
+ *
+ * Definido explicitamente para que a instrumentação (IFNUM_INSTRUMENTAR) conte a alocação
+ * e a cópia; o comportamento é o da cópia membro a membro.
+ *
+ * @tparam T Tipo dos elementos da matriz.
+ * @param outra Matriz copiada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+Matriz<T, Alloc>::Matriz(const Matriz &outra)
+    : ExpressaoMatriz<Matriz<T, Alloc>>(), linhas_(outra.linhas_), colunas_(outra.colunas_),
+      matriz_(outra.matriz_)
 {
+    contar_alocacao_(matriz_.size());
+    IFNUM_COPIA(matriz_.size() * sizeof(T));
+}
+
+/*!
+ * @brief Atribuição por cópia; reaproveita o buffer quando ele já tem capacidade.
+ *
+ * @tparam T Tipo dos elementos da matriz.
+ * @param outra Matriz copiada.
+ * @return Referência para esta matriz.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+Matriz<T, Alloc> &Matriz<T, Alloc>::operator=(const Matriz &outra)
+{
+    if (this == &outra)
+        return *this;
+    if (matriz_.capacity() < outra.matriz_.size())
+        contar_alocacao_(outra.matriz_.size());
+    IFNUM_COPIA(outra.matriz_.size() * sizeof(T));
+    linhas_ = outra.linhas_;
+    colunas_ = outra.colunas_;
+    matriz_ = outra.matriz_;
+    return *this;
 }
 
 /*!
@@ -88,8 +182,8 @@ Matriz<T>::Matriz(size_t linhas, size_t colunas)
  * @author Samuel Veras
  * @date 27/02/2025
  */
-template <typename T>
-inline size_t Matriz<T>::linhas() const
+template <typename T, typename Alloc>
+inline size_t Matriz<T, Alloc>::linhas() const
 {
     return this->linhas_;
 }
@@ -103,8 +197,8 @@ inline size_t Matriz<T>::linhas() const
  * @author Samuel Veras
  * @date 27/02/2025
  */
-template <typename T>
-inline size_t Matriz<T>::colunas() const
+template <typename T, typename Alloc>
+inline size_t Matriz<T, Alloc>::colunas() const
 {
     return this->colunas_;
 }
@@ -120,10 +214,56 @@ inline size_t Matriz<T>::colunas() const
  * @author Samuel Veras
  * @date 27/03/2025
  */
-template <typename T>
-inline std::vector<T> Matriz<T>::vector() const
+template <typename T, typename Alloc>
+inline std::vector<T> Matriz<T, Alloc>::vector() const
+{
+    return std::vector<T>(matriz_.begin(), matriz_.end());
+}
+
+/*!
+ * @brief Ponteiro para o primeiro elemento do buffer interno (ordem de linha).
+ *
+ * O elemento (i, j) fica em `data()[i * colunas() + j]`. Com o alocador padrão, o endereço é
+ * múltiplo de 64 bytes. O ponteiro deixa de ser válido quando a matriz é redimensionada ou
+ * recebe uma expressão de outra ordem.
+ *
+ * @tparam T Tipo dos elementos da matriz.
+ * @return Ponteiro para os dados, sem cópia.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+inline T *Matriz<T, Alloc>::data()
 {
-    return matriz_;
+    return matriz_.data();
+}
+
+/*!
+ * @brief Ponteiro somente leitura para o primeiro elemento do buffer interno.
+ *
+ * @tparam T Tipo dos elementos da matriz.
+ * @return Ponteiro constante para os dados, sem cópia.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+inline const T *Matriz<T, Alloc>::data() const
+{
+    return matriz_.data();
+}
+
+/*!
+ * @brief Cópia do alocador do buffer (por exemplo, para criar temporários na mesma arena).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+Alloc Matriz<T, Alloc>::alocador() const
+{
+    return matriz_.get_allocator();
 }
 
 /*!
@@ -136,8 +276,8 @@ inline std::vector<T> Matriz<T>::vector() const
  * @author Samuel Veras
  * @date 27/02/2025
  */
-template <typename T>
-void Matriz<T>::imprimir() const
+template <typename T, typename Alloc>
+void Matriz<T, Alloc>::imprimir() const
 {
     std::cout << (*this) << std::endl;
 }
@@ -145,8 +285,9 @@ void Matriz<T>::imprimir() const
 /*!
  * @brief Calcula o determinante da matriz.
  *
- * Utiliza a regra de Sarrus para matrizes de ordem até 3. Para ordens maiores, 
- * a funcionalidade ainda não está implementada.
+ * Utiliza a regra de Sarrus para matrizes de ordem até 3. Para ordens maiores, usa a
+ * fatoração LU com pivotamento parcial (ver LU.hpp). Para tipos inteiros, a fatoração é
+ * feita em double e o resultado é arredondado.
  *
  * @tparam T Tipo dos elementos da matriz.
  * @return Determinante da matriz.
@@ -155,23 +296,25 @@ void Matriz<T>::imprimir() const
  * @author Samuel Veras
  * @date 15/03/2025
  */
-template <typename T>
-T Matriz<T>::determinante() const
+template <typename T, typename Alloc>
+T Matriz<T, Alloc>::determinante() const
 {
     if (colunas_ != linhas_)
         throw std::invalid_argument("Matriz não é quadrada.");
 
     if (linhas_ == 1)
-        return (*this)(0, 0);
+        return matriz_[0];
 
     if (linhas_ <= 3)
         return sarrus_();
 
-    T det = 0;
-
-    // TO-DO
-
-    return det;
+    using Real = std::conditional_t<std::is_integral_v<T>, double, T>;
+    if constexpr (std::is_integral_v<T>) {
+        Matriz<Real> copia(linhas_, colunas_, std::vector<Real>(matriz_.begin(), matriz_.end()));
+        return static_cast<T>(std::llround(LU<Real>(copia).determinante()));
+    } else {
+        return LU<Real>(*this).determinante();
+    }
 }
 
 /*!
@@ -186,19 +329,23 @@ T Matriz<T>::determinante() const
  * @author Lucas Andrei
  * @date 27/02/2025
  */
-template <typename T>
-T Matriz<T>::modulo() const // Calcula a norma de um vetor.
+template <typename T, typename Alloc>
+T Matriz<T, Alloc>::modulo() const // Calcula a norma de um vetor.
 {
     if (colunas_ != 1) {
         throw std::invalid_argument("A matriz não é um vetor coluna.");
     }
 
-    T soma_quadrados = 0;
-    for (size_t i = 0; i < linhas_; ++i) {
-        soma_quadrados += (*this)(i, 0) * (*this)(i, 0); // Soma dos quadrados dos elementos
-    }
+    if constexpr (std::is_floating_point_v<T>) {
+        return blas::nrm2(linhas_, matriz_.data());
+    } else {
+        T soma_quadrados = 0;
+        for (size_t i = 0; i < linhas_; ++i) {
+            soma_quadrados += matriz_[i] * matriz_[i]; // Soma dos quadrados dos elementos
+        }
 
-    return std::sqrt(soma_quadrados); // Retorna a raiz quadrada da soma
+        return std::sqrt(soma_quadrados); // Retorna a raiz quadrada da soma
+    }
 }
 
 /*!
@@ -212,15 +359,18 @@ T Matriz<T>::modulo() const // Calcula a norma de um vetor.
  * @author Lucas Andrei
  * @date 27/02/2025
  */
-template <typename T>
-Matriz<T> Matriz<T>::transposta() const // Troca a matriz lxc para cxl.
+template <typename T, typename Alloc>
+Matriz<T, Alloc> Matriz<T, Alloc>::transposta() const // Troca a matriz lxc para cxl.
 {
-    Matriz<T> novo(this->colunas_, this->linhas_);
-    for (size_t i = 0; i < this->linhas_; i++) {
-        for (size_t j = 0; j < this->colunas_; j++) {
-            novo(j, i) = (*this)(i, j);
-        }
-    }
+    Matriz novo(this->colunas_, this->linhas_, matriz_.get_allocator());
+
+    // Percorre blocos de linhas em paralelo; cada bloco escreve colunas distintas de `novo`.
+    paralelo::para(0, linhas_, colunas_, [&](size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++)
+            for (size_t j = 0; j < colunas_; j++)
+                novo.matriz_[j * linhas_ + i] = matriz_[i * colunas_ + j];
+    });
+
     return novo;
 }
 
@@ -228,6 +378,9 @@ Matriz<T> Matriz<T>::transposta() const // Troca a matriz lxc para cxl.
  * @brief Calcula um autovalor da matriz utilizando o método do poder com normalização.
  *
  * Recebe um vetor inicial e itera até atingir a tolerância especificada ou o número máximo de repetições.
+ * Os dois vetores de trabalho são alocados uma única vez; cada iteração faz um produto
+ * matriz-vetor (por linhas contíguas, sem montar a transposta) e uma norma. Para deslocamento,
+ * iteração inversa e o espectro completo, veja a classe Autovalores.
  *
  * @tparam T Tipo dos elementos da matriz.
  * @param other Vetor inicial (deve ser um vetor coluna com dimensões compatíveis).
@@ -240,8 +393,8 @@ Matriz<T> Matriz<T>::transposta() const // Troca a matriz lxc para cxl.
  * @author Lucas Andrei
  * @date 27/02/2025
  */
-template <typename T>
-double Matriz<T>::autovalor(const Matriz<T> &other, double tolerancia, int r) const
+template <typename T, typename Alloc>
+double Matriz<T, Alloc>::autovalor(const Matriz &other, double tolerancia, int r) const
 {
     if (colunas_ != linhas_)
         throw std::invalid_argument("Matriz deve ser quadrada.");
@@ -251,33 +404,64 @@ double Matriz<T>::autovalor(const Matriz<T> &other, double tolerancia, int r) co
                                     "coluna com a mesma quantidade "
                                     "de linhas da matriz.");
 
-    Matriz<T> v = other;
-    Matriz<T> v2(linhas_, 1);
-    Matriz<T> transposta = this->transposta();
+    const size_t n = linhas_;
+    const T *a = matriz_.data();
+    std::vector<T> v(other.matriz_.begin(), other.matriz_.end());
+    std::vector<T> v2(n);
+
+    auto modulo = [n](const std::vector<T> &x) -> T {
+        if constexpr (std::is_floating_point_v<T>) {
+            return blas::nrm2(n, x.data());
+        } else {
+            T soma = 0;
+            for (const T &xk : x)
+                soma += xk * xk;
+            return std::sqrt(soma);
+        }
+    };
+    T modulo_v = modulo(v);
 
     double erro = tolerancia + 1; // Garantir entrada no loop
     int i = 0;
 
     while (erro > tolerancia && i < r) {
-        v2 = transposta * v;
-
-        double modulo_v = v.modulo();
-        double modulo_v2 = v2.modulo();
+        // v2 = transposta * v = soma de v[k] * linha k; cada thread cuida de uma faixa de colunas
+        paralelo::para(0, n, n, [&](size_t inicio, size_t fim) {
+            std::fill(v2.begin() + inicio, v2.begin() + fim, T(0));
+            for (size_t k = 0; k < n; k++) {
+                const T vk = v[k];
+                const T *linha = a + k * n;
+                for (size_t j = inicio; j < fim; j++)
+                    v2[j] += vk * linha[j];
+            }
+        });
+
+        const T modulo_v2 = modulo(v2);
         erro = std::abs(modulo_v2 - modulo_v);
 
-        v = v2 / modulo_v2; // Normaliza o vetor para evitar crescimento
-                            // descontrolado
+        // Normaliza o vetor para evitar crescimento descontrolado
+        for (size_t k = 0; k < n; k++)
+            v[k] = v2[k] / modulo_v2;
+        modulo_v = 1;
         i++;
     }
 
-    // Cálculo do autovalor final
-    Matriz<T> produto = v.transposta() * (*this) * v;
-    Matriz<T> denominador = v.transposta() * v;
+    // Cálculo do autovalor final: quociente de Rayleigh vᵀ A v / vᵀ v
+    T produto = 0;
+    T denominador = 0;
+    for (size_t k = 0; k < n; k++) {
+        const T *linha = a + k * n;
+        T av = 0;
+        for (size_t j = 0; j < n; j++)
+            av += linha[j] * v[j];
+        produto += v[k] * av;
+        denominador += v[k] * v[k];
+    }
 
-    if (denominador(0, 0) == 0)
+    if (denominador == 0)
         throw std::runtime_error("Denominador zero, impossibilitando o cálculo do autovalor.");
 
-    return produto(0, 0) / denominador(0, 0);
+    return produto / denominador;
 }
 
 /*!
@@ -293,20 +477,14 @@ double Matriz<T>::autovalor(const Matriz<T> &other, double tolerancia, int r) co
  * @author Samuel Veras
  * @date 27/02/2025
  */
-template <typename T>
-Matriz<T> Matriz<T>::linha(int indice) const
+template <typename T, typename Alloc>
+Matriz<T, Alloc> Matriz<T, Alloc>::linha(int indice) const
 {
     if (indice < 0)
         throw std::out_of_range("Índice deve ser maior ou igual a zero.");
 
-    if ((size_t)indice >= linhas_)
-        throw std::out_of_range("Índice de linha fora dos limites.");
-
-    std::vector<T> nova_linha(&matriz_[indice * colunas_], &matriz_[(indice + 1) * colunas_]);
-
-    Matriz<T> novo(1, colunas_, nova_linha); // Nova matriz com ordem 1xn
-
-    return novo;
+    // Nova matriz com ordem 1xn
+    return Matriz(visao_linha(static_cast<size_t>(indice)), matriz_.get_allocator());
 }
 
 /*!
@@ -322,21 +500,176 @@ Matriz<T> Matriz<T>::linha(int indice) const
  * @author Samuel Veras
  * @date 27/02/2025
  */
-template <typename T>
-Matriz<T> Matriz<T>::coluna(int indice) const
+template <typename T, typename Alloc>
+Matriz<T, Alloc> Matriz<T, Alloc>::coluna(int indice) const
 {
     if (indice < 0)
         throw std::out_of_range("Índice deve ser maior ou igual a zero.");
 
-    if ((size_t)indice >= linhas_)
-        throw std::out_of_range("Índice de coluna fora dos limites.");
+    // Nova matriz com ordem nx1
+    return Matriz(visao_coluna(static_cast<size_t>(indice)), matriz_.get_allocator());
+}
 
-    std::vector<T> nova_coluna(colunas_);
-    for (size_t i = 0; i < linhas_; i++)
-        nova_coluna[i] = matriz_[i * colunas_ + indice];
+/*!
+ * @brief Visão de toda a matriz, sem cópia.
+ *
+ * @tparam T Tipo dos elementos da matriz.
+ * @return Visão com escrita sobre os elementos desta matriz.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+MatrizView<T> Matriz<T, Alloc>::visao()
+{
+    return MatrizView<T>(matriz_.data(), linhas_, colunas_, colunas_);
+}
 
-    Matriz<T> novo(linhas_, 1, nova_coluna); // Nova matriz com ordem nx1
-    return novo;
+/*!
+ * @brief Visão somente leitura de toda a matriz, sem cópia.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+ConstMatrizView<T> Matriz<T, Alloc>::visao() const
+{
+    return ConstMatrizView<T>(matriz_.data(), linhas_, colunas_, colunas_);
+}
+
+/*!
+ * @brief Visão da linha `indice` (1 x colunas), sem cópia.
+ *
+ * @throws std::out_of_range Se o índice estiver fora dos limites.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+MatrizView<T> Matriz<T, Alloc>::visao_linha(size_t indice)
+{
+    return visao().linha(indice);
+}
+
+/*!
+ * @brief Visão somente leitura da linha `indice`, sem cópia.
+ *
+ * @throws std::out_of_range Se o índice estiver fora dos limites.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+ConstMatrizView<T> Matriz<T, Alloc>::visao_linha(size_t indice) const
+{
+    return visao().linha(indice);
+}
+
+/*!
+ * @brief Visão da coluna `indice` (linhas x 1), sem cópia.
+ *
+ * Os elementos da coluna ficam espaçados de colunas() no buffer.
+ *
+ * @throws std::out_of_range Se o índice estiver fora dos limites.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+MatrizView<T> Matriz<T, Alloc>::visao_coluna(size_t indice)
+{
+    return visao().coluna(indice);
+}
+
+/*!
+ * @brief Visão somente leitura da coluna `indice`, sem cópia.
+ *
+ * @throws std::out_of_range Se o índice estiver fora dos limites.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+ConstMatrizView<T> Matriz<T, Alloc>::visao_coluna(size_t indice) const
+{
+    return visao().coluna(indice);
+}
+
+/*!
+ * @brief Visão da submatriz de ordem linhas x colunas que começa em (linha, coluna).
+ *
+ * @throws std::out_of_range Se o bloco ultrapassar os limites da matriz.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+MatrizView<T> Matriz<T, Alloc>::bloco(size_t linha, size_t coluna, size_t linhas, size_t colunas)
+{
+    return visao().bloco(linha, coluna, linhas, colunas);
+}
+
+/*!
+ * @brief Visão somente leitura de uma submatriz.
+ *
+ * @throws std::out_of_range Se o bloco ultrapassar os limites da matriz.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+ConstMatrizView<T> Matriz<T, Alloc>::bloco(size_t linha, size_t coluna, size_t linhas,
+                                    size_t colunas) const
+{
+    return visao().bloco(linha, coluna, linhas, colunas);
+}
+
+/*!
+ * @brief Visão transposta, sem cópia (ao contrário de transposta()).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+MatrizView<T> Matriz<T, Alloc>::visao_transposta()
+{
+    return visao().transposta();
+}
+
+/*!
+ * @brief Visão transposta somente leitura, sem cópia.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+ConstMatrizView<T> Matriz<T, Alloc>::visao_transposta() const
+{
+    return visao().transposta();
+}
+
+/*!
+ * @brief Converte implicitamente a matriz em uma visão, para funções que recebem visões.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+Matriz<T, Alloc>::operator MatrizView<T>()
+{
+    return visao();
+}
+
+/*!
+ * @brief Converte implicitamente a matriz em uma visão somente leitura.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, typename Alloc>
+Matriz<T, Alloc>::operator ConstMatrizView<T>() const
+{
+    return visao();
 }
 
 /*!
@@ -353,8 +686,8 @@ Matriz<T> Matriz<T>::coluna(int indice) const
  * @author Samuel Veras
  * @date 13/03/2025
  */
-template <typename T>
-void Matriz<T>::redimensionar(int linhas, int colunas)
+template <typename T, typename Alloc>
+void Matriz<T, Alloc>::redimensionar(int linhas, int colunas)
 {
     if (linhas < 0 || colunas < 0)
         throw std::invalid_argument("Valores devem ser positivos.");
@@ -423,8 +756,8 @@ void Matriz<T>::redimensionar(int linhas, int colunas)
  * @author Samuel Veras
  * @date 20/03/2025
  */
-template <typename T>
-void Matriz<T>::trocar_linhas(int indice1, int indice2)
+template <typename T, typename Alloc>
+void Matriz<T, Alloc>::trocar_linhas(int indice1, int indice2)
 {
     if (indice1 < 0 || indice2 < 0)
         throw std::out_of_range("Índice/s de linha negativo/s.");
@@ -451,8 +784,8 @@ void Matriz<T>::trocar_linhas(int indice1, int indice2)
  * @author Samuel Veras
  * @date 20/03/2025
  */
-template <typename T>
-void Matriz<T>::trocar_colunas(int indice1, int indice2)
+template <typename T, typename Alloc>
+void Matriz<T, Alloc>::trocar_colunas(int indice1, int indice2)
 {
 
     if (indice1 < 0 || indice2 < 0)
@@ -466,263 +799,240 @@ void Matriz<T>::trocar_colunas(int indice1, int indice2)
 }
 
 /*!
- * @brief Acesso de leitura a um elemento da matriz.
+ * @brief Acesso de escrita a um elemento, com índices `size_t`.
  *
- * Retorna o valor na posição especificada da matriz.
+ * Usado pelos templates de expressão e pelos kernels internos. Só verifica os limites
+ * quando IFNUM_CHECKED está ativo (ver Configuracao.hpp); caso contrário é `noexcept` e
+ * não tem nenhum desvio, o que permite vetorizar os laços que o usam.
  *
  * @tparam T Tipo dos elementos da matriz.
  * @param linha Índice da linha (inicia em 0).
  * @param coluna Índice da coluna (inicia em 0).
- * @return Valor do elemento na posição (linha, coluna).
- * @throws std::out_of_range Se os índices forem negativos ou estiverem fora dos limites.
+ * @return Referência ao elemento na posição (linha, coluna).
+ * @throws std::out_of_range Se IFNUM_CHECKED estiver ativo e os índices forem inválidos.
  *
  * @author Samuel Veras
- * @date 27/02/2025
+ * @date 17/10/2026
  */
-template <typename T>
-T Matriz<T>::operator()(int linha, int coluna) const
+template <typename T, typename Alloc>
+inline T &Matriz<T, Alloc>::elemento(size_t linha, size_t coluna) noexcept(!detail::checado)
 {
-    if (linha < 0 || coluna < 0)
-        throw std::out_of_range("Índices negativos.");
-
-    if ((size_t)linha >= linhas_ || (size_t)coluna >= colunas_)
-        throw std::out_of_range("Índices fora dos limites da matriz.");
+    if constexpr (detail::checado) {
+        if (linha >= linhas_ || coluna >= colunas_)
+            throw std::out_of_range("Índices fora dos limites da matriz.");
+    }
 
     return matriz_[linha * colunas_ + coluna];
 }
 
 /*!
- * @brief Acesso de escrita a um elemento da matriz.
+ * @brief Acesso de leitura a um elemento, com índices `size_t`.
  *
- * Retorna uma referência ao valor na posição especificada da matriz.
+ * Mesma política de verificação da versão de escrita (ver IFNUM_CHECKED).
  *
  * @tparam T Tipo dos elementos da matriz.
  * @param linha Índice da linha (inicia em 0).
  * @param coluna Índice da coluna (inicia em 0).
- * @return Referência ao elemento na posição (linha, coluna).
- * @throws std::out_of_range Se os índices forem negativos ou estiverem fora dos limites.
+ * @return Referência constante ao elemento na posição (linha, coluna).
+ * @throws std::out_of_range Se IFNUM_CHECKED estiver ativo e os índices forem inválidos.
  *
  * @author Samuel Veras
- * @date 27/02/2025
+ * @date 16/10/2026
  */
-template <typename T>
-T &Matriz<T>::operator()(int linha, int coluna)
+template <typename T, typename Alloc>
+inline const T &Matriz<T, Alloc>::elemento(size_t linha, size_t coluna) const
+    noexcept(!detail::checado)
 {
-    if (linha < 0 || coluna < 0)
-        throw std::out_of_range("Índices negativos.");
-
-    if ((size_t)linha >= linhas_ || (size_t)coluna >= colunas_)
-        throw std::out_of_range("Índices fora dos limites da matriz.");
+    if constexpr (detail::checado) {
+        if (linha >= linhas_ || coluna >= colunas_)
+            throw std::out_of_range("Índices fora dos limites da matriz.");
+    }
 
     return matriz_[linha * colunas_ + coluna];
 }
 
 /*!
- * @brief Operador unário de negação.
- *
- * Retorna uma nova matriz cujos elementos são os negativos da matriz original.
+ * @brief Indica se escrever em `destino` altera elementos desta matriz antes de lidos.
  *
- * @tparam T Tipo dos elementos da matriz.
- * @return Nova matriz com os sinais dos elementos invertidos.
+ * Parte do protocolo de ExpressaoMatriz (ver ConstMatrizView::conflita).
  *
  * @author Samuel Veras
- * @date 13/03/2025
+ * @date 17/10/2026
  */
-template <typename T>
-inline Matriz<T> Matriz<T>::operator-() const
-{
-    Matriz<T> novo = *this;
-
-    for (auto &e : novo.matriz_)
-        e *= -1;
-
-    return novo;
-}
-
-/*!
- * @brief Soma duas matrizes elemento a elemento.
- *
- * Retorna uma nova matriz com os elementos somados.
- *
- * @tparam T Tipo dos elementos da matriz.
- * @param other Outra matriz a ser somada.
- * @return Resultado da soma.
- * @throws std::invalid_argument Se as dimensões das matrizes forem diferentes.
- *
- * @author Samuel Veras
- * @date 27/02/2025
- */
-template <typename T>
-Matriz<T> Matriz<T>::operator+(const Matriz<T> &other) const
-{
-    if (colunas_ != other.colunas_ || linhas_ != other.linhas_)
-        throw std::invalid_argument("Matrizes de ordens diferentes.");
-
-    Matriz<T> novo(linhas_, colunas_);
-
-    for (size_t i = 0; i < matriz_.size(); i++)
-        novo.matriz_[i] = matriz_[i] + other.matriz_[i];
-
-    return novo;
-}
-
-/*!
- * @brief Subtrai duas matrizes elemento a elemento.
- *
- * Retorna uma nova matriz com os elementos resultantes da subtração.
- *
- * @tparam T Tipo dos elementos da matriz.
- * @param other Outra matriz a ser subtraída.
- * @return Resultado da subtração.
- * @throws std::invalid_argument Se as dimensões das matrizes forem diferentes.
- *
- * @author Samuel Veras
- * @date 27/02/2025
- */
-template <typename T>
-Matriz<T> Matriz<T>::operator-(const Matriz<T> &other) const
+template <typename T, typename Alloc>
+template <typename U>
+bool Matriz<T, Alloc>::conflita(const ConstMatrizView<U> &destino) const
 {
-    if (colunas_ != other.colunas_ || linhas_ != other.linhas_)
-        throw std::invalid_argument("Matrizes de ordens diferentes.");
-
-    Matriz<T> novo(linhas_, colunas_);
-
-    for (size_t i = 0; i < matriz_.size(); i++)
-        novo.matriz_[i] = matriz_[i] - other.matriz_[i];
-
-    return novo;
+    return visao().conflita(destino);
 }
 
 /*!
- * @brief Multiplica todos os elementos da matriz por um escalar.
+ * @brief Acesso de leitura a um elemento da matriz.
  *
- * Retorna uma nova matriz com cada elemento multiplicado pelo escalar dado.
+ * Retorna o valor na posição especificada da matriz.
  *
  * @tparam T Tipo dos elementos da matriz.
- * @param escalar Valor escalar a ser multiplicado.
- * @return Nova matriz resultante da multiplicação escalar.
+ * @param linha Índice da linha (inicia em 0).
+ * @param coluna Índice da coluna (inicia em 0).
+ * @return Valor do elemento na posição (linha, coluna).
+ * @throws std::out_of_range Se os índices forem negativos ou estiverem fora dos limites
+ *         (apenas com IFNUM_CHECKED ativo; ver Configuracao.hpp).
  *
  * @author Samuel Veras
  * @date 27/02/2025
  */
-template <typename T>
-Matriz<T> Matriz<T>::operator*(T escalar) const
+template <typename T, typename Alloc>
+T Matriz<T, Alloc>::operator()(int linha, int coluna) const noexcept(!detail::checado)
 {
-    Matriz<T> novo(linhas_, colunas_);
+    if constexpr (detail::checado) {
+        if (linha < 0 || coluna < 0)
+            throw std::out_of_range("Índices negativos.");
 
-    for (size_t i = 0; i < matriz_.size(); i++)
-        novo.matriz_[i] = matriz_[i] * escalar;
+        if ((size_t)linha >= linhas_ || (size_t)coluna >= colunas_)
+            throw std::out_of_range("Índices fora dos limites da matriz.");
+    }
 
-    return novo;
+    return matriz_[linha * colunas_ + coluna];
 }
 
 /*!
- * @brief Divide todos os elementos da matriz por um escalar.
+ * @brief Acesso de escrita a um elemento da matriz.
  *
- * Retorna uma nova matriz com cada elemento dividido pelo escalar dado.
+ * Retorna uma referência ao valor na posição especificada da matriz.
  *
  * @tparam T Tipo dos elementos da matriz.
- * @param escalar Valor escalar divisor.
- * @return Nova matriz resultante da divisão escalar.
- * @throws std::invalid_argument Se o escalar for zero.
+ * @param linha Índice da linha (inicia em 0).
+ * @param coluna Índice da coluna (inicia em 0).
+ * @return Referência ao elemento na posição (linha, coluna).
+ * @throws std::out_of_range Se os índices forem negativos ou estiverem fora dos limites
+ *         (apenas com IFNUM_CHECKED ativo; ver Configuracao.hpp).
  *
  * @author Samuel Veras
  * @date 27/02/2025
  */
-template <typename T>
-Matriz<T> Matriz<T>::operator/(T escalar) const
+template <typename T, typename Alloc>
+T &Matriz<T, Alloc>::operator()(int linha, int coluna) noexcept(!detail::checado)
 {
-    if (escalar == 0)
-        throw std::invalid_argument("Divisão por zero.");
+    if constexpr (detail::checado) {
+        if (linha < 0 || coluna < 0)
+            throw std::out_of_range("Índices negativos.");
 
-    Matriz<T> novo(linhas_, colunas_);
-
-    for (size_t i = 0; i < matriz_.size(); i++)
-        novo.matriz_[i] = matriz_[i] / escalar;
+        if ((size_t)linha >= linhas_ || (size_t)coluna >= colunas_)
+            throw std::out_of_range("Índices fora dos limites da matriz.");
+    }
 
-    return novo;
+    return matriz_[linha * colunas_ + coluna];
 }
 
 /*!
- * @brief Multiplica duas matrizes.
+ * @brief Avalia uma expressão elemento a elemento diretamente nesta matriz.
  *
- * Retorna o produto matricial entre esta matriz e outra.
+ * A expressão inteira é calculada em um único laço. Se as dimensões já coincidirem,
+ * o buffer atual é reaproveitado e nenhuma alocação é feita. Como todas as expressões
+ * são elemento a elemento, a própria matriz pode aparecer na expressão (`A = A + B`);
+ * se ela aparecer por uma visão com outra disposição (`A = A.visao_transposta()`), a
+ * expressão é avaliada antes em um buffer novo.
  *
  * @tparam T Tipo dos elementos da matriz.
- * @param outro Matriz a ser multiplicada.
- * @return Nova matriz resultante do produto.
- * @throws std::invalid_argument Se o número de colunas desta matriz for
- *         diferente do número de linhas da outra.
+ * @tparam E Tipo da expressão.
+ * @param expressao Expressão a ser avaliada.
+ * @return Referência para esta matriz.
  *
  * @author Samuel Veras
- * @date 27/02/2025
+ * @date 16/10/2026
  */
-template <typename T>
-Matriz<T> Matriz<T>::operator*(const Matriz<T> &outro) const
+template <typename T, typename Alloc>
+template <typename E>
+Matriz<T, Alloc> &Matriz<T, Alloc>::operator=(const ExpressaoMatriz<E> &expressao)
 {
-    if (colunas_ != outro.linhas_)
-        throw std::invalid_argument("Matrizes com dimensões incompatíveis para multiplicação.");
+    const E &e = expressao.derivada();
+
+    if (e.linhas() != linhas_ || e.colunas() != colunas_ || e.conflita(visao())) {
+        // A expressão pode referenciar esta matriz: avalia antes de trocar o buffer.
+        Matriz novo(e, matriz_.get_allocator());
+        std::swap(matriz_, novo.matriz_);
+        linhas_ = novo.linhas_;
+        colunas_ = novo.colunas_;
+        return *this;
+    }
 
-    Matriz<T> novo(linhas_, outro.colunas_);
+    paralelo::para(0, linhas_, colunas_, [&](size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++)
+            for (size_t j = 0; j < colunas_; j++)
+                matriz_[i * colunas_ + j] = e.elemento(i, j);
+    });
 
-    for (size_t i = 0; i < linhas_; i++)
-        for (size_t j = 0; j < outro.colunas_; j++)
-            for (size_t k = 0; k < colunas_; k++)
-                novo(i, j) += (*this)(i, k) * outro(k, j);
-
-    return novo;
+    return *this;
 }
 
 /*!
- * @brief Soma outra matriz a esta matriz.
+ * @brief Soma uma expressão a esta matriz, no próprio buffer.
  *
- * Cada elemento da matriz atual é somado com o correspondente da outra matriz.
+ * Cada elemento da matriz atual é somado com o correspondente da expressão, sem
+ * criar matrizes temporárias.
  *
  * @tparam T Tipo dos elementos da matriz.
- * @param other Matriz a ser somada.
+ * @tparam E Tipo da expressão.
+ * @param expressao Matriz ou expressão a ser somada.
  * @return Referência para esta matriz modificada.
  * @throws std::invalid_argument Se as matrizes tiverem ordens diferentes.
  *
  * @author Samuel Veras
- * @date 27/02/2025
+ * @date 16/10/2026
  */
-template <typename T>
-Matriz<T> &Matriz<T>::operator+=(const Matriz<T> &other)
+template <typename T, typename Alloc>
+template <typename E>
+Matriz<T, Alloc> &Matriz<T, Alloc>::operator+=(const ExpressaoMatriz<E> &expressao)
 {
-    // return *this = *this + other;
+    const E &e = expressao.derivada();
 
-    if (colunas_ != other.colunas_ || linhas_ != other.linhas_)
+    if (colunas_ != e.colunas() || linhas_ != e.linhas())
         throw std::invalid_argument("Matrizes de ordens diferentes.");
 
-    for (size_t i = 0; i < matriz_.size(); i++)
-        matriz_[i] += other.matriz_[i];
+    if (e.conflita(visao()))
+        return *this += Matriz(e, matriz_.get_allocator());
+
+    paralelo::para(0, linhas_, colunas_, [&](size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++)
+            for (size_t j = 0; j < colunas_; j++)
+                matriz_[i * colunas_ + j] += e.elemento(i, j);
+    });
 
     return *this;
 }
 
 /*!
- * @brief Subtrai outra matriz desta matriz.
+ * @brief Subtrai uma expressão desta matriz, no próprio buffer.
  *
- * Cada elemento da matriz atual é subtraído com o correspondente da outra matriz.
+ * Cada elemento da matriz atual é subtraído do correspondente da expressão, sem
+ * criar matrizes temporárias.
  *
  * @tparam T Tipo dos elementos da matriz.
- * @param other Matriz a ser subtraída.
+ * @tparam E Tipo da expressão.
+ * @param expressao Matriz ou expressão a ser subtraída.
  * @return Referência para esta matriz modificada.
  * @throws std::invalid_argument Se as matrizes tiverem ordens diferentes.
  *
  * @author Samuel Veras
- * @date 27/02/2025
+ * @date 16/10/2026
  */
-template <typename T>
-Matriz<T> &Matriz<T>::operator-=(const Matriz<T> &other)
+template <typename T, typename Alloc>
+template <typename E>
+Matriz<T, Alloc> &Matriz<T, Alloc>::operator-=(const ExpressaoMatriz<E> &expressao)
 {
-    // return *this = *this - outro;
+    const E &e = expressao.derivada();
 
-    if (colunas_ != other.colunas_ || linhas_ != other.linhas_)
+    if (colunas_ != e.colunas() || linhas_ != e.linhas())
         throw std::invalid_argument("Matrizes de ordens diferentes.");
 
-    for (size_t i = 0; i < matriz_.size(); i++)
-        matriz_[i] -= other.matriz_[i];
+    if (e.conflita(visao()))
+        return *this -= Matriz(e, matriz_.get_allocator());
+
+    paralelo::para(0, linhas_, colunas_, [&](size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++)
+            for (size_t j = 0; j < colunas_; j++)
+                matriz_[i * colunas_ + j] -= e.elemento(i, j);
+    });
 
     return *this;
 }
@@ -737,13 +1047,15 @@ Matriz<T> &Matriz<T>::operator-=(const Matriz<T> &other)
  * @author Samuel Veras
  * @date 27/02/2025
  */
-template <typename T>
-Matriz<T> &Matriz<T>::operator*=(T escalar)
+template <typename T, typename Alloc>
+Matriz<T, Alloc> &Matriz<T, Alloc>::operator*=(T escalar)
 {
     // return *this = *this * escalar;
 
-    for (auto &e : matriz_)
-        e *= escalar;
+    paralelo::para(0, matriz_.size(), 1, [&](size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++)
+            matriz_[i] *= escalar;
+    });
 
     return *this;
 }
@@ -759,16 +1071,18 @@ Matriz<T> &Matriz<T>::operator*=(T escalar)
  * @author Samuel Veras
  * @date 27/02/2025
  */
-template <typename T>
-inline Matriz<T> &Matriz<T>::operator/=(T escalar)
+template <typename T, typename Alloc>
+inline Matriz<T, Alloc> &Matriz<T, Alloc>::operator/=(T escalar)
 {
     // return *this = *this / escalar;
 
     if (escalar == 0)
         throw std::invalid_argument("Divisão por zero.");
 
-    for (auto &e : matriz_)
-        e /= escalar;
+    paralelo::para(0, matriz_.size(), 1, [&](size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++)
+            matriz_[i] /= escalar;
+    });
 
     return *this;
 }
@@ -783,18 +1097,13 @@ inline Matriz<T> &Matriz<T>::operator/=(T escalar)
  * @author Samuel Veras
  * @date 27/02/2025
  */
-template <typename T>
-bool Matriz<T>::operator==(const Matriz<T> &outro) const
+template <typename T, typename Alloc>
+bool Matriz<T, Alloc>::operator==(const Matriz &outro) const
 {
     if (linhas_ != outro.linhas_ || colunas_ != outro.colunas_)
         return false;
 
-    for (size_t i = 0; i < linhas_; ++i)
-        for (size_t j = 0; j < colunas_; ++j)
-            if ((*this)(i, j) != outro(i, j))
-                return false;
-
-    return true;
+    return matriz_ == outro.matriz_;
 }
 
 /*!
@@ -807,8 +1116,8 @@ bool Matriz<T>::operator==(const Matriz<T> &outro) const
  * @author Samuel Veras
  * @date 27/02/2025
  */
-template <typename T>
-bool Matriz<T>::operator!=(const Matriz<T> &outro) const
+template <typename T, typename Alloc>
+bool Matriz<T, Alloc>::operator!=(const Matriz &outro) const
 {
     return !(*this == outro);
 }
@@ -826,14 +1135,14 @@ bool Matriz<T>::operator!=(const Matriz<T> &outro) const
  * @author Samuel Veras
  * @date 27/02/2025
  */
-template <typename U>
-std::ostream &operator<<(std::ostream &os, const Matriz<U> &u)
+template <typename U, typename A>
+std::ostream &operator<<(std::ostream &os, const Matriz<U, A> &u)
 {
     const size_t largura = 10;
 
     for (size_t i = 0; i < u.linhas_; ++i) {
         for (size_t j = 0; j < u.colunas_; ++j) {
-            os << std::setw(largura) << u(i, j);
+            os << std::setw(largura) << u.matriz_[i * u.colunas_ + j];
         }
         os << std::endl;
     }
@@ -842,22 +1151,72 @@ std::ostream &operator<<(std::ostream &os, const Matriz<U> &u)
 }
 
 /*!
- * @brief Multiplica escalar por matriz (escalar à esquerda).
+ * @brief Produto matricial sem alocação: C = alfa * A * B + beta * C.
  *
- * Permite a multiplicação de um escalar por uma matriz, com escalar antes.
+ * Escreve o resultado no buffer já existente de C, o que permite usar o produto em laços
+ * críticos (por exemplo, em métodos iterativos) sem alocar memória a cada iteração.
  *
- * @tparam U Tipo dos elementos da matriz.
- * @param escalar Valor escalar multiplicador.
- * @param matriz Matriz a ser multiplicada.
- * @return Nova matriz resultante da multiplicação.
+ * @tparam T Tipo dos elementos das matrizes.
+ * @param C Matriz de saída, com dimensões A.linhas() x B.colunas().
+ * @param alfa Fator aplicado ao produto A * B.
+ * @param A Matriz à esquerda.
+ * @param B Matriz à direita.
+ * @param beta Fator aplicado ao conteúdo anterior de C (zero o descarta).
+ * @throws std::invalid_argument Se as dimensões forem incompatíveis ou se C for A ou B.
  *
  * @author Samuel Veras
- * @date 27/02/2025
+ * @date 16/10/2026
  */
-template <typename U>
-Matriz<U> operator*(U escalar, Matriz<U> &matriz)
+template <typename T>
+void gemm(Matriz<T> &C, T alfa, const Matriz<T> &A, const Matriz<T> &B, T beta)
 {
-    return matriz * escalar;
+    gemm<T>(C.visao(), alfa, A.visao(), B.visao(), beta);
+}
+
+/*!
+ * @brief Produto matricial sobre visões: C = alfa * A * B + beta * C.
+ *
+ * Permite multiplicar blocos, linhas e colunas de matrizes maiores (ou buffers externos)
+ * sem copiá-los. Visões com linhas contíguas são lidas no lugar; visões transpostas são
+ * copiadas antes. Matrizes são convertidas implicitamente em visões.
+ *
+ * @tparam T Tipo dos elementos (deduzido de alfa e beta).
+ * @param C Visão de saída, com dimensões A.linhas() x B.colunas().
+ * @param alfa Fator aplicado ao produto A * B.
+ * @param A Visão à esquerda.
+ * @param B Visão à direita.
+ * @param beta Fator aplicado ao conteúdo anterior de C (zero o descarta).
+ * @throws std::invalid_argument Se as dimensões forem incompatíveis ou se C se sobrepuser
+ *         a A ou B.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void gemm(typename detail::identidade<MatrizView<T>>::tipo C, T alfa,
+          typename detail::identidade<ConstMatrizView<T>>::tipo A,
+          typename detail::identidade<ConstMatrizView<T>>::tipo B, T beta)
+{
+    if (A.colunas() != B.linhas() || C.linhas() != A.linhas() || C.colunas() != B.colunas())
+        throw std::invalid_argument("Matrizes com dimensões incompatíveis para multiplicação.");
+
+    if (detail::sobrepostas<T>(C, A) || detail::sobrepostas<T>(C, B))
+        throw std::invalid_argument("A matriz de saída não pode ser um dos operandos.");
+
+    if (!C.linhas_contiguas()) {
+        Matriz<T> c(C);
+        gemm<T>(c.visao(), alfa, A, B, beta);
+        C = c;
+        return;
+    }
+
+    const detail::OperandoGemm<T> oa(A);
+    const detail::OperandoGemm<T> ob(B);
+    const ConstMatrizView<T> &va = oa.visao();
+    const ConstMatrizView<T> &vb = ob.visao();
+
+    detail::gemm(va.linhas(), vb.colunas(), va.colunas(), alfa, va.data(), va.passo_linha(),
+                 vb.data(), vb.passo_linha(), beta, C.data(), C.passo_linha());
 }
 
 } // namespace ifnum
\ No newline at end of file
@@ -0,0 +1,245 @@
+/*!
+ * @file MatrizBanda.hpp
+ * @brief Matrizes tridiagonais e de banda em armazenamento compacto, com solvers em O(n).
+ *
+ * Discretizações 1-D e 2-D geram sistemas tridiagonais ou de banda estreita. Guardá-los em
+ * uma Matriz densa custa O(n²) de memória e O(n³) para resolver; aqui só as diagonais são
+ * guardadas e os sistemas são resolvidos em O(n) (tridiagonal, algoritmo de Thomas) ou
+ * O(n * kl * (kl + ku)) (banda, LU com pivotamento parcial).
+ *
+ * Para muitos sistemas tridiagonais independentes, `resolver_tridiagonal_lote` recebe as
+ * diagonais em estrutura de vetores (SoA), como `resolver_lote` (Lote.hpp):
+ *
+ *     inferior[i * passo + s]   A(i, i - 1) do sistema s (ignorado para i = 0)
+ *     diagonal[i * passo + s]   A(i, i)
+ *     superior[i * passo + s]   A(i, i + 1) (ignorado para i = ordem - 1)
+ *     b[i * passo + s], x[i * passo + s]
+ *
+ * Os sistemas são resolvidos em blocos de uma linha de cache, uma faixa SIMD por sistema, e
+ * os blocos são divididos entre as threads do pool.
+ */
+
+#pragma once
+#include "Alocador.hpp"
+#include "Matriz.hpp"
+#include "Paralelo.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace ifnum
+{
+/*!
+ * @brief Matriz tridiagonal n x n guardada pelas três diagonais.
+ *
+ * `resolver` usa o algoritmo de Thomas (eliminação de Gauss sem pivotamento), em O(n) por
+ * lado direito. É estável para matrizes diagonalmente dominantes ou simétricas definidas
+ * positivas, o caso típico de discretizações; para as demais, converta para MatrizBanda
+ * (kl = ku = 1) e use LUBanda, que pivota.
+ *
+ * @tparam T Tipo dos elementos (ponto flutuante).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+class MatrizTridiagonal
+{
+  private:
+    size_t ordem_ = 0;
+    std::vector<T> inferior_; //!< A(i + 1, i), n - 1 elementos
+    std::vector<T> diagonal_; //!< A(i, i), n elementos
+    std::vector<T> superior_; //!< A(i, i + 1), n - 1 elementos
+
+    void fatorar_(std::vector<T> &superior_fatorada, std::vector<T> &inverso_pivo) const;
+
+  public:
+    using valor_tipo = T;
+
+    explicit MatrizTridiagonal(size_t ordem);
+    MatrizTridiagonal(std::vector<T> inferior, std::vector<T> diagonal, std::vector<T> superior);
+    explicit MatrizTridiagonal(const ConstMatrizView<T> &densa);
+    explicit MatrizTridiagonal(const Matriz<T> &densa);
+
+    size_t ordem() const;
+    const std::vector<T> &inferior() const;
+    const std::vector<T> &diagonal() const;
+    const std::vector<T> &superior() const;
+    std::vector<T> &inferior();
+    std::vector<T> &diagonal();
+    std::vector<T> &superior();
+
+    T elemento(size_t linha, size_t coluna) const noexcept(!detail::checado);
+    Matriz<T> densa() const;
+
+    void multiplicar(const T *x, T *y) const;
+    std::vector<T> operator*(const std::vector<T> &x) const;
+
+    Matriz<T> resolver(const Matriz<T> &b) const;
+    Matriz<T> resolver(const ConstMatrizView<T> &b) const;
+    void resolver(const ConstMatrizView<T> &b, const MatrizView<T> &x) const;
+    void resolver(const T *b, T *x) const;
+};
+
+/*!
+ * @brief Matriz de banda n x n com kl subdiagonais e ku superdiagonais.
+ *
+ * Cada linha i guarda as colunas i - kl a i + ku, em `dados()[i * (kl + ku + 1) + j - i + kl]`
+ * (posições fora da matriz, nas primeiras e últimas linhas, ficam zeradas). Elementos fora da
+ * banda são zero e não podem ser escritos.
+ *
+ * @tparam T Tipo dos elementos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+class MatrizBanda
+{
+  private:
+    size_t ordem_ = 0;
+    size_t kl_ = 0;
+    size_t ku_ = 0;
+    std::vector<T> dados_;
+
+    void copiar_(const ConstMatrizView<T> &densa);
+
+  public:
+    using valor_tipo = T;
+
+    MatrizBanda(size_t ordem, size_t kl, size_t ku);
+    MatrizBanda(const ConstMatrizView<T> &densa, size_t kl, size_t ku);
+    MatrizBanda(const Matriz<T> &densa, size_t kl, size_t ku);
+    explicit MatrizBanda(const ConstMatrizView<T> &densa);
+    explicit MatrizBanda(const Matriz<T> &densa);
+    explicit MatrizBanda(const MatrizTridiagonal<T> &tridiagonal);
+
+    size_t ordem() const;
+    size_t subdiagonais() const;
+    size_t superdiagonais() const;
+    size_t largura() const;
+    const T *data() const;
+
+    bool na_banda(size_t linha, size_t coluna) const;
+    T elemento(size_t linha, size_t coluna) const noexcept(!detail::checado);
+    T &elemento(size_t linha, size_t coluna);
+    Matriz<T> densa() const;
+
+    void multiplicar(const T *x, T *y) const;
+    std::vector<T> operator*(const std::vector<T> &x) const;
+
+    Matriz<T> resolver(const Matriz<T> &b) const;
+    Matriz<T> resolver(const ConstMatrizView<T> &b) const;
+};
+
+/*!
+ * @brief Fatoração PA = LU de uma matriz de banda, com pivotamento parcial.
+ *
+ * As trocas de linha aumentam a banda superior de U para kl + ku; L tem kl subdiagonais.
+ * Como na dgbtrf do LAPACK, L é guardada sem as trocas posteriores: cada passo k guarda
+ * o pivô escolhido e os multiplicadores das kl linhas seguintes, e `resolver` reaplica as
+ * trocas e as eliminações na mesma ordem. Custa O(n * kl * (kl + ku)) para fatorar e
+ * O(n * (2kl + ku)) por lado direito.
+ *
+ * Se um pivô for nulo, a matriz é marcada como singular (ver singular()) e `resolver`
+ * lança exceção, como em LU.
+ *
+ * @tparam T Tipo dos elementos (ponto flutuante).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+class LUBanda
+{
+  private:
+    size_t n_ = 0;
+    size_t kl_ = 0;
+    size_t ku_ = 0;
+    size_t largura_ = 0; //!< 2kl + ku + 1: colunas i - kl a i + kl + ku de cada linha
+    std::vector<T> lu_;
+    std::vector<size_t> pivos_;
+    int sinal_ = 1;
+    bool singular_ = false;
+
+  public:
+    explicit LUBanda(const MatrizBanda<T> &A);
+    explicit LUBanda(const MatrizTridiagonal<T> &A);
+
+    void fatorar(const MatrizBanda<T> &A);
+
+    size_t ordem() const;
+    bool singular() const;
+    T determinante() const;
+
+    Matriz<T> resolver(const Matriz<T> &b) const;
+    Matriz<T> resolver(const ConstMatrizView<T> &b) const;
+    void resolver(const ConstMatrizView<T> &b, const MatrizView<T> &x) const;
+    void resolver(const T *b, T *x) const;
+};
+
+template <typename T>
+size_t resolver_tridiagonal_lote(size_t ordem, size_t quantidade, size_t passo,
+                                 const T *inferior, const T *diagonal, const T *superior,
+                                 const T *b, T *x, uint8_t *singular = nullptr);
+
+/*!
+ * @brief Lote de sistemas tridiagonais de mesma ordem, já no layout SoA de
+ *        resolver_tridiagonal_lote.
+ *
+ * Como LoteSistemas: os vetores de cada diagonal começam alinhados a 64 bytes e podem ser
+ * preenchidos sistema a sistema (`definir`, `inferior`, ...) ou linha a linha para todos os
+ * sistemas (`inferiores`, `diagonais`, `superiores`, `termos`).
+ *
+ * @tparam T Tipo dos elementos (ponto flutuante).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+class LoteTridiagonal
+{
+  private:
+    size_t ordem_;
+    size_t quantidade_;
+    size_t passo_;
+    std::vector<T, AlocadorAlinhado<T>> inferior_;
+    std::vector<T, AlocadorAlinhado<T>> diagonal_;
+    std::vector<T, AlocadorAlinhado<T>> superior_;
+    std::vector<T, AlocadorAlinhado<T>> b_;
+    std::vector<T, AlocadorAlinhado<T>> x_;
+    std::vector<uint8_t> singular_;
+
+  public:
+    LoteTridiagonal(size_t ordem, size_t quantidade);
+
+    size_t ordem() const;
+    size_t quantidade() const;
+    size_t passo() const;
+
+    T &inferior(size_t sistema, size_t linha);
+    T &diagonal(size_t sistema, size_t linha);
+    T &superior(size_t sistema, size_t linha);
+    T &b(size_t sistema, size_t linha);
+    T x(size_t sistema, size_t linha) const;
+    bool singular(size_t sistema) const;
+
+    T *inferiores(size_t linha);
+    T *diagonais(size_t linha);
+    T *superiores(size_t linha);
+    T *termos(size_t linha);
+    const T *incognitas(size_t linha) const;
+
+    void definir(size_t sistema, const MatrizTridiagonal<T> &A, const ConstMatrizView<T> &b);
+    Matriz<T> solucao(size_t sistema) const;
+
+    size_t resolver();
+};
+
+} // namespace ifnum
+
+#include "MatrizBanda.tpp"
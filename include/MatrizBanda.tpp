@@ -0,0 +1,1216 @@
+/*!
+ * @file MatrizBanda.tpp
+ * @brief Implementações de MatrizTridiagonal, MatrizBanda, LUBanda e do lote tridiagonal.
+ */
+
+#ifdef __INTELLISENSE__
+#include "MatrizBanda.hpp"
+#endif
+
+namespace ifnum
+{
+namespace detail
+{
+/*!
+ * @brief Verifica se a matriz densa é quadrada e não tem elementos fora da banda [kl, ku].
+ *
+ * @throws std::invalid_argument Se a matriz não for quadrada ou tiver elementos fora da banda.
+ */
+template <typename T>
+void validar_banda(const ConstMatrizView<T> &densa, size_t kl, size_t ku)
+{
+    if (densa.linhas() != densa.colunas())
+        throw std::invalid_argument("Matriz não é quadrada.");
+    for (size_t i = 0; i < densa.linhas(); i++) {
+        for (size_t j = 0; j < densa.colunas(); j++) {
+            if ((j + kl < i || j > i + ku) && densa.elemento(i, j) != T(0))
+                throw std::invalid_argument("A matriz tem elementos fora da banda.");
+        }
+    }
+}
+
+/*!
+ * @brief Algoritmo de Thomas para L sistemas consecutivos de um lote SoA, um por faixa.
+ *
+ * A superdiagonal eliminada vai para `c_elim` (ordem * L elementos, contíguos por linha) e a
+ * diagonal eliminada vai direto para x. Os cálculos de cada linha são feitos em vetores
+ * locais e só então copiados para x, de modo que x possa ser o próprio b e o compilador
+ * vetorize as faixas sem testes de sobreposição.
+ *
+ * @return Quantos dos L sistemas são singulares (pivô nulo ou NaN; solução com NaN).
+ */
+template <typename T, size_t L>
+[[gnu::always_inline]] inline size_t resolver_tridiagonal_bloco(size_t n, size_t passo,
+                                                                const T *inferior,
+                                                                const T *diagonal,
+                                                                const T *superior, const T *b,
+                                                                T *x, uint8_t *singular,
+                                                                T *c_elim)
+{
+    alignas(64) T menor[L], nan[L], c_ant[L], x_ant[L], c_novo[L], x_novo[L], zeros[L];
+    for (size_t l = 0; l < L; l++) {
+        menor[l] = std::numeric_limits<T>::infinity();
+        nan[l] = T(0);
+        c_ant[l] = T(0);
+        x_ant[l] = T(0);
+        zeros[l] = T(0);
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        // a na primeira linha e c na última são ignorados e podem conter lixo: são trocados
+        // por zeros, para que o laço das faixas não tenha leituras condicionais.
+        const T *a = i > 0 ? inferior + i * passo : zeros;
+        const T *c = i + 1 < n ? superior + i * passo : zeros;
+        const T *d = diagonal + i * passo, *bi = b + i * passo;
+        for (size_t l = 0; l < L; l++) {
+            // Sem seleções nem desvios (o vetorizador não converte seleções de ponto flutuante
+            // em -O2): o menor |pivô| e a soma de (pivô - pivô), NaN se algum pivô for NaN ou
+            // infinito, identificam as faixas singulares no fim. Nelas a divisão por zero só
+            // gera infinitos, descartados.
+            const T pivo = d[l] - a[l] * c_ant[l];
+            menor[l] = std::min(menor[l], std::abs(pivo));
+            nan[l] += pivo - pivo;
+            const T inverso = T(1) / pivo;
+            c_novo[l] = c[l] * inverso;
+            x_novo[l] = (bi[l] - a[l] * x_ant[l]) * inverso;
+        }
+        std::memcpy(c_elim + i * L, c_novo, L * sizeof(T));
+        std::memcpy(x + i * passo, x_novo, L * sizeof(T));
+        std::memcpy(c_ant, c_novo, L * sizeof(T));
+        std::memcpy(x_ant, x_novo, L * sizeof(T));
+    }
+
+    // Substituição regressiva: x_ant guarda a linha i + 1 já resolvida
+    for (size_t i = n - 1; i-- > 0;) {
+        const T *xi = x + i * passo, *ci = c_elim + i * L;
+        for (size_t l = 0; l < L; l++)
+            x_novo[l] = xi[l] - ci[l] * x_ant[l];
+        std::memcpy(x + i * passo, x_novo, L * sizeof(T));
+        std::memcpy(x_ant, x_novo, L * sizeof(T));
+    }
+
+    size_t singulares = 0;
+    for (size_t l = 0; l < L; l++) {
+        const bool ruim = !(menor[l] > T(0)) || nan[l] != T(0);
+        singulares += ruim;
+        if (singular)
+            singular[l] = ruim;
+        if (ruim) {
+            for (size_t i = 0; i < n; i++)
+                x[i * passo + l] = std::numeric_limits<T>::quiet_NaN();
+        }
+    }
+    return singulares;
+}
+} // namespace detail
+
+/*!
+ * @brief Cria uma matriz tridiagonal n x n nula.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizTridiagonal<T>::MatrizTridiagonal(size_t ordem)
+    : ordem_(ordem), inferior_(ordem > 0 ? ordem - 1 : 0), diagonal_(ordem),
+      superior_(ordem > 0 ? ordem - 1 : 0)
+{
+}
+
+/*!
+ * @brief Cria a matriz a partir das três diagonais.
+ *
+ * @param inferior A(i + 1, i), com n - 1 elementos.
+ * @param diagonal A(i, i), com n elementos.
+ * @param superior A(i, i + 1), com n - 1 elementos.
+ * @throws std::invalid_argument Se os tamanhos das diagonais forem incompatíveis.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizTridiagonal<T>::MatrizTridiagonal(std::vector<T> inferior, std::vector<T> diagonal,
+                                        std::vector<T> superior)
+    : ordem_(diagonal.size()), inferior_(std::move(inferior)), diagonal_(std::move(diagonal)),
+      superior_(std::move(superior))
+{
+    const size_t fora = ordem_ > 0 ? ordem_ - 1 : 0;
+    if (inferior_.size() != fora || superior_.size() != fora)
+        throw std::invalid_argument("Tamanhos das diagonais incompatíveis.");
+}
+
+/*!
+ * @brief Construtor a partir de uma matriz densa (ou visão) tridiagonal.
+ *
+ * @throws std::invalid_argument Se a matriz não for quadrada ou tiver elementos não nulos
+ *         fora das três diagonais.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizTridiagonal<T>::MatrizTridiagonal(const ConstMatrizView<T> &densa)
+    : MatrizTridiagonal(densa.linhas())
+{
+    detail::validar_banda(densa, 1, 1);
+    for (size_t i = 0; i < ordem_; i++) {
+        diagonal_[i] = densa.elemento(i, i);
+        if (i + 1 < ordem_) {
+            inferior_[i] = densa.elemento(i + 1, i);
+            superior_[i] = densa.elemento(i, i + 1);
+        }
+    }
+}
+
+/*!
+ * @brief Construtor a partir de uma matriz densa tridiagonal.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizTridiagonal<T>::MatrizTridiagonal(const Matriz<T> &densa)
+    : MatrizTridiagonal(densa.visao())
+{
+}
+
+template <typename T>
+size_t MatrizTridiagonal<T>::ordem() const
+{
+    return ordem_;
+}
+
+/*! @brief Subdiagonal, A(i + 1, i) para 0 <= i < n - 1. */
+template <typename T>
+const std::vector<T> &MatrizTridiagonal<T>::inferior() const
+{
+    return inferior_;
+}
+
+/*! @brief Diagonal principal, A(i, i). */
+template <typename T>
+const std::vector<T> &MatrizTridiagonal<T>::diagonal() const
+{
+    return diagonal_;
+}
+
+/*! @brief Superdiagonal, A(i, i + 1) para 0 <= i < n - 1. */
+template <typename T>
+const std::vector<T> &MatrizTridiagonal<T>::superior() const
+{
+    return superior_;
+}
+
+/*! @brief Subdiagonal, para escrita (o tamanho não deve ser alterado). */
+template <typename T>
+std::vector<T> &MatrizTridiagonal<T>::inferior()
+{
+    return inferior_;
+}
+
+/*! @brief Diagonal principal, para escrita (o tamanho não deve ser alterado). */
+template <typename T>
+std::vector<T> &MatrizTridiagonal<T>::diagonal()
+{
+    return diagonal_;
+}
+
+/*! @brief Superdiagonal, para escrita (o tamanho não deve ser alterado). */
+template <typename T>
+std::vector<T> &MatrizTridiagonal<T>::superior()
+{
+    return superior_;
+}
+
+/*!
+ * @brief Retorna o elemento (linha, coluna), ou zero fora das três diagonais.
+ *
+ * @throws std::out_of_range Se os índices estiverem fora dos limites (com IFNUM_CHECKED).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T MatrizTridiagonal<T>::elemento(size_t linha, size_t coluna) const noexcept(!detail::checado)
+{
+    if constexpr (detail::checado) {
+        if (linha >= ordem_ || coluna >= ordem_)
+            throw std::out_of_range("Índices fora dos limites da matriz.");
+    }
+    if (linha == coluna)
+        return diagonal_[linha];
+    if (linha == coluna + 1)
+        return inferior_[coluna];
+    if (coluna == linha + 1)
+        return superior_[linha];
+    return T(0);
+}
+
+/*!
+ * @brief Converte para uma Matriz densa.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> MatrizTridiagonal<T>::densa() const
+{
+    Matriz<T> d(ordem_, ordem_);
+    for (size_t i = 0; i < ordem_; i++) {
+        d.elemento(i, i) = diagonal_[i];
+        if (i + 1 < ordem_) {
+            d.elemento(i + 1, i) = inferior_[i];
+            d.elemento(i, i + 1) = superior_[i];
+        }
+    }
+    return d;
+}
+
+/*!
+ * @brief Produto matriz-vetor y = A * x sobre buffers já alocados, sem sobreposição.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void MatrizTridiagonal<T>::multiplicar(const T *x, T *y) const
+{
+    IFNUM_FLOPS(5 * ordem_);
+    const size_t n = ordem_;
+    paralelo::para(0, n, 5, [&](size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++) {
+            T soma = diagonal_[i] * x[i];
+            if (i > 0)
+                soma += inferior_[i - 1] * x[i - 1];
+            if (i + 1 < n)
+                soma += superior_[i] * x[i + 1];
+            y[i] = soma;
+        }
+    });
+}
+
+/*!
+ * @brief Produto matriz-vetor.
+ *
+ * @throws std::invalid_argument Se x.size() for diferente da ordem.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+std::vector<T> MatrizTridiagonal<T>::operator*(const std::vector<T> &x) const
+{
+    if (x.size() != ordem_)
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+    std::vector<T> y(ordem_);
+    multiplicar(x.data(), y.data());
+    return y;
+}
+
+/*!
+ * @brief Eliminação de Thomas da matriz: superdiagonal eliminada e inversos dos pivôs.
+ *
+ * @throws std::runtime_error Se algum pivô for nulo.
+ */
+template <typename T>
+void MatrizTridiagonal<T>::fatorar_(std::vector<T> &superior_fatorada,
+                                    std::vector<T> &inverso_pivo) const
+{
+    IFNUM_FLOPS(3 * ordem_);
+    superior_fatorada.resize(ordem_);
+    inverso_pivo.resize(ordem_);
+    T c_ant = T(0);
+    for (size_t i = 0; i < ordem_; i++) {
+        const T pivo = diagonal_[i] - (i > 0 ? inferior_[i - 1] * c_ant : T(0));
+        if (pivo == T(0))
+            throw std::runtime_error("Matriz singular");
+        inverso_pivo[i] = T(1) / pivo;
+        c_ant = superior_fatorada[i] = i + 1 < ordem_ ? superior_[i] * inverso_pivo[i] : T(0);
+    }
+}
+
+/*!
+ * @brief Resolve A * X = B para um ou mais lados direitos (colunas de B).
+ *
+ * @throws std::invalid_argument Se b não tiver n linhas.
+ * @throws std::runtime_error Se um pivô for nulo.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> MatrizTridiagonal<T>::resolver(const Matriz<T> &b) const
+{
+    return resolver(b.visao());
+}
+
+/*!
+ * @brief Resolve A * X = B com os lados direitos dados por uma visão.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> MatrizTridiagonal<T>::resolver(const ConstMatrizView<T> &b) const
+{
+    if (b.linhas() != ordem_)
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+
+    Matriz<T> x(ordem_, b.colunas());
+    resolver(b, x.visao());
+    return x;
+}
+
+/*!
+ * @brief Resolve A * X = B escrevendo as soluções em uma visão existente.
+ *
+ * A eliminação é feita uma vez; as substituições percorrem as linhas com todas as colunas de
+ * uma vez, e as colunas são divididas entre as threads do pool. x não pode se sobrepor a b.
+ *
+ * @param b Visão n x m com os lados direitos.
+ * @param x Visão n x m que recebe as soluções.
+ * @throws std::invalid_argument Se b ou x não tiverem n linhas, ou se as colunas diferirem.
+ * @throws std::runtime_error Se um pivô for nulo.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void MatrizTridiagonal<T>::resolver(const ConstMatrizView<T> &b, const MatrizView<T> &x) const
+{
+    if (b.linhas() != ordem_ || x.linhas() != ordem_ || x.colunas() != b.colunas())
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+
+    IFNUM_MEDIR("MatrizTridiagonal::resolver");
+    std::vector<T> c, inverso;
+    fatorar_(c, inverso);
+    const size_t n = ordem_;
+    const size_t m = b.colunas();
+    IFNUM_FLOPS(5 * n * m);
+    IFNUM_BYTES(sizeof(T) * (3 * n + 2 * n * m));
+    T *y = x.data();
+    const size_t pl = x.passo_linha();
+
+    auto substituir = [&](auto pc, size_t c0, size_t c1) {
+        for (size_t col = c0; col < c1; col++)
+            y[col * pc] = b.elemento(0, col) * inverso[0];
+        for (size_t i = 1; i < n; i++) {
+            T *yi = y + i * pl;
+            const T *ya = yi - pl;
+            const T sub = inferior_[i - 1], inv = inverso[i];
+            for (size_t col = c0; col < c1; col++)
+                yi[col * pc] = (b.elemento(i, col) - sub * ya[col * pc]) * inv;
+        }
+        for (size_t i = n - 1; i-- > 0;) {
+            T *yi = y + i * pl;
+            const T *yp = yi + pl;
+            const T ci = c[i];
+            for (size_t col = c0; col < c1; col++)
+                yi[col * pc] -= ci * yp[col * pc];
+        }
+    };
+    if (n == 0)
+        return;
+    paralelo::para(0, m, 5 * n, [&](size_t c0, size_t c1) {
+        if (x.passo_coluna() == 1)
+            substituir(std::integral_constant<size_t, 1>(), c0, c1);
+        else
+            substituir(x.passo_coluna(), c0, c1);
+    });
+}
+
+/*!
+ * @brief Resolve A * x = b para um único lado direito (algoritmo de Thomas, O(n)).
+ *
+ * x deve ter n elementos e pode ser o próprio b.
+ *
+ * @throws std::runtime_error Se um pivô for nulo.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void MatrizTridiagonal<T>::resolver(const T *b, T *x) const
+{
+    IFNUM_MEDIR("MatrizTridiagonal::resolver");
+    IFNUM_FLOPS(8 * ordem_);
+    IFNUM_BYTES(sizeof(T) * 5 * ordem_);
+    const size_t n = ordem_;
+    if (n == 0)
+        return;
+
+    std::vector<T> c(n);
+    T c_ant = T(0), x_ant = T(0);
+    for (size_t i = 0; i < n; i++) {
+        const T sub = i > 0 ? inferior_[i - 1] : T(0);
+        const T pivo = diagonal_[i] - sub * c_ant;
+        if (pivo == T(0))
+            throw std::runtime_error("Matriz singular");
+        c_ant = c[i] = i + 1 < n ? superior_[i] / pivo : T(0);
+        x_ant = x[i] = (b[i] - sub * x_ant) / pivo;
+    }
+    for (size_t i = n - 1; i-- > 0;)
+        x[i] -= c[i] * x[i + 1];
+}
+
+/*!
+ * @brief Cria uma matriz de banda n x n nula, com kl subdiagonais e ku superdiagonais.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizBanda<T>::MatrizBanda(size_t ordem, size_t kl, size_t ku)
+    : ordem_(ordem), kl_(kl), ku_(ku), dados_(ordem * (kl + ku + 1), T(0))
+{
+}
+
+/*! @brief Copia a banda de uma matriz densa já validada. */
+template <typename T>
+void MatrizBanda<T>::copiar_(const ConstMatrizView<T> &densa)
+{
+    for (size_t i = 0; i < ordem_; i++) {
+        const size_t j0 = i > kl_ ? i - kl_ : 0;
+        const size_t j1 = std::min(ordem_ - 1, i + ku_);
+        for (size_t j = j0; j <= j1; j++)
+            dados_[i * largura() + j + kl_ - i] = densa.elemento(i, j);
+    }
+}
+
+/*!
+ * @brief Construtor a partir de uma matriz densa (ou visão), com a banda dada.
+ *
+ * @throws std::invalid_argument Se a matriz não for quadrada ou tiver elementos não nulos
+ *         fora da banda.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizBanda<T>::MatrizBanda(const ConstMatrizView<T> &densa, size_t kl, size_t ku)
+    : MatrizBanda(densa.linhas(), kl, ku)
+{
+    detail::validar_banda(densa, kl, ku);
+    copiar_(densa);
+}
+
+template <typename T>
+MatrizBanda<T>::MatrizBanda(const Matriz<T> &densa, size_t kl, size_t ku)
+    : MatrizBanda(densa.visao(), kl, ku)
+{
+}
+
+/*!
+ * @brief Construtor a partir de uma matriz densa (ou visão), com a menor banda que contém
+ *        todos os elementos não nulos.
+ *
+ * @throws std::invalid_argument Se a matriz não for quadrada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizBanda<T>::MatrizBanda(const ConstMatrizView<T> &densa) : ordem_(densa.linhas())
+{
+    if (densa.linhas() != densa.colunas())
+        throw std::invalid_argument("Matriz não é quadrada.");
+    for (size_t i = 0; i < ordem_; i++) {
+        for (size_t j = 0; j < ordem_; j++) {
+            if (densa.elemento(i, j) != T(0)) {
+                kl_ = std::max(kl_, i > j ? i - j : 0);
+                ku_ = std::max(ku_, j > i ? j - i : 0);
+            }
+        }
+    }
+    dados_.assign(ordem_ * largura(), T(0));
+    copiar_(densa);
+}
+
+template <typename T>
+MatrizBanda<T>::MatrizBanda(const Matriz<T> &densa) : MatrizBanda(densa.visao())
+{
+}
+
+/*!
+ * @brief Converte uma matriz tridiagonal para o formato de banda (kl = ku = 1).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizBanda<T>::MatrizBanda(const MatrizTridiagonal<T> &tridiagonal)
+    : MatrizBanda(tridiagonal.ordem(), 1, 1)
+{
+    for (size_t i = 0; i < ordem_; i++) {
+        dados_[i * 3 + 1] = tridiagonal.diagonal()[i];
+        if (i + 1 < ordem_) {
+            dados_[(i + 1) * 3] = tridiagonal.inferior()[i];
+            dados_[i * 3 + 2] = tridiagonal.superior()[i];
+        }
+    }
+}
+
+template <typename T>
+size_t MatrizBanda<T>::ordem() const
+{
+    return ordem_;
+}
+
+/*! @brief Número de subdiagonais (kl). */
+template <typename T>
+size_t MatrizBanda<T>::subdiagonais() const
+{
+    return kl_;
+}
+
+/*! @brief Número de superdiagonais (ku). */
+template <typename T>
+size_t MatrizBanda<T>::superdiagonais() const
+{
+    return ku_;
+}
+
+/*! @brief Elementos guardados por linha, kl + ku + 1. */
+template <typename T>
+size_t MatrizBanda<T>::largura() const
+{
+    return kl_ + ku_ + 1;
+}
+
+/*! @brief Armazenamento por linhas descrito na classe. */
+template <typename T>
+const T *MatrizBanda<T>::data() const
+{
+    return dados_.data();
+}
+
+/*! @brief Se (linha, coluna) está dentro da matriz e da banda. */
+template <typename T>
+bool MatrizBanda<T>::na_banda(size_t linha, size_t coluna) const
+{
+    return linha < ordem_ && coluna < ordem_ && coluna + kl_ >= linha && coluna <= linha + ku_;
+}
+
+/*!
+ * @brief Retorna o elemento (linha, coluna), ou zero fora da banda.
+ *
+ * @throws std::out_of_range Se os índices estiverem fora dos limites (com IFNUM_CHECKED).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T MatrizBanda<T>::elemento(size_t linha, size_t coluna) const noexcept(!detail::checado)
+{
+    if constexpr (detail::checado) {
+        if (linha >= ordem_ || coluna >= ordem_)
+            throw std::out_of_range("Índices fora dos limites da matriz.");
+    }
+    if (!na_banda(linha, coluna))
+        return T(0);
+    return dados_[linha * largura() + coluna + kl_ - linha];
+}
+
+/*!
+ * @brief Referência para o elemento (linha, coluna), que deve estar na banda.
+ *
+ * @throws std::out_of_range Se o elemento estiver fora da matriz ou da banda.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T &MatrizBanda<T>::elemento(size_t linha, size_t coluna)
+{
+    if (!na_banda(linha, coluna))
+        throw std::out_of_range("Elemento fora da banda.");
+    return dados_[linha * largura() + coluna + kl_ - linha];
+}
+
+/*!
+ * @brief Converte para uma Matriz densa.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> MatrizBanda<T>::densa() const
+{
+    Matriz<T> d(ordem_, ordem_);
+    for (size_t i = 0; i < ordem_; i++) {
+        const size_t j0 = i > kl_ ? i - kl_ : 0;
+        const size_t j1 = std::min(ordem_ - 1, i + ku_);
+        for (size_t j = j0; j <= j1; j++)
+            d.elemento(i, j) = dados_[i * largura() + j + kl_ - i];
+    }
+    return d;
+}
+
+/*!
+ * @brief Produto matriz-vetor y = A * x sobre buffers já alocados, sem sobreposição.
+ *
+ * As linhas são divididas entre as threads do pool.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void MatrizBanda<T>::multiplicar(const T *x, T *y) const
+{
+    IFNUM_FLOPS(2 * ordem_ * largura());
+    IFNUM_BYTES(sizeof(T) * ordem_ * (largura() + 2));
+    const size_t n = ordem_, w = largura();
+    paralelo::para(0, n, 2 * w, [&](size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++) {
+            const size_t j0 = i > kl_ ? i - kl_ : 0;
+            const size_t j1 = std::min(n - 1, i + ku_);
+            const T *linha = dados_.data() + i * w + kl_ - i; // linha[j] = A(i, j)
+            T soma = T(0);
+            for (size_t j = j0; j <= j1; j++)
+                soma += linha[j] * x[j];
+            y[i] = soma;
+        }
+    });
+}
+
+/*!
+ * @brief Produto matriz-vetor.
+ *
+ * @throws std::invalid_argument Se x.size() for diferente da ordem.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+std::vector<T> MatrizBanda<T>::operator*(const std::vector<T> &x) const
+{
+    if (x.size() != ordem_)
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+    std::vector<T> y(ordem_);
+    multiplicar(x.data(), y.data());
+    return y;
+}
+
+/*!
+ * @brief Resolve A * X = B com uma LUBanda. Para vários usos da mesma matriz, guarde a
+ *        fatoração.
+ *
+ * @throws std::invalid_argument Se b não tiver n linhas.
+ * @throws std::runtime_error Se a matriz for singular.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> MatrizBanda<T>::resolver(const Matriz<T> &b) const
+{
+    return LUBanda<T>(*this).resolver(b.visao());
+}
+
+template <typename T>
+Matriz<T> MatrizBanda<T>::resolver(const ConstMatrizView<T> &b) const
+{
+    return LUBanda<T>(*this).resolver(b);
+}
+
+/*!
+ * @brief Fatora uma matriz de banda.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+LUBanda<T>::LUBanda(const MatrizBanda<T> &A)
+{
+    fatorar(A);
+}
+
+/*!
+ * @brief Fatora uma matriz tridiagonal, com pivotamento (ao contrário de
+ *        MatrizTridiagonal::resolver).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+LUBanda<T>::LUBanda(const MatrizTridiagonal<T> &A) : LUBanda(MatrizBanda<T>(A))
+{
+}
+
+/*!
+ * @brief Refaz a fatoração para uma nova matriz, reaproveitando a memória.
+ *
+ * Passo k: escolhe o pivô entre as linhas k a k + kl, troca as linhas nas colunas k a
+ * k + kl + ku e elimina a coluna k das kl linhas seguintes, guardando os multiplicadores no
+ * lugar dos elementos eliminados. Cada eliminação é um axpy sobre as linhas contíguas.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void LUBanda<T>::fatorar(const MatrizBanda<T> &A)
+{
+    IFNUM_MEDIR("LUBanda::fatorar");
+    n_ = A.ordem();
+    kl_ = A.subdiagonais();
+    ku_ = A.superdiagonais();
+    largura_ = 2 * kl_ + ku_ + 1;
+    IFNUM_FLOPS(2 * n_ * kl_ * (kl_ + ku_ + 1));
+    IFNUM_BYTES(sizeof(T) * n_ * largura_);
+    sinal_ = 1;
+    singular_ = false;
+    pivos_.resize(n_);
+    lu_.assign(n_ * largura_, T(0));
+
+    // A linha i guarda as colunas i - kl a i + kl + ku; as kl últimas começam zeradas e
+    // recebem o preenchimento causado pelas trocas.
+    const size_t w = A.largura();
+    for (size_t i = 0; i < n_; i++)
+        std::copy_n(A.data() + i * w, w, lu_.begin() + i * largura_);
+
+    auto em = [&](size_t i, size_t j) -> T & { return lu_[i * largura_ + j + kl_ - i]; };
+
+    for (size_t k = 0; k < n_; k++) {
+        const size_t ultima_linha = std::min(n_ - 1, k + kl_);
+        const size_t ultima_coluna = std::min(n_ - 1, k + kl_ + ku_);
+
+        size_t p = k;
+        T maior = std::abs(em(k, k));
+        for (size_t i = k + 1; i <= ultima_linha; i++) {
+            if (std::abs(em(i, k)) > maior) {
+                maior = std::abs(em(i, k));
+                p = i;
+            }
+        }
+        pivos_[k] = p;
+        if (maior == T(0)) { // coluna já nula: nada a eliminar
+            singular_ = true;
+            continue;
+        }
+        if (p != k) {
+            for (size_t j = k; j <= ultima_coluna; j++)
+                std::swap(em(k, j), em(p, j));
+            sinal_ = -sinal_;
+        }
+
+        const T inverso = T(1) / em(k, k);
+        const T *linha_k = &em(k, k) + 1;
+        const size_t resto = ultima_coluna - k;
+        for (size_t i = k + 1; i <= ultima_linha; i++) {
+            const T fator = em(i, k) *= inverso;
+            if (fator == T(0))
+                continue;
+            T *linha_i = &em(i, k) + 1;
+            for (size_t t = 0; t < resto; t++)
+                linha_i[t] -= fator * linha_k[t];
+        }
+    }
+}
+
+template <typename T>
+size_t LUBanda<T>::ordem() const
+{
+    return n_;
+}
+
+/*! @brief Se algum pivô foi nulo durante a fatoração. */
+template <typename T>
+bool LUBanda<T>::singular() const
+{
+    return singular_;
+}
+
+/*!
+ * @brief Determinante de A, pelo produto dos pivôs e o sinal das trocas.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T LUBanda<T>::determinante() const
+{
+    if (singular_)
+        return T(0);
+
+    T det = static_cast<T>(sinal_);
+    for (size_t i = 0; i < n_; i++)
+        det *= lu_[i * largura_ + kl_];
+    return det;
+}
+
+/*!
+ * @brief Resolve A * X = B para um ou mais lados direitos (colunas de B).
+ *
+ * @throws std::invalid_argument Se b não tiver n linhas.
+ * @throws std::runtime_error Se a matriz for singular.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> LUBanda<T>::resolver(const Matriz<T> &b) const
+{
+    return resolver(b.visao());
+}
+
+template <typename T>
+Matriz<T> LUBanda<T>::resolver(const ConstMatrizView<T> &b) const
+{
+    if (b.linhas() != n_)
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+
+    Matriz<T> x(n_, b.colunas());
+    resolver(b, x.visao());
+    return x;
+}
+
+/*!
+ * @brief Resolve A * X = B escrevendo as soluções em uma visão existente.
+ *
+ * As substituições percorrem as linhas com todas as colunas de uma vez, e as colunas são
+ * divididas entre as threads do pool. x não pode se sobrepor a b.
+ *
+ * @throws std::invalid_argument Se b ou x não tiverem n linhas, ou se as colunas diferirem.
+ * @throws std::runtime_error Se a matriz for singular.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void LUBanda<T>::resolver(const ConstMatrizView<T> &b, const MatrizView<T> &x) const
+{
+    if (b.linhas() != n_ || x.linhas() != n_ || x.colunas() != b.colunas())
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+
+    if (singular_)
+        throw std::runtime_error("Matriz singular");
+
+    IFNUM_MEDIR("LUBanda::resolver");
+    const size_t n = n_, m = b.colunas();
+    IFNUM_FLOPS(2 * n * (largura_ + kl_) * m);
+    IFNUM_BYTES(sizeof(T) * (n * largura_ + 2 * n * m));
+    T *y = x.data();
+    const size_t pl = x.passo_linha();
+    const T *a = lu_.data();
+
+    auto substituir = [&](auto pc, size_t c0, size_t c1) {
+        for (size_t i = 0; i < n; i++)
+            for (size_t c = c0; c < c1; c++)
+                y[i * pl + c * pc] = b.elemento(i, c);
+
+        // L: trocas e eliminações na ordem da fatoração
+        for (size_t k = 0; k < n; k++) {
+            T *yk = y + k * pl;
+            if (pivos_[k] != k) {
+                T *yp = y + pivos_[k] * pl;
+                for (size_t c = c0; c < c1; c++)
+                    std::swap(yk[c * pc], yp[c * pc]);
+            }
+            const size_t ultima = std::min(n - 1, k + kl_);
+            for (size_t i = k + 1; i <= ultima; i++) {
+                const T fator = a[i * largura_ + k + kl_ - i];
+                T *yi = y + i * pl;
+                for (size_t c = c0; c < c1; c++)
+                    yi[c * pc] -= fator * yk[c * pc];
+            }
+        }
+
+        // U, com kl + ku superdiagonais
+        for (size_t i = n; i-- > 0;) {
+            T *yi = y + i * pl;
+            const T *linha = a + i * largura_ + kl_ - i; // linha[j] = U(i, j)
+            const size_t ultima = std::min(n - 1, i + kl_ + ku_);
+            for (size_t j = i + 1; j <= ultima; j++) {
+                const T fator = linha[j];
+                const T *yj = y + j * pl;
+                for (size_t c = c0; c < c1; c++)
+                    yi[c * pc] -= fator * yj[c * pc];
+            }
+            const T pivo = linha[i];
+            for (size_t c = c0; c < c1; c++)
+                yi[c * pc] /= pivo;
+        }
+    };
+    paralelo::para(0, m, 2 * n * (largura_ + kl_), [&](size_t c0, size_t c1) {
+        if (x.passo_coluna() == 1)
+            substituir(std::integral_constant<size_t, 1>(), c0, c1);
+        else
+            substituir(x.passo_coluna(), c0, c1);
+    });
+}
+
+/*!
+ * @brief Resolve A * x = b para um único lado direito, sem alocar memória.
+ *
+ * x deve ter n elementos e não pode se sobrepor a b.
+ *
+ * @throws std::runtime_error Se a matriz for singular.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void LUBanda<T>::resolver(const T *b, T *x) const
+{
+    if (singular_)
+        throw std::runtime_error("Matriz singular");
+
+    IFNUM_MEDIR("LUBanda::resolver");
+    IFNUM_FLOPS(2 * n_ * (largura_ + kl_));
+    IFNUM_BYTES(sizeof(T) * (n_ * largura_ + 2 * n_));
+    const size_t n = n_;
+    const T *a = lu_.data();
+    std::copy_n(b, n, x);
+
+    for (size_t k = 0; k < n; k++) {
+        if (pivos_[k] != k)
+            std::swap(x[k], x[pivos_[k]]);
+        const size_t ultima = std::min(n - 1, k + kl_);
+        for (size_t i = k + 1; i <= ultima; i++)
+            x[i] -= a[i * largura_ + k + kl_ - i] * x[k];
+    }
+
+    for (size_t i = n; i-- > 0;) {
+        const T *linha = a + i * largura_ + kl_ - i;
+        const size_t ultima = std::min(n - 1, i + kl_ + ku_);
+        T soma = x[i];
+        for (size_t j = i + 1; j <= ultima; j++)
+            soma -= linha[j] * x[j];
+        x[i] = soma / linha[i];
+    }
+}
+
+/*!
+ * @brief Resolve `quantidade` sistemas tridiagonais independentes de mesma ordem (Thomas).
+ *
+ * Layout SoA descrito em MatrizBanda.hpp. Os sistemas são processados em blocos de uma linha
+ * de cache (8 doubles ou 16 floats), um sistema por faixa SIMD, e os blocos são divididos
+ * entre as threads do pool. Como o algoritmo de Thomas não pivota, vale a mesma ressalva
+ * de MatrizTridiagonal: use-o para sistemas diagonalmente dominantes ou definidos positivos.
+ *
+ * @tparam T Tipo de ponto flutuante.
+ * @param ordem Ordem de cada sistema.
+ * @param quantidade Número de sistemas.
+ * @param passo Distância entre linhas consecutivas de um mesmo vetor (>= quantidade).
+ * @param x Saída; pode ser o próprio b.
+ * @param singular Se não for nulo, recebe 1 para cada sistema com pivô nulo (e solução com
+ *        NaN) e 0 para os demais.
+ * @return Número de sistemas singulares.
+ * @throws std::invalid_argument Se passo < quantidade.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+size_t resolver_tridiagonal_lote(size_t ordem, size_t quantidade, size_t passo,
+                                 const T *inferior, const T *diagonal, const T *superior,
+                                 const T *b, T *x, uint8_t *singular)
+{
+    static_assert(std::is_floating_point_v<T>,
+                  "resolver_tridiagonal_lote só está disponível para ponto flutuante.");
+    if (passo < quantidade)
+        throw std::invalid_argument("Passo do lote menor que a quantidade de sistemas.");
+    if (ordem == 0 || quantidade == 0)
+        return 0;
+    IFNUM_MEDIR("resolver_tridiagonal_lote");
+    IFNUM_FLOPS(quantidade * 8 * ordem);
+    IFNUM_BYTES(quantidade * 5 * ordem * sizeof(T));
+
+    constexpr size_t L = alinhamento_padrao / sizeof(T);
+    const size_t blocos = (quantidade + L - 1) / L;
+    std::vector<size_t> singulares(blocos, 0);
+    paralelo::para(0, blocos, 8 * ordem * L, [&](size_t inicio, size_t fim) {
+        std::vector<T> c_elim(ordem * L);
+        for (size_t bloco = inicio; bloco < fim; bloco++) {
+            const size_t s0 = bloco * L;
+            const size_t quantos = std::min(L, quantidade - s0);
+            uint8_t *marcas = singular ? singular + s0 : nullptr;
+            if (quantos == L) {
+                singulares[bloco] = detail::resolver_tridiagonal_bloco<T, L>(
+                    ordem, passo, inferior + s0, diagonal + s0, superior + s0, b + s0, x + s0,
+                    marcas, c_elim.data());
+                continue;
+            }
+            for (size_t s = s0; s < s0 + quantos; s++) {
+                singulares[bloco] += detail::resolver_tridiagonal_bloco<T, 1>(
+                    ordem, passo, inferior + s, diagonal + s, superior + s, b + s, x + s,
+                    singular ? singular + s : nullptr, c_elim.data());
+            }
+        }
+    });
+
+    size_t total = 0;
+    for (size_t s : singulares)
+        total += s;
+    return total;
+}
+
+/*!
+ * @brief Cria um lote de `quantidade` sistemas tridiagonais de ordem `ordem`, todos zerados.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+LoteTridiagonal<T>::LoteTridiagonal(size_t ordem, size_t quantidade)
+    : ordem_(ordem), quantidade_(quantidade)
+{
+    constexpr size_t linha_cache = alinhamento_padrao / sizeof(T);
+    passo_ = (quantidade + linha_cache - 1) / linha_cache * linha_cache;
+    inferior_.assign(ordem * passo_, T(0));
+    diagonal_.assign(ordem * passo_, T(0));
+    superior_.assign(ordem * passo_, T(0));
+    b_.assign(ordem * passo_, T(0));
+    x_.assign(ordem * passo_, T(0));
+    singular_.assign(quantidade, 0);
+}
+
+template <typename T>
+size_t LoteTridiagonal<T>::ordem() const
+{
+    return ordem_;
+}
+
+template <typename T>
+size_t LoteTridiagonal<T>::quantidade() const
+{
+    return quantidade_;
+}
+
+/*! @brief Distância entre os vetores de coeficientes (quantidade arredondada). */
+template <typename T>
+size_t LoteTridiagonal<T>::passo() const
+{
+    return passo_;
+}
+
+/*! @brief A(linha, linha - 1) do sistema `sistema` (ignorado para a linha 0). */
+template <typename T>
+T &LoteTridiagonal<T>::inferior(size_t sistema, size_t linha)
+{
+    return inferior_[linha * passo_ + sistema];
+}
+
+/*! @brief A(linha, linha) do sistema `sistema`. */
+template <typename T>
+T &LoteTridiagonal<T>::diagonal(size_t sistema, size_t linha)
+{
+    return diagonal_[linha * passo_ + sistema];
+}
+
+/*! @brief A(linha, linha + 1) do sistema `sistema` (ignorado para a última linha). */
+template <typename T>
+T &LoteTridiagonal<T>::superior(size_t sistema, size_t linha)
+{
+    return superior_[linha * passo_ + sistema];
+}
+
+/*! @brief Termo independente `linha` do sistema `sistema`. */
+template <typename T>
+T &LoteTridiagonal<T>::b(size_t sistema, size_t linha)
+{
+    return b_[linha * passo_ + sistema];
+}
+
+/*! @brief Incógnita `linha` do sistema `sistema`, após resolver(). */
+template <typename T>
+T LoteTridiagonal<T>::x(size_t sistema, size_t linha) const
+{
+    return x_[linha * passo_ + sistema];
+}
+
+/*! @brief Se o sistema foi marcado como singular no último resolver(). */
+template <typename T>
+bool LoteTridiagonal<T>::singular(size_t sistema) const
+{
+    return singular_[sistema] != 0;
+}
+
+/*! @brief A(linha, linha - 1) de todos os sistemas, em sequência. */
+template <typename T>
+T *LoteTridiagonal<T>::inferiores(size_t linha)
+{
+    return inferior_.data() + linha * passo_;
+}
+
+/*! @brief A(linha, linha) de todos os sistemas, em sequência. */
+template <typename T>
+T *LoteTridiagonal<T>::diagonais(size_t linha)
+{
+    return diagonal_.data() + linha * passo_;
+}
+
+/*! @brief A(linha, linha + 1) de todos os sistemas, em sequência. */
+template <typename T>
+T *LoteTridiagonal<T>::superiores(size_t linha)
+{
+    return superior_.data() + linha * passo_;
+}
+
+/*! @brief Termo independente `linha` de todos os sistemas, em sequência. */
+template <typename T>
+T *LoteTridiagonal<T>::termos(size_t linha)
+{
+    return b_.data() + linha * passo_;
+}
+
+/*! @brief Incógnita `linha` de todos os sistemas, em sequência. */
+template <typename T>
+const T *LoteTridiagonal<T>::incognitas(size_t linha) const
+{
+    return x_.data() + linha * passo_;
+}
+
+/*!
+ * @brief Copia o sistema A x = b para a posição `sistema` do lote.
+ *
+ * @throws std::invalid_argument Se A não tiver a ordem do lote ou se b não for um vetor
+ *         coluna compatível.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void LoteTridiagonal<T>::definir(size_t sistema, const MatrizTridiagonal<T> &A,
+                                 const ConstMatrizView<T> &b)
+{
+    if (A.ordem() != ordem_ || b.linhas() != ordem_ || b.colunas() != 1)
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+
+    for (size_t i = 0; i < ordem_; i++) {
+        diagonal(sistema, i) = A.diagonal()[i];
+        if (i > 0)
+            inferior(sistema, i) = A.inferior()[i - 1];
+        if (i + 1 < ordem_)
+            superior(sistema, i) = A.superior()[i];
+        this->b(sistema, i) = b.elemento(i, 0);
+    }
+}
+
+/*! @brief Solução do sistema `sistema` como vetor coluna. */
+template <typename T>
+Matriz<T> LoteTridiagonal<T>::solucao(size_t sistema) const
+{
+    Matriz<T> resultado(ordem_, 1);
+    for (size_t i = 0; i < ordem_; i++)
+        resultado(i, 0) = x(sistema, i);
+    return resultado;
+}
+
+/*!
+ * @brief Resolve todos os sistemas do lote (ver resolver_tridiagonal_lote).
+ *
+ * @return Número de sistemas singulares.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+size_t LoteTridiagonal<T>::resolver()
+{
+    return resolver_tridiagonal_lote(ordem_, quantidade_, passo_, inferior_.data(),
+                                     diagonal_.data(), superior_.data(), b_.data(), x_.data(),
+                                     singular_.data());
+}
+
+} // namespace ifnum
@@ -0,0 +1,105 @@
+/*!
+ * @file MatrizEsparsa.hpp
+ * @brief Declaração da classe template MatrizEsparsa (formatos CSR e CSC).
+ *
+ * Guarda apenas os elementos não nulos, o que permite representar sistemas com 10⁵ a 10⁶
+ * incógnitas e poucas entradas por linha, que não caberiam em uma Matriz densa. Os
+ * solvers iterativos que usam esta classe estão em Iterativos.hpp.
+ */
+
+#pragma once
+#include "Configuracao.hpp"
+#include "Matriz.hpp"
+#include "Paralelo.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+namespace ifnum
+{
+/*!
+ * @brief Formato de armazenamento de uma MatrizEsparsa.
+ */
+enum class FormatoEsparso {
+    csr, //!< Compressed Sparse Row: linhas contíguas. Padrão; produto com vetor paralelo.
+    csc, //!< Compressed Sparse Column: colunas contíguas.
+};
+
+/*!
+ * @brief Uma entrada (linha, coluna, valor) usada para montar uma MatrizEsparsa.
+ */
+template <typename T>
+struct Tripla {
+    size_t linha;
+    size_t coluna;
+    T valor;
+};
+
+/*!
+ * @brief Matriz esparsa em formato CSR ou CSC.
+ *
+ * Em CSR, os elementos da linha i estão em `valores()[ponteiros()[i] .. ponteiros()[i + 1])`,
+ * com as colunas correspondentes em `indices()`, em ordem crescente. Em CSC vale o mesmo
+ * trocando linhas por colunas. A estrutura é imutável depois de montada; os valores podem
+ * ser alterados pelo acesso a `valores()`.
+ *
+ * @tparam T Tipo dos elementos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+class MatrizEsparsa
+{
+  private:
+    size_t linhas_ = 0;
+    size_t colunas_ = 0;
+    FormatoEsparso formato_ = FormatoEsparso::csr;
+    std::vector<size_t> ponteiros_;
+    std::vector<size_t> indices_;
+    std::vector<T> valores_;
+
+    void multiplicar_(const T *x, T *y, size_t k) const;
+
+  public:
+    using valor_tipo = T;
+
+    MatrizEsparsa(size_t linhas, size_t colunas, FormatoEsparso formato = FormatoEsparso::csr);
+    MatrizEsparsa(size_t linhas, size_t colunas, const std::vector<Tripla<T>> &triplas,
+                  FormatoEsparso formato = FormatoEsparso::csr);
+    explicit MatrizEsparsa(const ConstMatrizView<T> &densa,
+                           FormatoEsparso formato = FormatoEsparso::csr);
+    explicit MatrizEsparsa(const Matriz<T> &densa, FormatoEsparso formato = FormatoEsparso::csr);
+
+    static MatrizEsparsa<T> identidade(size_t n, FormatoEsparso formato = FormatoEsparso::csr);
+
+    size_t linhas() const;
+    size_t colunas() const;
+    size_t nao_nulos() const;
+    FormatoEsparso formato() const;
+
+    const std::vector<size_t> &ponteiros() const;
+    const std::vector<size_t> &indices() const;
+    const std::vector<T> &valores() const;
+    std::vector<T> &valores();
+
+    T elemento(size_t linha, size_t coluna) const noexcept(!detail::checado);
+    std::vector<T> diagonal() const;
+
+    MatrizEsparsa<T> converter(FormatoEsparso formato) const;
+    MatrizEsparsa<T> transposta() const;
+    Matriz<T> densa() const;
+
+    void multiplicar(const T *x, T *y) const;
+    std::vector<T> operator*(const std::vector<T> &x) const;
+    Matriz<T> operator*(const Matriz<T> &x) const;
+};
+
+template <typename T>
+std::ostream &operator<<(std::ostream &os, const MatrizEsparsa<T> &m);
+
+} // namespace ifnum
+
+#include "MatrizEsparsa.tpp"
@@ -0,0 +1,475 @@
+/*!
+ * @file MatrizEsparsa.tpp
+ * @brief Implementações da classe template MatrizEsparsa.
+ */
+
+#ifdef __INTELLISENSE__
+#include "MatrizEsparsa.hpp"
+#endif
+
+namespace ifnum
+{
+namespace detail
+{
+/*!
+ * @brief Comprime triplas ao longo da dimensão principal (linhas em CSR, colunas em CSC).
+ *
+ * Ordena cada linha (ou coluna) pelo índice secundário e soma as triplas repetidas.
+ *
+ * @throws std::out_of_range Se alguma tripla estiver fora das dimensões da matriz.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void comprimir_triplas(size_t linhas, size_t colunas, const std::vector<Tripla<T>> &triplas,
+                       bool por_coluna, std::vector<size_t> &ponteiros,
+                       std::vector<size_t> &indices, std::vector<T> &valores)
+{
+    const size_t principal = por_coluna ? colunas : linhas;
+
+    ponteiros.assign(principal + 1, 0);
+    for (const Tripla<T> &t : triplas) {
+        if (t.linha >= linhas || t.coluna >= colunas)
+            throw std::out_of_range("Índices fora dos limites da matriz.");
+        ponteiros[(por_coluna ? t.coluna : t.linha) + 1]++;
+    }
+    for (size_t p = 0; p < principal; p++)
+        ponteiros[p + 1] += ponteiros[p];
+
+    indices.resize(triplas.size());
+    valores.resize(triplas.size());
+    std::vector<size_t> proximo(ponteiros.begin(), ponteiros.end() - 1);
+    for (const Tripla<T> &t : triplas) {
+        const size_t k = proximo[por_coluna ? t.coluna : t.linha]++;
+        indices[k] = por_coluna ? t.linha : t.coluna;
+        valores[k] = t.valor;
+    }
+
+    // Ordena cada segmento e junta repetidos; a escrita nunca ultrapassa a leitura.
+    std::vector<std::pair<size_t, T>> segmento;
+    size_t escrita = 0;
+    for (size_t p = 0; p < principal; p++) {
+        const size_t inicio = ponteiros[p], fim = ponteiros[p + 1];
+        segmento.clear();
+        for (size_t k = inicio; k < fim; k++)
+            segmento.emplace_back(indices[k], valores[k]);
+        std::stable_sort(segmento.begin(), segmento.end(),
+                         [](const auto &a, const auto &b) { return a.first < b.first; });
+
+        ponteiros[p] = escrita;
+        for (size_t k = 0; k < segmento.size(); k++) {
+            if (k > 0 && segmento[k].first == segmento[k - 1].first) {
+                valores[escrita - 1] += segmento[k].second;
+            } else {
+                indices[escrita] = segmento[k].first;
+                valores[escrita] = segmento[k].second;
+                escrita++;
+            }
+        }
+    }
+    ponteiros[principal] = escrita;
+    indices.resize(escrita);
+    valores.resize(escrita);
+}
+} // namespace detail
+
+/*!
+ * @brief Construtor de uma matriz esparsa sem elementos não nulos.
+ *
+ * @param linhas Número de linhas.
+ * @param colunas Número de colunas.
+ * @param formato Formato de armazenamento.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizEsparsa<T>::MatrizEsparsa(size_t linhas, size_t colunas, FormatoEsparso formato)
+    : linhas_(linhas), colunas_(colunas), formato_(formato),
+      ponteiros_((formato == FormatoEsparso::csr ? linhas : colunas) + 1, 0)
+{
+}
+
+/*!
+ * @brief Construtor a partir de uma lista de triplas (linha, coluna, valor).
+ *
+ * As triplas podem estar em qualquer ordem; triplas com a mesma posição são somadas,
+ * como é comum na montagem de sistemas por elementos finitos. Custo O(nnz log k), com
+ * k o maior número de elementos em uma linha (ou coluna).
+ *
+ * @param linhas Número de linhas.
+ * @param colunas Número de colunas.
+ * @param triplas Elementos da matriz.
+ * @param formato Formato de armazenamento.
+ * @throws std::out_of_range Se alguma tripla estiver fora das dimensões.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizEsparsa<T>::MatrizEsparsa(size_t linhas, size_t colunas,
+                                const std::vector<Tripla<T>> &triplas, FormatoEsparso formato)
+    : linhas_(linhas), colunas_(colunas), formato_(formato)
+{
+    detail::comprimir_triplas(linhas, colunas, triplas, formato == FormatoEsparso::csc,
+                              ponteiros_, indices_, valores_);
+}
+
+/*!
+ * @brief Construtor a partir de uma matriz densa (ou visão), descartando os zeros.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizEsparsa<T>::MatrizEsparsa(const ConstMatrizView<T> &densa, FormatoEsparso formato)
+    : linhas_(densa.linhas()), colunas_(densa.colunas()), formato_(FormatoEsparso::csr)
+{
+    ponteiros_.reserve(linhas_ + 1);
+    ponteiros_.push_back(0);
+    for (size_t i = 0; i < linhas_; i++) {
+        for (size_t j = 0; j < colunas_; j++) {
+            const T valor = densa.elemento(i, j);
+            if (valor != T(0)) {
+                indices_.push_back(j);
+                valores_.push_back(valor);
+            }
+        }
+        ponteiros_.push_back(indices_.size());
+    }
+    if (formato != formato_)
+        *this = converter(formato);
+}
+
+/*!
+ * @brief Construtor a partir de uma matriz densa, descartando os zeros.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizEsparsa<T>::MatrizEsparsa(const Matriz<T> &densa, FormatoEsparso formato)
+    : MatrizEsparsa(densa.visao(), formato)
+{
+}
+
+/*!
+ * @brief Cria a matriz identidade n x n em formato esparso.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizEsparsa<T> MatrizEsparsa<T>::identidade(size_t n, FormatoEsparso formato)
+{
+    MatrizEsparsa<T> I(n, n, formato);
+    I.indices_.resize(n);
+    I.valores_.assign(n, T(1));
+    for (size_t i = 0; i < n; i++) {
+        I.ponteiros_[i + 1] = i + 1;
+        I.indices_[i] = i;
+    }
+    return I;
+}
+
+template <typename T>
+size_t MatrizEsparsa<T>::linhas() const
+{
+    return linhas_;
+}
+
+template <typename T>
+size_t MatrizEsparsa<T>::colunas() const
+{
+    return colunas_;
+}
+
+/*!
+ * @brief Número de elementos armazenados (inclusive zeros explícitos).
+ */
+template <typename T>
+size_t MatrizEsparsa<T>::nao_nulos() const
+{
+    return valores_.size();
+}
+
+template <typename T>
+FormatoEsparso MatrizEsparsa<T>::formato() const
+{
+    return formato_;
+}
+
+/*!
+ * @brief Início de cada linha (CSR) ou coluna (CSC) em indices() e valores().
+ */
+template <typename T>
+const std::vector<size_t> &MatrizEsparsa<T>::ponteiros() const
+{
+    return ponteiros_;
+}
+
+/*!
+ * @brief Coluna (CSR) ou linha (CSC) de cada elemento armazenado.
+ */
+template <typename T>
+const std::vector<size_t> &MatrizEsparsa<T>::indices() const
+{
+    return indices_;
+}
+
+template <typename T>
+const std::vector<T> &MatrizEsparsa<T>::valores() const
+{
+    return valores_;
+}
+
+template <typename T>
+std::vector<T> &MatrizEsparsa<T>::valores()
+{
+    return valores_;
+}
+
+/*!
+ * @brief Retorna o elemento (linha, coluna), ou zero se ele não estiver armazenado.
+ *
+ * Faz uma busca binária na linha (CSR) ou coluna (CSC). A verificação de limites segue
+ * IFNUM_CHECKED.
+ *
+ * @throws std::out_of_range Se os índices estiverem fora dos limites (com IFNUM_CHECKED).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T MatrizEsparsa<T>::elemento(size_t linha, size_t coluna) const noexcept(!detail::checado)
+{
+    if constexpr (detail::checado) {
+        if (linha >= linhas_ || coluna >= colunas_)
+            throw std::out_of_range("Índices fora dos limites da matriz.");
+    }
+    const bool csr = formato_ == FormatoEsparso::csr;
+    const size_t p = csr ? linha : coluna;
+    const size_t s = csr ? coluna : linha;
+    const auto inicio = indices_.begin() + ponteiros_[p];
+    const auto fim = indices_.begin() + ponteiros_[p + 1];
+    const auto it = std::lower_bound(inicio, fim, s);
+    if (it == fim || *it != s)
+        return T(0);
+    return valores_[it - indices_.begin()];
+}
+
+/*!
+ * @brief Retorna a diagonal principal (com zeros onde não há elemento armazenado).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+std::vector<T> MatrizEsparsa<T>::diagonal() const
+{
+    const size_t n = std::min(linhas_, colunas_);
+    std::vector<T> d(n);
+    for (size_t i = 0; i < n; i++)
+        d[i] = elemento(i, i);
+    return d;
+}
+
+/*!
+ * @brief Retorna a mesma matriz no formato pedido (CSR para CSC ou vice-versa).
+ *
+ * A conversão é uma transposição por contagem, em O(nnz + linhas + colunas); os índices
+ * saem ordenados.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizEsparsa<T> MatrizEsparsa<T>::converter(FormatoEsparso formato) const
+{
+    if (formato == formato_)
+        return *this;
+
+    const size_t antigo = formato_ == FormatoEsparso::csr ? linhas_ : colunas_;
+    const size_t novo = formato_ == FormatoEsparso::csr ? colunas_ : linhas_;
+
+    MatrizEsparsa<T> r(linhas_, colunas_, formato);
+    for (size_t s : indices_)
+        r.ponteiros_[s + 1]++;
+    for (size_t p = 0; p < novo; p++)
+        r.ponteiros_[p + 1] += r.ponteiros_[p];
+
+    r.indices_.resize(indices_.size());
+    r.valores_.resize(valores_.size());
+    std::vector<size_t> proximo(r.ponteiros_.begin(), r.ponteiros_.end() - 1);
+    for (size_t p = 0; p < antigo; p++) {
+        for (size_t k = ponteiros_[p]; k < ponteiros_[p + 1]; k++) {
+            const size_t destino = proximo[indices_[k]]++;
+            r.indices_[destino] = p;
+            r.valores_[destino] = valores_[k];
+        }
+    }
+    return r;
+}
+
+/*!
+ * @brief Retorna a transposta, no mesmo formato desta matriz.
+ *
+ * Os vetores CSR de A são os vetores CSC de Aᵀ; basta reinterpretá-los e converter.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizEsparsa<T> MatrizEsparsa<T>::transposta() const
+{
+    MatrizEsparsa<T> t = *this;
+    std::swap(t.linhas_, t.colunas_);
+    t.formato_ = formato_ == FormatoEsparso::csr ? FormatoEsparso::csc : FormatoEsparso::csr;
+    return t.converter(formato_);
+}
+
+/*!
+ * @brief Converte para uma Matriz densa.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> MatrizEsparsa<T>::densa() const
+{
+    Matriz<T> d(linhas_, colunas_);
+    const bool csr = formato_ == FormatoEsparso::csr;
+    for (size_t p = 0; p + 1 < ponteiros_.size(); p++) {
+        for (size_t k = ponteiros_[p]; k < ponteiros_[p + 1]; k++) {
+            if (csr)
+                d.elemento(p, indices_[k]) = valores_[k];
+            else
+                d.elemento(indices_[k], p) = valores_[k];
+        }
+    }
+    return d;
+}
+
+/*!
+ * @brief Y = A * X, com X (colunas x k) e Y (linhas x k) densos em ordem de linha.
+ *
+ * Em CSR, cada linha de Y depende só da linha correspondente de A, e as linhas são
+ * distribuídas entre as threads do pool. Em CSC, as colunas de A espalham contribuições
+ * por Y inteira, então o produto é feito em série.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void MatrizEsparsa<T>::multiplicar_(const T *x, T *y, size_t k) const
+{
+    if (formato_ == FormatoEsparso::csc) {
+        std::fill(y, y + linhas_ * k, T(0));
+        for (size_t j = 0; j < colunas_; j++) {
+            const T *xj = x + j * k;
+            for (size_t e = ponteiros_[j]; e < ponteiros_[j + 1]; e++) {
+                T *yi = y + indices_[e] * k;
+                const T a = valores_[e];
+                for (size_t c = 0; c < k; c++)
+                    yi[c] += a * xj[c];
+            }
+        }
+        return;
+    }
+
+    const size_t media = linhas_ ? valores_.size() / linhas_ : 0;
+    paralelo::para(0, linhas_, (media + 1) * k, [&](size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++) {
+            if (k == 1) {
+                T soma = 0;
+                for (size_t e = ponteiros_[i]; e < ponteiros_[i + 1]; e++)
+                    soma += valores_[e] * x[indices_[e]];
+                y[i] = soma;
+                continue;
+            }
+            T *yi = y + i * k;
+            std::fill(yi, yi + k, T(0));
+            for (size_t e = ponteiros_[i]; e < ponteiros_[i + 1]; e++) {
+                const T *xj = x + indices_[e] * k;
+                const T a = valores_[e];
+                for (size_t c = 0; c < k; c++)
+                    yi[c] += a * xj[c];
+            }
+        }
+    });
+}
+
+/*!
+ * @brief Produto matriz-vetor y = A * x sobre buffers já alocados (SpMV).
+ *
+ * Não aloca memória, o que permite usá-lo nos laços dos métodos iterativos. `x` deve ter
+ * colunas() elementos e `y` deve ter linhas() elementos, sem sobreposição.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void MatrizEsparsa<T>::multiplicar(const T *x, T *y) const
+{
+    multiplicar_(x, y, 1);
+}
+
+/*!
+ * @brief Produto matriz-vetor.
+ *
+ * @throws std::invalid_argument Se x.size() for diferente de colunas().
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+std::vector<T> MatrizEsparsa<T>::operator*(const std::vector<T> &x) const
+{
+    if (x.size() != colunas_)
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+    std::vector<T> y(linhas_);
+    multiplicar_(x.data(), y.data(), 1);
+    return y;
+}
+
+/*!
+ * @brief Produto por uma matriz densa (um ou mais vetores coluna).
+ *
+ * @throws std::invalid_argument Se x.linhas() for diferente de colunas().
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> MatrizEsparsa<T>::operator*(const Matriz<T> &x) const
+{
+    if (x.linhas() != colunas_)
+        throw std::invalid_argument("Matrizes com dimensões incompatíveis para multiplicação.");
+    Matriz<T> y(linhas_, x.colunas());
+    multiplicar_(x.data(), y.data(), x.colunas());
+    return y;
+}
+
+/*!
+ * @brief Imprime os elementos armazenados, um por linha, como "(linha, coluna) valor".
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+std::ostream &operator<<(std::ostream &os, const MatrizEsparsa<T> &m)
+{
+    const bool csr = m.formato() == FormatoEsparso::csr;
+    const auto &ponteiros = m.ponteiros();
+    for (size_t p = 0; p + 1 < ponteiros.size(); p++) {
+        for (size_t k = ponteiros[p]; k < ponteiros[p + 1]; k++) {
+            const size_t i = csr ? p : m.indices()[k];
+            const size_t j = csr ? m.indices()[k] : p;
+            os << "(" << i << ", " << j << ") " << m.valores()[k] << std::endl;
+        }
+    }
+    return os;
+}
+
+} // namespace ifnum
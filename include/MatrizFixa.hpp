@@ -0,0 +1,169 @@
+/*!
+ * @file MatrizFixa.hpp
+ * @brief Declaração da classe template MatrizFixa (matriz de dimensões fixas em compilação).
+ *
+ * Para matrizes pequenas (2x2, 3x3, 4x4 etc.), os elementos ficam dentro do próprio objeto,
+ * em um std::array: nenhuma operação aloca memória e todas podem ser avaliadas em tempo de
+ * compilação (`constexpr`). Os laços têm tamanho conhecido e são totalmente desenrolados.
+ */
+
+#pragma once
+#include "Configuracao.hpp"
+#include "Matriz.hpp"
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ifnum
+{
+namespace detail
+{
+/*!
+ * @brief Chama `f(0)`, `f(1)`, ..., `f(N - 1)` sem laço (expansão de pacote).
+ */
+template <typename F, size_t... I>
+constexpr void desenrolar_(F &&f, std::index_sequence<I...>)
+{
+    (f(I), ...);
+}
+
+template <size_t N, typename F>
+constexpr void desenrolar(F &&f)
+{
+    desenrolar_(f, std::make_index_sequence<N>{});
+}
+
+/*! @brief Valor absoluto utilizável em `constexpr` (std::abs só é constexpr no C++23). */
+template <typename T>
+constexpr T abs_constexpr(T x)
+{
+    return x < T(0) ? -x : x;
+}
+} // namespace detail
+
+/*!
+ * @brief Matriz de R linhas e C colunas com armazenamento fixo, sem alocação dinâmica.
+ *
+ * Os elementos ficam em ordem de linha, como em Matriz. Aritmética, transposta,
+ * determinante e inversa são `constexpr`; determinante e inversa têm fórmulas fechadas
+ * para as ordens 1 a 4 e eliminação com pivotamento parcial para ordens maiores.
+ * Converte para Matriz<T> e a partir dela (ou de qualquer visão) quando necessário.
+ *
+ * @tparam T Tipo dos elementos.
+ * @tparam R Número de linhas.
+ * @tparam C Número de colunas.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+class MatrizFixa
+{
+  private:
+    std::array<T, R * C> dados_;
+
+  public:
+    using valor_tipo = T;
+
+    constexpr MatrizFixa();
+    constexpr MatrizFixa(std::initializer_list<T> valores);
+    constexpr explicit MatrizFixa(const std::array<T, R * C> &dados);
+    explicit MatrizFixa(const ConstMatrizView<T> &origem);
+
+    static constexpr MatrizFixa<T, R, C> identidade();
+
+    static constexpr size_t linhas()
+    {
+        return R;
+    }
+
+    static constexpr size_t colunas()
+    {
+        return C;
+    }
+
+    constexpr T *data()
+    {
+        return dados_.data();
+    }
+
+    constexpr const T *data() const
+    {
+        return dados_.data();
+    }
+
+    constexpr T &elemento(size_t linha, size_t coluna)
+    {
+        return dados_[linha * C + coluna];
+    }
+
+    constexpr const T &elemento(size_t linha, size_t coluna) const
+    {
+        return dados_[linha * C + coluna];
+    }
+
+    constexpr T &operator()(size_t linha, size_t coluna) noexcept(!detail::checado);
+    constexpr const T &operator()(size_t linha, size_t coluna) const
+        noexcept(!detail::checado);
+
+    constexpr MatrizFixa<T, C, R> transposta() const;
+    constexpr T determinante() const;
+    constexpr MatrizFixa<T, R, C> inversa() const;
+
+    Matriz<T> dinamica() const;
+    operator Matriz<T>() const;
+
+    constexpr MatrizFixa<T, R, C> &operator+=(const MatrizFixa<T, R, C> &outra);
+    constexpr MatrizFixa<T, R, C> &operator-=(const MatrizFixa<T, R, C> &outra);
+    constexpr MatrizFixa<T, R, C> &operator*=(T escalar);
+    constexpr MatrizFixa<T, R, C> &operator/=(T escalar);
+    constexpr bool operator==(const MatrizFixa<T, R, C> &outra) const;
+    constexpr bool operator!=(const MatrizFixa<T, R, C> &outra) const;
+};
+
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> operator+(const MatrizFixa<T, R, C> &a,
+                                        const MatrizFixa<T, R, C> &b);
+
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> operator-(const MatrizFixa<T, R, C> &a,
+                                        const MatrizFixa<T, R, C> &b);
+
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> operator-(const MatrizFixa<T, R, C> &a);
+
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> operator*(const MatrizFixa<T, R, C> &a,
+                                        typename MatrizFixa<T, R, C>::valor_tipo escalar);
+
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> operator*(typename MatrizFixa<T, R, C>::valor_tipo escalar,
+                                        const MatrizFixa<T, R, C> &a);
+
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> operator/(const MatrizFixa<T, R, C> &a,
+                                        typename MatrizFixa<T, R, C>::valor_tipo escalar);
+
+template <typename T, size_t R, size_t K, size_t C>
+constexpr MatrizFixa<T, R, C> operator*(const MatrizFixa<T, R, K> &a,
+                                        const MatrizFixa<T, K, C> &b);
+
+template <typename T, size_t R, size_t C>
+std::ostream &operator<<(std::ostream &os, const MatrizFixa<T, R, C> &m);
+
+/*! @brief Apelidos para as ordens mais usadas. */
+template <typename T>
+using Matriz2 = MatrizFixa<T, 2, 2>;
+template <typename T>
+using Matriz3 = MatrizFixa<T, 3, 3>;
+template <typename T>
+using Matriz4 = MatrizFixa<T, 4, 4>;
+
+} // namespace ifnum
+
+#include "MatrizFixa.tpp"
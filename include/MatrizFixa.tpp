@@ -0,0 +1,588 @@
+/*!
+ * @file MatrizFixa.tpp
+ * @brief Implementação da classe template MatrizFixa declarada em MatrizFixa.hpp.
+ */
+
+#ifdef __INTELLISENSE__
+#include "MatrizFixa.hpp"
+#endif
+
+namespace ifnum
+{
+/*!
+ * @brief Constrói uma matriz com todos os elementos iguais a zero.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C>::MatrizFixa() : dados_{}
+{
+}
+
+/*!
+ * @brief Constrói a matriz a partir de uma lista de valores em ordem de linha.
+ *
+ * Se houver menos valores que elementos, os restantes ficam com zero (como no construtor
+ * de Matriz com dados).
+ *
+ * @param valores Elementos em ordem de linha, ex.: `{a00, a01, a10, a11}`.
+ * @throws std::invalid_argument Se houver mais valores que elementos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C>::MatrizFixa(std::initializer_list<T> valores) : dados_{}
+{
+    if (valores.size() > R * C)
+        throw std::invalid_argument("Quantidade de valores maior que a ordem da matriz.");
+
+    size_t i = 0;
+    for (const T &valor : valores)
+        dados_[i++] = valor;
+}
+
+/*!
+ * @brief Constrói a matriz a partir de um std::array em ordem de linha.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C>::MatrizFixa(const std::array<T, R * C> &dados) : dados_(dados)
+{
+}
+
+/*!
+ * @brief Copia uma Matriz (ou uma visão, como um bloco de uma matriz maior).
+ *
+ * @param origem Matriz ou visão com exatamente R linhas e C colunas.
+ * @throws std::invalid_argument Se as dimensões forem diferentes.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+MatrizFixa<T, R, C>::MatrizFixa(const ConstMatrizView<T> &origem) : dados_{}
+{
+    if (origem.linhas() != R || origem.colunas() != C)
+        throw std::invalid_argument("Matrizes de ordens diferentes.");
+
+    detail::desenrolar<R * C>([&](size_t k) { dados_[k] = origem.elemento(k / C, k % C); });
+}
+
+/*!
+ * @brief Retorna a matriz identidade de ordem R.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> MatrizFixa<T, R, C>::identidade()
+{
+    static_assert(R == C, "A identidade só existe para matrizes quadradas.");
+
+    MatrizFixa<T, R, C> id;
+    detail::desenrolar<R>([&](size_t i) { id.elemento(i, i) = T(1); });
+    return id;
+}
+
+/*!
+ * @brief Acesso de escrita a um elemento (política de verificação de IFNUM_CHECKED).
+ *
+ * @throws std::out_of_range Se IFNUM_CHECKED estiver ativo e os índices forem inválidos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr T &MatrizFixa<T, R, C>::operator()(size_t linha, size_t coluna) noexcept(
+    !detail::checado)
+{
+    if constexpr (detail::checado) {
+        if (linha >= R || coluna >= C)
+            throw std::out_of_range("Índices fora dos limites da matriz.");
+    }
+
+    return dados_[linha * C + coluna];
+}
+
+/*!
+ * @brief Acesso de leitura a um elemento (política de verificação de IFNUM_CHECKED).
+ *
+ * @throws std::out_of_range Se IFNUM_CHECKED estiver ativo e os índices forem inválidos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr const T &MatrizFixa<T, R, C>::operator()(size_t linha, size_t coluna) const
+    noexcept(!detail::checado)
+{
+    if constexpr (detail::checado) {
+        if (linha >= R || coluna >= C)
+            throw std::out_of_range("Índices fora dos limites da matriz.");
+    }
+
+    return dados_[linha * C + coluna];
+}
+
+/*!
+ * @brief Retorna a transposta (C x R).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, C, R> MatrizFixa<T, R, C>::transposta() const
+{
+    MatrizFixa<T, C, R> t;
+    detail::desenrolar<R * C>(
+        [&](size_t k) { t.elemento(k % C, k / C) = dados_[k]; });
+    return t;
+}
+
+/*!
+ * @brief Calcula o determinante.
+ *
+ * Ordens 1 a 4 usam fórmulas fechadas (a de ordem 4 pelos menores 2x2 das duas primeiras
+ * e das duas últimas linhas). Para ordens maiores, tipos inteiros usam o algoritmo de
+ * Bareiss (exato, sem frações) e os demais, eliminação com pivotamento parcial.
+ *
+ * @return Determinante da matriz.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr T MatrizFixa<T, R, C>::determinante() const
+{
+    static_assert(R == C, "O determinante só existe para matrizes quadradas.");
+    const auto &a = dados_;
+
+    if constexpr (R == 0) {
+        return T(1);
+    } else if constexpr (R == 1) {
+        return a[0];
+    } else if constexpr (R == 2) {
+        return a[0] * a[3] - a[1] * a[2];
+    } else if constexpr (R == 3) {
+        return a[0] * (a[4] * a[8] - a[5] * a[7]) - a[1] * (a[3] * a[8] - a[5] * a[6]) +
+               a[2] * (a[3] * a[7] - a[4] * a[6]);
+    } else if constexpr (R == 4) {
+        const T s0 = a[0] * a[5] - a[4] * a[1];
+        const T s1 = a[0] * a[6] - a[4] * a[2];
+        const T s2 = a[0] * a[7] - a[4] * a[3];
+        const T s3 = a[1] * a[6] - a[5] * a[2];
+        const T s4 = a[1] * a[7] - a[5] * a[3];
+        const T s5 = a[2] * a[7] - a[6] * a[3];
+        const T c5 = a[10] * a[15] - a[14] * a[11];
+        const T c4 = a[9] * a[15] - a[13] * a[11];
+        const T c3 = a[9] * a[14] - a[13] * a[10];
+        const T c2 = a[8] * a[15] - a[12] * a[11];
+        const T c1 = a[8] * a[14] - a[12] * a[10];
+        const T c0 = a[8] * a[13] - a[12] * a[9];
+        return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    } else if constexpr (std::is_integral_v<T>) {
+        // Bareiss: cada divisão é exata, então o resultado inteiro não sofre arredondamento.
+        std::array<T, R * C> m = dados_;
+        int sinal = 1;
+        T anterior = T(1);
+        for (size_t k = 0; k + 1 < R; k++) {
+            if (m[k * C + k] == T(0)) {
+                size_t p = k + 1;
+                while (p < R && m[p * C + k] == T(0))
+                    p++;
+                if (p == R)
+                    return T(0);
+                for (size_t j = 0; j < C; j++) {
+                    T tmp = m[k * C + j];
+                    m[k * C + j] = m[p * C + j];
+                    m[p * C + j] = tmp;
+                }
+                sinal = -sinal;
+            }
+            for (size_t i = k + 1; i < R; i++)
+                for (size_t j = k + 1; j < C; j++)
+                    m[i * C + j] =
+                        (m[i * C + j] * m[k * C + k] - m[i * C + k] * m[k * C + j]) / anterior;
+            anterior = m[k * C + k];
+        }
+        return sinal < 0 ? T(-m[R * C - 1]) : m[R * C - 1];
+    } else {
+        std::array<T, R * C> m = dados_;
+        T det = T(1);
+        for (size_t k = 0; k < R; k++) {
+            size_t p = k;
+            for (size_t i = k + 1; i < R; i++)
+                if (detail::abs_constexpr(m[i * C + k]) > detail::abs_constexpr(m[p * C + k]))
+                    p = i;
+            if (m[p * C + k] == T(0))
+                return T(0);
+            if (p != k) {
+                for (size_t j = 0; j < C; j++) {
+                    T tmp = m[k * C + j];
+                    m[k * C + j] = m[p * C + j];
+                    m[p * C + j] = tmp;
+                }
+                det = -det;
+            }
+            det *= m[k * C + k];
+            for (size_t i = k + 1; i < R; i++) {
+                const T fator = m[i * C + k] / m[k * C + k];
+                for (size_t j = k + 1; j < C; j++)
+                    m[i * C + j] -= fator * m[k * C + j];
+            }
+        }
+        return det;
+    }
+}
+
+/*!
+ * @brief Calcula a inversa.
+ *
+ * Ordens 1 a 4 usam a adjunta (cofatores) dividida pelo determinante, sem laços nem
+ * desvios além do teste de singularidade. Ordens maiores usam Gauss-Jordan com
+ * pivotamento parcial.
+ *
+ * @return Matriz inversa.
+ * @throws std::runtime_error Se a matriz for singular.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> MatrizFixa<T, R, C>::inversa() const
+{
+    static_assert(R == C, "A inversa só existe para matrizes quadradas.");
+    static_assert(std::is_floating_point_v<T>, "A inversa exige elementos de ponto flutuante.");
+    const auto &a = dados_;
+    MatrizFixa<T, R, C> inv;
+    auto &b = inv.dados_;
+
+    if constexpr (R <= 4) {
+        const T det = determinante();
+        if (det == T(0))
+            throw std::runtime_error("Matriz singular");
+        const T d = T(1) / det;
+
+        if constexpr (R == 1) {
+            b[0] = d;
+        } else if constexpr (R == 2) {
+            b = {a[3] * d, -a[1] * d, -a[2] * d, a[0] * d};
+        } else if constexpr (R == 3) {
+            b = {(a[4] * a[8] - a[5] * a[7]) * d, (a[2] * a[7] - a[1] * a[8]) * d,
+                 (a[1] * a[5] - a[2] * a[4]) * d, (a[5] * a[6] - a[3] * a[8]) * d,
+                 (a[0] * a[8] - a[2] * a[6]) * d, (a[2] * a[3] - a[0] * a[5]) * d,
+                 (a[3] * a[7] - a[4] * a[6]) * d, (a[1] * a[6] - a[0] * a[7]) * d,
+                 (a[0] * a[4] - a[1] * a[3]) * d};
+        } else if constexpr (R == 4) {
+            const T s0 = a[0] * a[5] - a[4] * a[1];
+            const T s1 = a[0] * a[6] - a[4] * a[2];
+            const T s2 = a[0] * a[7] - a[4] * a[3];
+            const T s3 = a[1] * a[6] - a[5] * a[2];
+            const T s4 = a[1] * a[7] - a[5] * a[3];
+            const T s5 = a[2] * a[7] - a[6] * a[3];
+            const T c5 = a[10] * a[15] - a[14] * a[11];
+            const T c4 = a[9] * a[15] - a[13] * a[11];
+            const T c3 = a[9] * a[14] - a[13] * a[10];
+            const T c2 = a[8] * a[15] - a[12] * a[11];
+            const T c1 = a[8] * a[14] - a[12] * a[10];
+            const T c0 = a[8] * a[13] - a[12] * a[9];
+            b = {(a[5] * c5 - a[6] * c4 + a[7] * c3) * d,
+                 (-a[1] * c5 + a[2] * c4 - a[3] * c3) * d,
+                 (a[13] * s5 - a[14] * s4 + a[15] * s3) * d,
+                 (-a[9] * s5 + a[10] * s4 - a[11] * s3) * d,
+                 (-a[4] * c5 + a[6] * c2 - a[7] * c1) * d,
+                 (a[0] * c5 - a[2] * c2 + a[3] * c1) * d,
+                 (-a[12] * s5 + a[14] * s2 - a[15] * s1) * d,
+                 (a[8] * s5 - a[10] * s2 + a[11] * s1) * d,
+                 (a[4] * c4 - a[5] * c2 + a[7] * c0) * d,
+                 (-a[0] * c4 + a[1] * c2 - a[3] * c0) * d,
+                 (a[12] * s4 - a[13] * s2 + a[15] * s0) * d,
+                 (-a[8] * s4 + a[9] * s2 - a[11] * s0) * d,
+                 (-a[4] * c3 + a[5] * c1 - a[6] * c0) * d,
+                 (a[0] * c3 - a[1] * c1 + a[2] * c0) * d,
+                 (-a[12] * s3 + a[13] * s1 - a[14] * s0) * d,
+                 (a[8] * s3 - a[9] * s1 + a[10] * s0) * d};
+        }
+    } else {
+        std::array<T, R * C> m = dados_;
+        inv = identidade();
+        for (size_t k = 0; k < R; k++) {
+            size_t p = k;
+            for (size_t i = k + 1; i < R; i++)
+                if (detail::abs_constexpr(m[i * C + k]) > detail::abs_constexpr(m[p * C + k]))
+                    p = i;
+            if (m[p * C + k] == T(0))
+                throw std::runtime_error("Matriz singular");
+            if (p != k) {
+                for (size_t j = 0; j < C; j++) {
+                    T tmp = m[k * C + j];
+                    m[k * C + j] = m[p * C + j];
+                    m[p * C + j] = tmp;
+                    tmp = b[k * C + j];
+                    b[k * C + j] = b[p * C + j];
+                    b[p * C + j] = tmp;
+                }
+            }
+            const T pivo = m[k * C + k];
+            for (size_t j = 0; j < C; j++) {
+                m[k * C + j] /= pivo;
+                b[k * C + j] /= pivo;
+            }
+            for (size_t i = 0; i < R; i++) {
+                if (i == k)
+                    continue;
+                const T fator = m[i * C + k];
+                for (size_t j = 0; j < C; j++) {
+                    m[i * C + j] -= fator * m[k * C + j];
+                    b[i * C + j] -= fator * b[k * C + j];
+                }
+            }
+        }
+    }
+
+    return inv;
+}
+
+/*!
+ * @brief Copia os elementos para uma Matriz<T> (alocada dinamicamente).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+Matriz<T> MatrizFixa<T, R, C>::dinamica() const
+{
+    return Matriz<T>(ConstMatrizView<T>(dados_.data(), R, C, C));
+}
+
+/*!
+ * @brief Converte implicitamente para Matriz<T> (equivalente a dinamica()).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+MatrizFixa<T, R, C>::operator Matriz<T>() const
+{
+    return dinamica();
+}
+
+/*!
+ * @brief Soma outra matriz de mesma ordem a esta.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> &MatrizFixa<T, R, C>::operator+=(const MatrizFixa<T, R, C> &outra)
+{
+    detail::desenrolar<R * C>([&](size_t k) { dados_[k] += outra.dados_[k]; });
+    return *this;
+}
+
+/*!
+ * @brief Subtrai outra matriz de mesma ordem desta.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> &MatrizFixa<T, R, C>::operator-=(const MatrizFixa<T, R, C> &outra)
+{
+    detail::desenrolar<R * C>([&](size_t k) { dados_[k] -= outra.dados_[k]; });
+    return *this;
+}
+
+/*!
+ * @brief Multiplica todos os elementos por um escalar.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> &MatrizFixa<T, R, C>::operator*=(T escalar)
+{
+    detail::desenrolar<R * C>([&](size_t k) { dados_[k] *= escalar; });
+    return *this;
+}
+
+/*!
+ * @brief Divide todos os elementos por um escalar.
+ *
+ * @throws std::invalid_argument Se o escalar for zero.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> &MatrizFixa<T, R, C>::operator/=(T escalar)
+{
+    if (escalar == 0)
+        throw std::invalid_argument("Divisão por zero.");
+
+    detail::desenrolar<R * C>([&](size_t k) { dados_[k] /= escalar; });
+    return *this;
+}
+
+/*!
+ * @brief Compara duas matrizes elemento a elemento.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr bool MatrizFixa<T, R, C>::operator==(const MatrizFixa<T, R, C> &outra) const
+{
+    bool iguais = true;
+    detail::desenrolar<R * C>([&](size_t k) { iguais = iguais && dados_[k] == outra.dados_[k]; });
+    return iguais;
+}
+
+/*!
+ * @brief Compara duas matrizes quanto à desigualdade.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr bool MatrizFixa<T, R, C>::operator!=(const MatrizFixa<T, R, C> &outra) const
+{
+    return !(*this == outra);
+}
+
+/*!
+ * @brief Soma elemento a elemento.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> operator+(const MatrizFixa<T, R, C> &a, const MatrizFixa<T, R, C> &b)
+{
+    MatrizFixa<T, R, C> r = a;
+    r += b;
+    return r;
+}
+
+/*!
+ * @brief Subtração elemento a elemento.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> operator-(const MatrizFixa<T, R, C> &a, const MatrizFixa<T, R, C> &b)
+{
+    MatrizFixa<T, R, C> r = a;
+    r -= b;
+    return r;
+}
+
+/*!
+ * @brief Negação elemento a elemento.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> operator-(const MatrizFixa<T, R, C> &a)
+{
+    MatrizFixa<T, R, C> r;
+    detail::desenrolar<R * C>([&](size_t k) { r.data()[k] = -a.data()[k]; });
+    return r;
+}
+
+/*!
+ * @brief Multiplicação por escalar.
+ *
+ * O escalar não participa da dedução de T, então qualquer valor conversível para T é aceito
+ * (`m * 2` com m de double).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> operator*(const MatrizFixa<T, R, C> &a,
+                                        typename MatrizFixa<T, R, C>::valor_tipo escalar)
+{
+    MatrizFixa<T, R, C> r = a;
+    r *= escalar;
+    return r;
+}
+
+/*!
+ * @brief Multiplicação por escalar, com o escalar à esquerda.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> operator*(typename MatrizFixa<T, R, C>::valor_tipo escalar,
+                                        const MatrizFixa<T, R, C> &a)
+{
+    MatrizFixa<T, R, C> r = a;
+    r *= escalar;
+    return r;
+}
+
+/*!
+ * @brief Divisão por escalar.
+ *
+ * @throws std::invalid_argument Se o escalar for zero.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+constexpr MatrizFixa<T, R, C> operator/(const MatrizFixa<T, R, C> &a,
+                                        typename MatrizFixa<T, R, C>::valor_tipo escalar)
+{
+    MatrizFixa<T, R, C> r = a;
+    r /= escalar;
+    return r;
+}
+
+/*!
+ * @brief Produto matricial (R x K) * (K x C), totalmente desenrolado.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t K, size_t C>
+constexpr MatrizFixa<T, R, C> operator*(const MatrizFixa<T, R, K> &a, const MatrizFixa<T, K, C> &b)
+{
+    MatrizFixa<T, R, C> r;
+    detail::desenrolar<R * C>([&](size_t ij) {
+        const size_t i = ij / C, j = ij % C;
+        T soma{};
+        detail::desenrolar<K>([&](size_t k) { soma += a.elemento(i, k) * b.elemento(k, j); });
+        r.elemento(i, j) = soma;
+    });
+    return r;
+}
+
+/*!
+ * @brief Imprime a matriz no mesmo formato de Matriz.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T, size_t R, size_t C>
+std::ostream &operator<<(std::ostream &os, const MatrizFixa<T, R, C> &m)
+{
+    const size_t largura = 10;
+
+    for (size_t i = 0; i < R; ++i) {
+        for (size_t j = 0; j < C; ++j)
+            os << std::setw(largura) << m.elemento(i, j);
+        os << std::endl;
+    }
+
+    return os;
+}
+
+} // namespace ifnum
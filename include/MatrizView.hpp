@@ -0,0 +1,156 @@
+/*!
+ * @file MatrizView.hpp
+ * @brief Declaração das visões (views) não proprietárias sobre dados de matrizes.
+ *
+ * Uma visão descreve um bloco de memória já existente (de uma Matriz ou de um buffer
+ * externo) por ponteiro, dimensões e passos entre linhas e colunas. Linhas, colunas,
+ * submatrizes e transpostas podem ser obtidas sem copiar nenhum elemento.
+ */
+
+#pragma once
+#include "Configuracao.hpp"
+#include "Expressao.hpp"
+#include "Paralelo.hpp"
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ifnum
+{
+template <typename T>
+class ConstMatrizView;
+
+namespace detail
+{
+template <typename T>
+bool sobrepostas(const ConstMatrizView<T> &a, const ConstMatrizView<T> &b);
+} // namespace detail
+
+/*!
+ * @brief Visão somente leitura sobre os elementos de uma matriz.
+ *
+ * O elemento (i, j) fica em `data()[i * passo_linha() + j * passo_coluna()]`. A visão não
+ * é dona dos dados: quem a cria garante que eles vivem mais que ela. Os acessos seguem a
+ * mesma política de verificação de limites de Matriz (ver IFNUM_CHECKED).
+ *
+ * @tparam T Tipo dos elementos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+class ConstMatrizView : public ExpressaoMatriz<ConstMatrizView<T>>
+{
+  protected:
+    const T *dados_;
+    size_t linhas_;
+    size_t colunas_;
+    size_t passo_linha_;
+    size_t passo_coluna_;
+
+  public:
+    using valor_tipo = T;
+
+    ConstMatrizView(const T *dados, size_t linhas, size_t colunas, size_t passo_linha);
+    ConstMatrizView(const T *dados, size_t linhas, size_t colunas, size_t passo_linha,
+                    size_t passo_coluna);
+
+    size_t linhas() const
+    {
+        return linhas_;
+    }
+
+    size_t colunas() const
+    {
+        return colunas_;
+    }
+
+    size_t passo_linha() const
+    {
+        return passo_linha_;
+    }
+
+    size_t passo_coluna() const
+    {
+        return passo_coluna_;
+    }
+
+    const T *data() const
+    {
+        return dados_;
+    }
+
+    const T &elemento(size_t linha, size_t coluna) const noexcept(!detail::checado)
+    {
+        if constexpr (detail::checado) {
+            if (linha >= linhas_ || coluna >= colunas_)
+                throw std::out_of_range("Índices fora dos limites da matriz.");
+        }
+
+        return dados_[linha * passo_linha_ + coluna * passo_coluna_];
+    }
+
+    bool linhas_contiguas() const;
+    template <typename U>
+    bool conflita(const ConstMatrizView<U> &destino) const;
+
+    ConstMatrizView<T> linha(size_t indice) const;
+    ConstMatrizView<T> coluna(size_t indice) const;
+    ConstMatrizView<T> bloco(size_t linha, size_t coluna, size_t linhas, size_t colunas) const;
+    ConstMatrizView<T> transposta() const;
+};
+
+/*!
+ * @brief Visão com acesso de escrita sobre os elementos de uma matriz.
+ *
+ * Deriva de ConstMatrizView, então pode ser usada em qualquer lugar que aceite uma visão
+ * somente leitura. Atribuir uma expressão a uma visão escreve nos dados referenciados.
+ *
+ * @tparam T Tipo dos elementos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+class MatrizView : public ConstMatrizView<T>
+{
+  public:
+    MatrizView(T *dados, size_t linhas, size_t colunas, size_t passo_linha);
+    MatrizView(T *dados, size_t linhas, size_t colunas, size_t passo_linha, size_t passo_coluna);
+    MatrizView(const MatrizView &) = default;
+
+    T *data() const
+    {
+        return const_cast<T *>(this->dados_);
+    }
+
+    T &elemento(size_t linha, size_t coluna) const noexcept(!detail::checado)
+    {
+        return const_cast<T &>(ConstMatrizView<T>::elemento(linha, coluna));
+    }
+
+    T &operator()(size_t linha, size_t coluna) const noexcept(!detail::checado);
+
+    MatrizView<T> linha(size_t indice) const;
+    MatrizView<T> coluna(size_t indice) const;
+    MatrizView<T> bloco(size_t linha, size_t coluna, size_t linhas, size_t colunas) const;
+    MatrizView<T> transposta() const;
+
+    void preencher(T valor) const;
+    void trocar_linhas(size_t indice1, size_t indice2) const;
+
+    const MatrizView<T> &operator=(const MatrizView<T> &outra) const;
+    template <typename E>
+    const MatrizView<T> &operator=(const ExpressaoMatriz<E> &expressao) const;
+    template <typename E>
+    const MatrizView<T> &operator+=(const ExpressaoMatriz<E> &expressao) const;
+    template <typename E>
+    const MatrizView<T> &operator-=(const ExpressaoMatriz<E> &expressao) const;
+    const MatrizView<T> &operator*=(T escalar) const;
+    const MatrizView<T> &operator/=(T escalar) const;
+};
+
+} // namespace ifnum
+
+#include "MatrizView.tpp"
@@ -0,0 +1,467 @@
+/*!
+ * @file MatrizView.tpp
+ * @brief Implementação das visões declaradas em MatrizView.hpp.
+ */
+
+#ifdef __INTELLISENSE__
+#include "MatrizView.hpp"
+#endif
+
+namespace ifnum
+{
+/*!
+ * @brief Cria uma visão somente leitura de um buffer em ordem de linha.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param dados Ponteiro para o elemento (0, 0).
+ * @param linhas Número de linhas.
+ * @param colunas Número de colunas.
+ * @param passo_linha Distância, em elementos, entre linhas consecutivas (leading dimension).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+ConstMatrizView<T>::ConstMatrizView(const T *dados, size_t linhas, size_t colunas,
+                                    size_t passo_linha)
+    : ConstMatrizView(dados, linhas, colunas, passo_linha, 1)
+{
+}
+
+/*!
+ * @brief Cria uma visão somente leitura com passos arbitrários entre linhas e colunas.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param dados Ponteiro para o elemento (0, 0).
+ * @param linhas Número de linhas.
+ * @param colunas Número de colunas.
+ * @param passo_linha Distância, em elementos, entre linhas consecutivas.
+ * @param passo_coluna Distância, em elementos, entre colunas consecutivas.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+ConstMatrizView<T>::ConstMatrizView(const T *dados, size_t linhas, size_t colunas,
+                                    size_t passo_linha, size_t passo_coluna)
+    : dados_(dados), linhas_(linhas), colunas_(colunas), passo_linha_(passo_linha),
+      passo_coluna_(passo_coluna)
+{
+}
+
+/*!
+ * @brief Indica se os elementos de cada linha são contíguos (passo de coluna igual a 1).
+ *
+ * Visões com linhas contíguas podem ser passadas diretamente aos kernels (GEMM, LU).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+bool ConstMatrizView<T>::linhas_contiguas() const
+{
+    return passo_coluna_ == 1 || colunas_ <= 1;
+}
+
+/*!
+ * @brief Indica se escrever em `destino` pode alterar um elemento desta visão antes de lê-lo.
+ *
+ * Faz parte do protocolo de ExpressaoMatriz: a avaliação elemento a elemento em `destino`
+ * só é segura se cada elemento (i, j) lido estiver na mesma posição de memória do (i, j)
+ * escrito, ou em memória que não se sobrepõe ao destino.
+ *
+ * @tparam U Tipo dos elementos do destino.
+ * @param destino Região que será escrita.
+ * @return true se houver sobreposição com disposição diferente (ex.: `A = A.transposta()`).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+template <typename U>
+bool ConstMatrizView<T>::conflita(const ConstMatrizView<U> &destino) const
+{
+    if constexpr (!std::is_same_v<T, U>) {
+        return false;
+    } else {
+        if (dados_ == destino.data() && passo_linha_ == destino.passo_linha() &&
+            passo_coluna_ == destino.passo_coluna())
+            return false;
+
+        return detail::sobrepostas(*this, destino);
+    }
+}
+
+namespace detail
+{
+/*!
+ * @brief Indica se as regiões de memória cobertas por duas visões se sobrepõem.
+ *
+ * Compara os intervalos entre o primeiro e o último elemento de cada visão; é conservadora
+ * para visões espaçadas que se intercalam sem compartilhar elementos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+bool sobrepostas(const ConstMatrizView<T> &a, const ConstMatrizView<T> &b)
+{
+    if (a.linhas() == 0 || a.colunas() == 0 || b.linhas() == 0 || b.colunas() == 0)
+        return false;
+
+    const T *fim_a = &a.elemento(a.linhas() - 1, a.colunas() - 1) + 1;
+    const T *fim_b = &b.elemento(b.linhas() - 1, b.colunas() - 1) + 1;
+    std::less<const T *> menor;
+
+    return menor(a.data(), fim_b) && menor(b.data(), fim_a);
+}
+} // namespace detail
+
+/*!
+ * @brief Visão da linha `indice` (1 x colunas).
+ *
+ * @throws std::out_of_range Se o índice estiver fora dos limites.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+ConstMatrizView<T> ConstMatrizView<T>::linha(size_t indice) const
+{
+    if (indice >= linhas_)
+        throw std::out_of_range("Índice de linha fora dos limites.");
+
+    return ConstMatrizView<T>(dados_ + indice * passo_linha_, 1, colunas_, passo_linha_,
+                              passo_coluna_);
+}
+
+/*!
+ * @brief Visão da coluna `indice` (linhas x 1).
+ *
+ * @throws std::out_of_range Se o índice estiver fora dos limites.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+ConstMatrizView<T> ConstMatrizView<T>::coluna(size_t indice) const
+{
+    if (indice >= colunas_)
+        throw std::out_of_range("Índice de coluna fora dos limites.");
+
+    return ConstMatrizView<T>(dados_ + indice * passo_coluna_, linhas_, 1, passo_linha_,
+                              passo_coluna_);
+}
+
+/*!
+ * @brief Visão da submatriz que começa em (linha, coluna) com as dimensões dadas.
+ *
+ * @throws std::out_of_range Se o bloco ultrapassar os limites da visão.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+ConstMatrizView<T> ConstMatrizView<T>::bloco(size_t linha, size_t coluna, size_t linhas,
+                                             size_t colunas) const
+{
+    if (linha + linhas > linhas_ || coluna + colunas > colunas_)
+        throw std::out_of_range("Bloco fora dos limites da matriz.");
+
+    return ConstMatrizView<T>(dados_ + linha * passo_linha_ + coluna * passo_coluna_, linhas,
+                              colunas, passo_linha_, passo_coluna_);
+}
+
+/*!
+ * @brief Visão transposta (troca os passos; nenhum elemento é copiado).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+ConstMatrizView<T> ConstMatrizView<T>::transposta() const
+{
+    return ConstMatrizView<T>(dados_, colunas_, linhas_, passo_coluna_, passo_linha_);
+}
+
+/*!
+ * @brief Cria uma visão com escrita de um buffer em ordem de linha.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param dados Ponteiro para o elemento (0, 0).
+ * @param linhas Número de linhas.
+ * @param colunas Número de colunas.
+ * @param passo_linha Distância, em elementos, entre linhas consecutivas (leading dimension).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizView<T>::MatrizView(T *dados, size_t linhas, size_t colunas, size_t passo_linha)
+    : ConstMatrizView<T>(dados, linhas, colunas, passo_linha, 1)
+{
+}
+
+/*!
+ * @brief Cria uma visão com escrita e passos arbitrários entre linhas e colunas.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizView<T>::MatrizView(T *dados, size_t linhas, size_t colunas, size_t passo_linha,
+                          size_t passo_coluna)
+    : ConstMatrizView<T>(dados, linhas, colunas, passo_linha, passo_coluna)
+{
+}
+
+/*!
+ * @brief Acesso de escrita a um elemento (equivalente a elemento()).
+ *
+ * @throws std::out_of_range Se IFNUM_CHECKED estiver ativo e os índices forem inválidos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T &MatrizView<T>::operator()(size_t linha, size_t coluna) const noexcept(!detail::checado)
+{
+    return elemento(linha, coluna);
+}
+
+/*!
+ * @brief Visão com escrita da linha `indice`.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizView<T> MatrizView<T>::linha(size_t indice) const
+{
+    ConstMatrizView<T> v = ConstMatrizView<T>::linha(indice);
+    return MatrizView<T>(const_cast<T *>(v.data()), v.linhas(), v.colunas(), v.passo_linha(),
+                         v.passo_coluna());
+}
+
+/*!
+ * @brief Visão com escrita da coluna `indice`.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizView<T> MatrizView<T>::coluna(size_t indice) const
+{
+    ConstMatrizView<T> v = ConstMatrizView<T>::coluna(indice);
+    return MatrizView<T>(const_cast<T *>(v.data()), v.linhas(), v.colunas(), v.passo_linha(),
+                         v.passo_coluna());
+}
+
+/*!
+ * @brief Visão com escrita de uma submatriz.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizView<T> MatrizView<T>::bloco(size_t linha, size_t coluna, size_t linhas,
+                                   size_t colunas) const
+{
+    ConstMatrizView<T> v = ConstMatrizView<T>::bloco(linha, coluna, linhas, colunas);
+    return MatrizView<T>(const_cast<T *>(v.data()), v.linhas(), v.colunas(), v.passo_linha(),
+                         v.passo_coluna());
+}
+
+/*!
+ * @brief Visão transposta com escrita.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+MatrizView<T> MatrizView<T>::transposta() const
+{
+    return MatrizView<T>(data(), this->colunas_, this->linhas_, this->passo_coluna_,
+                         this->passo_linha_);
+}
+
+/*!
+ * @brief Atribui `valor` a todos os elementos da visão.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void MatrizView<T>::preencher(T valor) const
+{
+    for (size_t i = 0; i < this->linhas_; i++)
+        for (size_t j = 0; j < this->colunas_; j++)
+            elemento(i, j) = valor;
+}
+
+/*!
+ * @brief Troca duas linhas da visão entre si.
+ *
+ * @throws std::out_of_range Se algum índice estiver fora dos limites.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void MatrizView<T>::trocar_linhas(size_t indice1, size_t indice2) const
+{
+    if (indice1 >= this->linhas_ || indice2 >= this->linhas_)
+        throw std::out_of_range("Índice/s de linha além do limite da matriz.");
+
+    if (indice1 == indice2)
+        return;
+
+    for (size_t j = 0; j < this->colunas_; j++)
+        std::swap(elemento(indice1, j), elemento(indice2, j));
+}
+
+/*!
+ * @brief Copia os elementos de outra visão para os elementos desta.
+ *
+ * Ao contrário de ConstMatrizView, atribuir uma MatrizView não troca a região referenciada:
+ * escreve nela.
+ *
+ * @throws std::invalid_argument Se as dimensões forem diferentes.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+const MatrizView<T> &MatrizView<T>::operator=(const MatrizView<T> &outra) const
+{
+    return *this = static_cast<const ExpressaoMatriz<ConstMatrizView<T>> &>(outra);
+}
+
+/*!
+ * @brief Avalia uma expressão diretamente nos elementos referenciados pela visão.
+ *
+ * Se a expressão ler a mesma memória com outra disposição (por exemplo, um bloco
+ * deslocado da mesma matriz), ela é avaliada antes em uma matriz temporária.
+ *
+ * @throws std::invalid_argument Se as dimensões forem diferentes.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+template <typename E>
+const MatrizView<T> &MatrizView<T>::operator=(const ExpressaoMatriz<E> &expressao) const
+{
+    const E &e = expressao.derivada();
+
+    if (e.linhas() != this->linhas_ || e.colunas() != this->colunas_)
+        throw std::invalid_argument("Matrizes de ordens diferentes.");
+
+    if (e.conflita(*this))
+        return *this = Matriz<T>(e);
+
+    paralelo::para(0, this->linhas_, this->colunas_, [&](size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++)
+            for (size_t j = 0; j < this->colunas_; j++)
+                elemento(i, j) = e.elemento(i, j);
+    });
+
+    return *this;
+}
+
+/*!
+ * @brief Soma uma expressão aos elementos referenciados pela visão.
+ *
+ * @throws std::invalid_argument Se as dimensões forem diferentes.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+template <typename E>
+const MatrizView<T> &MatrizView<T>::operator+=(const ExpressaoMatriz<E> &expressao) const
+{
+    const E &e = expressao.derivada();
+
+    if (e.linhas() != this->linhas_ || e.colunas() != this->colunas_)
+        throw std::invalid_argument("Matrizes de ordens diferentes.");
+
+    if (e.conflita(*this))
+        return *this += Matriz<T>(e);
+
+    paralelo::para(0, this->linhas_, this->colunas_, [&](size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++)
+            for (size_t j = 0; j < this->colunas_; j++)
+                elemento(i, j) += e.elemento(i, j);
+    });
+
+    return *this;
+}
+
+/*!
+ * @brief Subtrai uma expressão dos elementos referenciados pela visão.
+ *
+ * @throws std::invalid_argument Se as dimensões forem diferentes.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+template <typename E>
+const MatrizView<T> &MatrizView<T>::operator-=(const ExpressaoMatriz<E> &expressao) const
+{
+    const E &e = expressao.derivada();
+
+    if (e.linhas() != this->linhas_ || e.colunas() != this->colunas_)
+        throw std::invalid_argument("Matrizes de ordens diferentes.");
+
+    if (e.conflita(*this))
+        return *this -= Matriz<T>(e);
+
+    paralelo::para(0, this->linhas_, this->colunas_, [&](size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++)
+            for (size_t j = 0; j < this->colunas_; j++)
+                elemento(i, j) -= e.elemento(i, j);
+    });
+
+    return *this;
+}
+
+/*!
+ * @brief Multiplica os elementos referenciados pela visão por um escalar.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+const MatrizView<T> &MatrizView<T>::operator*=(T escalar) const
+{
+    for (size_t i = 0; i < this->linhas_; i++)
+        for (size_t j = 0; j < this->colunas_; j++)
+            elemento(i, j) *= escalar;
+
+    return *this;
+}
+
+/*!
+ * @brief Divide os elementos referenciados pela visão por um escalar.
+ *
+ * @throws std::invalid_argument Se o escalar for zero.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+const MatrizView<T> &MatrizView<T>::operator/=(T escalar) const
+{
+    if (escalar == 0)
+        throw std::invalid_argument("Divisão por zero.");
+
+    for (size_t i = 0; i < this->linhas_; i++)
+        for (size_t j = 0; j < this->colunas_; j++)
+            elemento(i, j) /= escalar;
+
+    return *this;
+}
+
+} // namespace ifnum
@@ -0,0 +1,32 @@
+/*!
+ * @file Paralelo.hpp
+ * @brief Backend de execução paralela da biblioteca (pool de threads com roubo de tarefas).
+ *
+ * O número de threads pode ser definido pela variável de ambiente `IFNUM_THREADS` ou por
+ * `paralelo::definir_threads`. Trabalhos cujo custo estimado fica abaixo do limiar
+ * (`IFNUM_LIMIAR` ou `paralelo::definir_limiar`) são executados em série, na própria
+ * thread chamadora. Com uma única thread, todo o código roda em série.
+ */
+
+#pragma once
+#include <cstddef>
+#include <functional>
+
+namespace ifnum::paralelo
+{
+
+void definir_threads(size_t quantidade);
+size_t threads();
+
+void definir_limiar(size_t custo);
+size_t limiar();
+
+void executar(size_t inicio, size_t fim, size_t partes,
+              const std::function<void(size_t, size_t)> &tarefa);
+
+template <typename F>
+void para(size_t inicio, size_t fim, size_t custo_por_indice, F &&tarefa);
+
+} // namespace ifnum::paralelo
+
+#include "Paralelo.tpp"
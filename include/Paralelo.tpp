@@ -0,0 +1,50 @@
+/*!
+ * @file Paralelo.tpp
+ * @brief Implementação dos templates do backend paralelo declarados em Paralelo.hpp.
+ */
+
+#ifdef __INTELLISENSE__
+#include "Paralelo.hpp"
+#endif
+
+namespace ifnum::paralelo
+{
+/*!
+ * @brief Executa `tarefa(ini, fim)` sobre subintervalos de [inicio, fim), possivelmente em paralelo.
+ *
+ * O custo total estimado é `(fim - inicio) * custo_por_indice`. Se ele for menor que o
+ * limiar configurado, ou se houver uma única thread, a tarefa é chamada uma única vez
+ * com o intervalo inteiro, na thread atual. Caso contrário, o intervalo é dividido em
+ * partes contíguas distribuídas no pool. Cada índice é processado exatamente uma vez,
+ * então tarefas que só escrevem nos próprios índices produzem o mesmo resultado com
+ * qualquer número de threads.
+ *
+ * @tparam F Tipo chamável com assinatura `void(size_t, size_t)`.
+ * @param inicio Primeiro índice.
+ * @param fim Índice após o último.
+ * @param custo_por_indice Estimativa de operações por índice.
+ * @param tarefa Função aplicada a cada subintervalo.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+template <typename F>
+void para(size_t inicio, size_t fim, size_t custo_por_indice, F &&tarefa)
+{
+    if (fim <= inicio)
+        return;
+
+    const size_t n = fim - inicio;
+    const size_t t = threads();
+
+    if (t <= 1 || n < 2 || n * custo_por_indice < limiar()) {
+        tarefa(inicio, fim);
+        return;
+    }
+
+    // Mais partes que threads para que o roubo de tarefas equilibre a carga.
+    const size_t partes = n < t * 4 ? n : t * 4;
+    executar(inicio, fim, partes, std::function<void(size_t, size_t)>(tarefa));
+}
+
+} // namespace ifnum::paralelo
@@ -0,0 +1,78 @@
+/*!
+ * @file QR.hpp
+ * @brief Declaração da classe template QR (fatoração de Householder blocada).
+ *
+ * A fatoração A = Q * R de uma matriz m x n (m >= n) resolve sistemas quadrados e problemas
+ * de mínimos quadrados (min ||A x - b||₂) sem formar AᵀA, que teria o número de condição
+ * elevado ao quadrado.
+ */
+
+#pragma once
+#include "Cholesky.hpp"
+#include "Matriz.hpp"
+#include <vector>
+
+namespace ifnum
+{
+/*!
+ * @brief Fatoração QR por refletores de Householder: A = Q * R.
+ *
+ * R (triangular superior, n x n) fica acima da diagonal da matriz de trabalho e os vetores
+ * de Householder abaixo dela, como no LAPACK; Q não é formada, a não ser que seja pedida
+ * (ver Q()). A fatoração é blocada: cada painel de `bloco_` colunas é fatorado refletor a
+ * refletor, os refletores do painel são acumulados na forma compacta I - V T Vᵀ e aplicados
+ * ao restante da matriz com o kernel GEMM.
+ *
+ * Não há pivotamento de colunas, então o posto (posto()) é uma estimativa a partir da
+ * diagonal de R: confiável para matrizes de posto completo ou claramente deficientes, mas
+ * não em casos limítrofes. `resolver` lança exceção se o posto for incompleto.
+ *
+ * @tparam T Tipo dos elementos (ponto flutuante).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+class QR
+{
+  private:
+    size_t m_ = 0;
+    size_t n_ = 0;
+    std::vector<T, AlocadorArena<T>> qr_;
+    std::vector<T, AlocadorArena<T>> tau_;
+    std::vector<T, AlocadorArena<T>> t_; // fatores T de cada painel, bloco_ x bloco_
+    std::vector<T, AlocadorArena<T>> trabalho_;
+
+    static constexpr size_t bloco_ = 64;
+
+    void fatorar_painel_(size_t k0, size_t kb);
+    void formar_t_(size_t k0, size_t kb);
+    void aplicar_bloco_(size_t k0, size_t kb);
+    T tolerancia_padrao_() const;
+
+  public:
+    explicit QR(const Matriz<T> &A);
+    explicit QR(const ConstMatrizView<T> &A);
+    QR(const ConstMatrizView<T> &A, Arena &area);
+
+    void fatorar(const Matriz<T> &A);
+    void fatorar(const ConstMatrizView<T> &A);
+
+    size_t linhas() const;
+    size_t colunas() const;
+    size_t posto(T tolerancia = T(-1)) const;
+    bool posto_completo() const;
+
+    Matriz<T> Q() const;
+    Matriz<T> R() const;
+    T condicao() const;
+
+    void aplicar_qt(const MatrizView<T> &b) const;
+    Matriz<T> resolver(const Matriz<T> &b) const;
+    Matriz<T> resolver(const ConstMatrizView<T> &b) const;
+    void resolver(const ConstMatrizView<T> &b, const MatrizView<T> &x) const;
+};
+
+} // namespace ifnum
+
+#include "QR.tpp"
@@ -0,0 +1,620 @@
+/*!
+ * @file QR.tpp
+ * @brief Implementação da classe template QR declarada em QR.hpp.
+ */
+
+#ifdef __INTELLISENSE__
+#include "QR.hpp"
+#endif
+
+namespace ifnum
+{
+/*!
+ * @brief Fatora a matriz A (m x n, m >= n).
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Matriz a ser fatorada.
+ * @throws std::invalid_argument Se A tiver menos linhas que colunas.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+QR<T>::QR(const Matriz<T> &A)
+{
+    fatorar(A.visao());
+}
+
+/*!
+ * @brief Fatora a matriz vista por A (m x n, m >= n).
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Visão a ser fatorada; os dados não são alterados.
+ * @throws std::invalid_argument Se A tiver menos linhas que colunas.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+QR<T>::QR(const ConstMatrizView<T> &A)
+{
+    fatorar(A);
+}
+
+/*!
+ * @brief Fatora A com os fatores e o espaço de trabalho tirados de uma arena.
+ *
+ * O objeto não pode ser usado depois que a arena for zerada.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Visão a ser fatorada; os dados não são alterados.
+ * @param area Arena de onde vem a memória.
+ * @throws std::invalid_argument Se A tiver menos linhas que colunas.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+QR<T>::QR(const ConstMatrizView<T> &A, Arena &area)
+    : qr_(AlocadorArena<T>(area)), tau_(AlocadorArena<T>(area)), t_(AlocadorArena<T>(area)),
+      trabalho_(AlocadorArena<T>(area))
+{
+    fatorar(A);
+}
+
+/*!
+ * @brief Refatora com uma nova matriz, reaproveitando a memória já alocada.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Matriz a ser fatorada.
+ * @throws std::invalid_argument Se A tiver menos linhas que colunas.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void QR<T>::fatorar(const Matriz<T> &A)
+{
+    fatorar(A.visao());
+}
+
+/*!
+ * @brief Fatoração blocada, a partir de uma visão.
+ *
+ * Para cada painel de `bloco_` colunas: calcula os refletores do painel, monta o fator T
+ * da forma compacta e aplica Qᵀ = I - V Tᵀ Vᵀ às colunas à direita com dois GEMMs.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param A Visão a ser fatorada.
+ * @throws std::invalid_argument Se A tiver menos linhas que colunas.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void QR<T>::fatorar(const ConstMatrizView<T> &A)
+{
+    if (A.linhas() < A.colunas())
+        throw std::invalid_argument("A fatoração QR requer ao menos tantas linhas quanto colunas.");
+
+    const size_t m = A.linhas(), n = A.colunas();
+    IFNUM_MEDIR("QR::fatorar");
+    IFNUM_FLOPS(2 * m * n * n - 2 * n * n * n / 3);
+    IFNUM_BYTES(sizeof(T) * m * n);
+    if (qr_.capacity() < m * n && !qr_.get_allocator().arena())
+        IFNUM_ALOCACAO(sizeof(T) * m * n);
+
+    m_ = m;
+    n_ = n;
+    qr_.resize(m * n);
+    tau_.assign(n, T(0));
+    t_.resize(bloco_ * n);
+    trabalho_.resize(std::min(bloco_, n) * (2 * m + n));
+    for (size_t i = 0; i < m; i++)
+        for (size_t j = 0; j < n; j++)
+            qr_[i * n + j] = A.elemento(i, j);
+
+    for (size_t k0 = 0; k0 < n; k0 += bloco_) {
+        const size_t kb = std::min(bloco_, n - k0);
+        fatorar_painel_(k0, kb);
+        formar_t_(k0, kb);
+        if (k0 + kb < n)
+            aplicar_bloco_(k0, kb);
+    }
+}
+
+/*!
+ * @brief Calcula os refletores das colunas [k0, k0 + kb), atualizando só o painel.
+ *
+ * Cada refletor H = I - tau v vᵀ (v(k) = 1) leva a coluna k a (beta, 0, ..., 0), com beta
+ * de sinal oposto ao da diagonal para evitar cancelamento, como o dlarfg do LAPACK.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void QR<T>::fatorar_painel_(size_t k0, size_t kb)
+{
+    const size_t m = m_, n = n_;
+    const size_t k1 = k0 + kb;
+    T *a = qr_.data();
+    T w[bloco_];
+
+    for (size_t k = k0; k < k1; k++) {
+        const T alfa = a[k * n + k];
+        T soma = T(0);
+        for (size_t i = k + 1; i < m; i++)
+            soma += a[i * n + k] * a[i * n + k];
+
+        if (soma == T(0)) {
+            tau_[k] = T(0); // a coluna já está reduzida: H = I
+            continue;
+        }
+
+        const T beta = -std::copysign(std::sqrt(alfa * alfa + soma), alfa);
+        const T tau = (beta - alfa) / beta;
+        const T escala = T(1) / (alfa - beta);
+        for (size_t i = k + 1; i < m; i++)
+            a[i * n + k] *= escala;
+        a[k * n + k] = beta;
+        tau_[k] = tau;
+
+        if (k + 1 >= k1)
+            continue;
+
+        // w = vᵀ A(k:m, k+1:k1), acumulado por linhas; depois A -= tau v wᵀ
+        for (size_t j = k + 1; j < k1; j++)
+            w[j - k0] = a[k * n + j];
+        for (size_t i = k + 1; i < m; i++) {
+            const T vi = a[i * n + k];
+            const T *li = a + i * n;
+            for (size_t j = k + 1; j < k1; j++)
+                w[j - k0] += vi * li[j];
+        }
+        for (size_t j = k + 1; j < k1; j++) {
+            w[j - k0] *= tau;
+            a[k * n + j] -= w[j - k0];
+        }
+        paralelo::para(k + 1, m, k1 - k, [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++) {
+                T *li = a + i * n;
+                const T vi = li[k];
+                for (size_t j = k + 1; j < k1; j++)
+                    li[j] -= vi * w[j - k0];
+            }
+        });
+    }
+}
+
+/*!
+ * @brief Monta o fator T (triangular superior) de H(k0) ... H(k0 + kb - 1) = I - V T Vᵀ.
+ *
+ * Segue o dlarft do LAPACK: T(0:i, i) = -tau_i T(0:i, 0:i) Vᵀ v_i.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void QR<T>::formar_t_(size_t k0, size_t kb)
+{
+    const size_t m = m_, n = n_;
+    const T *a = qr_.data();
+    T *t = t_.data() + k0 * bloco_;
+    T z[bloco_];
+
+    for (size_t i = 0; i < kb; i++) {
+        const size_t ki = k0 + i;
+        const T tau = tau_[ki];
+        for (size_t j = 0; j < kb; j++)
+            t[j * bloco_ + i] = T(0);
+        t[i * bloco_ + i] = tau;
+        if (i == 0 || tau == T(0))
+            continue;
+
+        // z = V(:, 0:i)ᵀ v_i, com v_i(ki) = 1 e nulo acima
+        for (size_t j = 0; j < i; j++)
+            z[j] = a[ki * n + k0 + j];
+        for (size_t r = ki + 1; r < m; r++) {
+            const T vr = a[r * n + ki];
+            const T *lr = a + r * n + k0;
+            for (size_t j = 0; j < i; j++)
+                z[j] += lr[j] * vr;
+        }
+        for (size_t j = 0; j < i; j++) {
+            T soma = T(0);
+            for (size_t l = j; l < i; l++)
+                soma += t[j * bloco_ + l] * z[l];
+            t[j * bloco_ + i] = -tau * soma;
+        }
+    }
+}
+
+/*!
+ * @brief Aplica Qᵀ do painel às colunas à direita: C -= V (Tᵀ (Vᵀ C)).
+ *
+ * V é copiada explicitamente (com a diagonal unitária e zeros acima dela) nas duas
+ * orientações que o GEMM lê por linhas.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void QR<T>::aplicar_bloco_(size_t k0, size_t kb)
+{
+    const size_t m = m_, n = n_;
+    const size_t k1 = k0 + kb;
+    const size_t mk = m - k0, nc = n - k1;
+    T *a = qr_.data();
+    const T *t = t_.data() + k0 * bloco_;
+    T *V = trabalho_.data();  // mk x kb
+    T *Vt = V + mk * kb;      // kb x mk
+    T *W = Vt + kb * mk;      // kb x nc
+
+    paralelo::para(0, mk, kb, [&](size_t inicio, size_t fim) {
+        for (size_t r = inicio; r < fim; r++) {
+            for (size_t p = 0; p < kb; p++) {
+                const T v = r > p ? a[(k0 + r) * n + k0 + p] : (r == p ? T(1) : T(0));
+                V[r * kb + p] = v;
+                Vt[p * mk + r] = v;
+            }
+        }
+    });
+
+    T *C = a + k0 * n + k1;
+    detail::gemm(kb, nc, mk, T(1), Vt, mk, C, n, T(0), W, nc);
+
+    // W = Tᵀ W, de baixo para cima (a linha i só depende das linhas j <= i)
+    for (size_t i = kb; i-- > 0;) {
+        T *wi = W + i * nc;
+        const T tii = t[i * bloco_ + i];
+        for (size_t c = 0; c < nc; c++)
+            wi[c] *= tii;
+        for (size_t j = 0; j < i; j++) {
+            const T tji = t[j * bloco_ + i];
+            const T *wj = W + j * nc;
+            for (size_t c = 0; c < nc; c++)
+                wi[c] += tji * wj[c];
+        }
+    }
+
+    detail::gemm(mk, nc, kb, T(-1), V, kb, W, nc, T(1), C, n);
+}
+
+/*!
+ * @brief Tolerância padrão para o posto: max |R(i, i)| * max(m, n) * épsilon.
+ */
+template <typename T>
+T QR<T>::tolerancia_padrao_() const
+{
+    T maior = T(0);
+    for (size_t i = 0; i < n_; i++)
+        maior = std::max(maior, std::abs(qr_[i * n_ + i]));
+    return maior * static_cast<T>(std::max(m_, n_)) * std::numeric_limits<T>::epsilon();
+}
+
+/*!
+ * @brief Número de linhas m da matriz fatorada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+size_t QR<T>::linhas() const
+{
+    return m_;
+}
+
+/*!
+ * @brief Número de colunas n da matriz fatorada.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+size_t QR<T>::colunas() const
+{
+    return n_;
+}
+
+/*!
+ * @brief Estimativa do posto: quantos |R(i, i)| são maiores que a tolerância.
+ *
+ * Sem pivotamento de colunas, uma coluna dependente das anteriores dá um R(i, i) pequeno,
+ * mas a contagem pode errar em matrizes quase deficientes.
+ *
+ * @param tolerancia Limite absoluto; negativo usa max |R(i, i)| * max(m, n) * épsilon.
+ * @return Posto estimado, entre 0 e n.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+size_t QR<T>::posto(T tolerancia) const
+{
+    if (tolerancia < T(0))
+        tolerancia = tolerancia_padrao_();
+
+    size_t posto = 0;
+    for (size_t i = 0; i < n_; i++)
+        posto += std::abs(qr_[i * n_ + i]) > tolerancia;
+    return posto;
+}
+
+/*!
+ * @brief Indica se o posto estimado (com a tolerância padrão) é n.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+bool QR<T>::posto_completo() const
+{
+    return n_ > 0 && posto() == n_;
+}
+
+/*!
+ * @brief Retorna o Q reduzido (m x n, colunas ortonormais) como uma nova Matriz.
+ *
+ * Aplica os refletores, do último ao primeiro, às colunas de [I; 0]; o refletor k só
+ * altera as colunas k em diante.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> QR<T>::Q() const
+{
+    const size_t m = m_, n = n_;
+    const T *a = qr_.data();
+    Matriz<T> Q(m, n);
+    for (size_t i = 0; i < n; i++)
+        Q.elemento(i, i) = T(1);
+
+    T *q = Q.data();
+    std::vector<T> w(n);
+    for (size_t k = n; k-- > 0;) {
+        const T tau = tau_[k];
+        if (tau == T(0))
+            continue;
+
+        for (size_t j = k; j < n; j++)
+            w[j] = q[k * n + j];
+        for (size_t i = k + 1; i < m; i++) {
+            const T vi = a[i * n + k];
+            for (size_t j = k; j < n; j++)
+                w[j] += vi * q[i * n + j];
+        }
+        for (size_t j = k; j < n; j++) {
+            w[j] *= tau;
+            q[k * n + j] -= w[j];
+        }
+        for (size_t i = k + 1; i < m; i++) {
+            const T vi = a[i * n + k];
+            for (size_t j = k; j < n; j++)
+                q[i * n + j] -= vi * w[j];
+        }
+    }
+    return Q;
+}
+
+/*!
+ * @brief Retorna R (triangular superior, n x n) como uma nova Matriz.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> QR<T>::R() const
+{
+    Matriz<T> R(n_, n_);
+    for (size_t i = 0; i < n_; i++)
+        for (size_t j = i; j < n_; j++)
+            R.elemento(i, j) = qr_[i * n_ + j];
+    return R;
+}
+
+/*!
+ * @brief Estimativa do número de condição κ₁(R).
+ *
+ * Como Q é ortogonal, κ₂(A) = κ₂(R); κ₁(R) fica a um fator de no máximo n dele e é estimado
+ * em O(n²) (ver detail::estimar_norma1_inversa). Para mínimos quadrados, o erro relativo da
+ * solução cresce com κ(A) (e com κ(A)² quando o resíduo é grande).
+ *
+ * @return Estimativa de κ₁(R), ou infinito se o posto for incompleto.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T QR<T>::condicao() const
+{
+    if (!posto_completo())
+        return std::numeric_limits<T>::infinity();
+
+    IFNUM_MEDIR("QR::condicao");
+    const size_t n = n_;
+    const T *a = qr_.data();
+
+    T norma = T(0);
+    for (size_t j = 0; j < n; j++) {
+        T soma = T(0);
+        for (size_t i = 0; i <= j; i++)
+            soma += std::abs(a[i * n + j]);
+        norma = std::max(norma, soma);
+    }
+
+    auto resolver_r = [&](const T *b, T *x) {
+        for (size_t i = n; i-- > 0;) {
+            T soma = b[i];
+            for (size_t k = i + 1; k < n; k++)
+                soma -= a[i * n + k] * x[k];
+            x[i] = soma / a[i * n + i];
+        }
+    };
+    auto resolver_rt = [&](const T *b, T *x) {
+        for (size_t i = 0; i < n; i++) {
+            T soma = b[i];
+            for (size_t k = 0; k < i; k++)
+                soma -= a[k * n + i] * x[k];
+            x[i] = soma / a[i * n + i];
+        }
+    };
+    return norma * detail::estimar_norma1_inversa<T>(n, resolver_r, resolver_rt);
+}
+
+/*!
+ * @brief Substitui B por Qᵀ B (Q completo, m x m), sem formar Q.
+ *
+ * As linhas n a m - 1 do resultado são o resíduo de mínimos quadrados expresso na base de
+ * Q: a norma delas é min ||A x - b||₂.
+ *
+ * @param b Visão m x c, alterada no lugar.
+ * @throws std::invalid_argument Se b não tiver m linhas.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void QR<T>::aplicar_qt(const MatrizView<T> &b) const
+{
+    if (b.linhas() != m_)
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+
+    IFNUM_MEDIR("QR::aplicar_qt");
+    IFNUM_FLOPS(4 * m_ * n_ * b.colunas());
+    const size_t m = m_, n = n_;
+    const size_t c = b.colunas();
+    const T *a = qr_.data();
+    T *y = b.data();
+    const size_t pl = b.passo_linha();
+    std::vector<T> w(c);
+
+    auto refletir = [&](auto pc) {
+        for (size_t k = 0; k < n; k++) {
+            const T tau = tau_[k];
+            if (tau == T(0))
+                continue;
+
+            for (size_t j = 0; j < c; j++)
+                w[j] = y[k * pl + j * pc];
+            for (size_t i = k + 1; i < m; i++) {
+                const T vi = a[i * n + k];
+                const T *yi = y + i * pl;
+                for (size_t j = 0; j < c; j++)
+                    w[j] += vi * yi[j * pc];
+            }
+            for (size_t j = 0; j < c; j++) {
+                w[j] *= tau;
+                y[k * pl + j * pc] -= w[j];
+            }
+            for (size_t i = k + 1; i < m; i++) {
+                const T vi = a[i * n + k];
+                T *yi = y + i * pl;
+                for (size_t j = 0; j < c; j++)
+                    yi[j * pc] -= vi * w[j];
+            }
+        }
+    };
+    if (b.passo_coluna() == 1)
+        refletir(std::integral_constant<size_t, 1>());
+    else
+        refletir(b.passo_coluna());
+}
+
+/*!
+ * @brief Resolve min ||A X - B||₂ para um ou mais lados direitos (sistema, se m = n).
+ *
+ * @tparam T Tipo dos elementos.
+ * @param b Matriz m x c com os lados direitos.
+ * @return Matriz n x c com as soluções.
+ * @throws std::invalid_argument Se b não tiver m linhas.
+ * @throws std::runtime_error Se o posto for incompleto.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> QR<T>::resolver(const Matriz<T> &b) const
+{
+    return resolver(b.visao());
+}
+
+/*!
+ * @brief Resolve min ||A X - B||₂ com os lados direitos dados por uma visão.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param b Visão m x c com os lados direitos.
+ * @return Matriz n x c com as soluções.
+ * @throws std::invalid_argument Se b não tiver m linhas.
+ * @throws std::runtime_error Se o posto for incompleto.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Matriz<T> QR<T>::resolver(const ConstMatrizView<T> &b) const
+{
+    if (b.linhas() != m_)
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+
+    Matriz<T> x(n_, b.colunas());
+    resolver(b, x.visao());
+    return x;
+}
+
+/*!
+ * @brief Resolve min ||A X - B||₂ escrevendo as soluções em uma visão existente.
+ *
+ * Calcula Qᵀ B em um temporário m x c e resolve R X = (Qᵀ B)(0:n, :) por substituição
+ * reversa, linha a linha em todas as colunas.
+ *
+ * @tparam T Tipo dos elementos.
+ * @param b Visão m x c com os lados direitos.
+ * @param x Visão n x c que recebe as soluções.
+ * @throws std::invalid_argument Se b não tiver m linhas, x não tiver n linhas ou as
+ *         colunas diferirem.
+ * @throws std::runtime_error Se o posto for incompleto.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+void QR<T>::resolver(const ConstMatrizView<T> &b, const MatrizView<T> &x) const
+{
+    if (b.linhas() != m_ || x.linhas() != n_ || x.colunas() != b.colunas())
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+
+    if (!posto_completo())
+        throw std::runtime_error("Matriz com posto incompleto");
+
+    IFNUM_MEDIR("QR::resolver");
+    IFNUM_FLOPS(n_ * n_ * b.colunas());
+    const size_t n = n_;
+    const size_t c = b.colunas();
+    Matriz<T> y(m_, c);
+    for (size_t i = 0; i < m_; i++)
+        for (size_t j = 0; j < c; j++)
+            y.elemento(i, j) = b.elemento(i, j);
+    aplicar_qt(y.visao());
+
+    const T *a = qr_.data();
+    T *z = y.data();
+    for (size_t i = n; i-- > 0;) {
+        T *zi = z + i * c;
+        for (size_t k = i + 1; k < n; k++) {
+            const T fator = a[i * n + k];
+            const T *zk = z + k * c;
+            for (size_t j = 0; j < c; j++)
+                zi[j] -= fator * zk[j];
+        }
+        const T pivo = a[i * n + i];
+        for (size_t j = 0; j < c; j++)
+            zi[j] /= pivo;
+    }
+
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < c; j++)
+            x.elemento(i, j) = z[i * c + j];
+}
+
+} // namespace ifnum
@@ -0,0 +1,258 @@
+/*!
+ * @file Servico.hpp
+ * @brief Serviço assíncrono que reúne pedidos pequenos e concorrentes em lotes.
+ *
+ * Em um servidor em que várias threads pedem, ao mesmo tempo, produtos, `resolverLU` ou
+ * senos de poucos ângulos, chamar a biblioteca diretamente executa cada pedido em série, na
+ * thread que o fez. `ServicoCalculo` recebe os pedidos, devolve `std::future`s e os executa
+ * em lotes: pedidos de mesmo formato (mesma operação e mesmas dimensões) que chegam dentro
+ * de `espera_maxima` são reunidos, até `lote_maximo` por lote, e executados juntos por uma
+ * thread despachante, que divide o trabalho entre as threads do pool (Paralelo.hpp):
+ *
+ * - sistemas de ordem até 8 com um lado direito vão juntos para `resolver_lote` (Lote.hpp);
+ * - os ângulos de todos os pedidos de seno (ou cosseno) do lote são concatenados em uma
+ *   única chamada às versões em lote de Cordic.hpp;
+ * - produtos e sistemas maiores são divididos entre as threads, um pedido por índice.
+ *
+ * Em vez do future, cada pedido pode receber uma função de conclusão, chamada pela thread
+ * despachante, e, compilando em C++20, um objeto aguardável por `co_await`.
+ *
+ * @code
+ * ifnum::ServicoCalculo servico({64, std::chrono::microseconds(200)});
+ * std::future<ifnum::Matriz<double>> x = servico.resolverLU(A, b);
+ * ...
+ * ifnum::Matriz<double> solucao = x.get();
+ * @endcode
+ */
+
+#pragma once
+#include "Matriz.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#define IFNUM_CORROTINAS 1
+#include <coroutine>
+#include <mutex>
+#include <optional>
+#else
+#define IFNUM_CORROTINAS 0
+#endif
+
+namespace ifnum
+{
+/*!
+ * @brief Função de conclusão de um pedido.
+ *
+ * Recebe o resultado (que pode ser movido) e um ponteiro de exceção nulo, ou um resultado
+ * nulo e a exceção lançada pelo cálculo.
+ */
+template <typename R>
+using Conclusao = std::function<void(R *resultado, std::exception_ptr erro)>;
+
+/*!
+ * @brief Parâmetros de ServicoCalculo.
+ */
+struct ConfiguracaoServico {
+    size_t lote_maximo = 64; //!< Pedidos executados juntos, no máximo.
+    /*! @brief Tempo máximo que um pedido espera por outros de mesmo formato. */
+    std::chrono::microseconds espera_maxima{200};
+    size_t despachantes = 1; //!< Threads que montam e executam os lotes.
+};
+
+/*!
+ * @brief Contadores de ServicoCalculo desde a criação ou o último zerar_estatisticas().
+ *
+ * A espera vai da chegada do pedido ao início do seu lote; a latência, da chegada à
+ * conclusão.
+ */
+struct EstatisticasServico {
+    uint64_t pedidos = 0;    //!< Pedidos recebidos.
+    uint64_t concluidos = 0; //!< Pedidos concluídos, com resultado ou com exceção.
+    uint64_t lotes = 0;      //!< Lotes executados.
+    size_t fila = 0;         //!< Pedidos aguardando agora.
+    size_t fila_maxima = 0;  //!< Maior número de pedidos aguardando ao mesmo tempo.
+    uint64_t espera_ns_total = 0;
+    uint64_t espera_ns_max = 0;
+    uint64_t latencia_ns_total = 0;
+    uint64_t latencia_ns_max = 0;
+
+    double lote_medio() const;
+    double espera_media_ns() const;
+    double latencia_media_ns() const;
+};
+
+#if IFNUM_CORROTINAS
+/*! @brief Marca das versões de ServicoCalculo que retornam Aguardavel. */
+struct ComoAguardavel {
+};
+inline constexpr ComoAguardavel aguardavel{};
+
+/*!
+ * @brief Resultado de um pedido que pode ser aguardado com `co_await` (C++20).
+ *
+ * O pedido é enviado na criação, como com os futures. Se ele ainda não terminou, a
+ * corrotina é suspensa e retomada pela thread despachante ao fim do lote; trabalho longo
+ * depois do `co_await` atrasa os lotes seguintes e deve ser passado a outra thread.
+ *
+ * @tparam R Tipo do resultado.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename R>
+class Aguardavel
+{
+  private:
+    struct Estado {
+        std::mutex mutex;
+        std::optional<R> resultado;
+        std::exception_ptr erro;
+        std::coroutine_handle<> continuacao;
+        bool pronto = false;
+    };
+    std::shared_ptr<Estado> estado_ = std::make_shared<Estado>();
+
+  public:
+    /*! @brief Função de conclusão que guarda o resultado e retoma a corrotina suspensa. */
+    Conclusao<R> conclusao() const
+    {
+        return [estado = estado_](R *resultado, std::exception_ptr erro) {
+            std::coroutine_handle<> continuacao;
+            {
+                std::lock_guard<std::mutex> lock(estado->mutex);
+                if (resultado)
+                    estado->resultado.emplace(std::move(*resultado));
+                else
+                    estado->erro = erro;
+                estado->pronto = true;
+                continuacao = estado->continuacao;
+            }
+            if (continuacao)
+                continuacao.resume();
+        };
+    }
+
+    bool await_ready() const
+    {
+        std::lock_guard<std::mutex> lock(estado_->mutex);
+        return estado_->pronto;
+    }
+
+    bool await_suspend(std::coroutine_handle<> continuacao)
+    {
+        std::lock_guard<std::mutex> lock(estado_->mutex);
+        if (estado_->pronto)
+            return false;
+        estado_->continuacao = continuacao;
+        return true;
+    }
+
+    R await_resume()
+    {
+        if (estado_->erro)
+            std::rethrow_exception(estado_->erro);
+        return std::move(*estado_->resultado);
+    }
+};
+#endif
+
+/*!
+ * @brief Fila assíncrona de cálculos, executados em lotes de pedidos de mesmo formato.
+ *
+ * Pode ser usada por várias threads ao mesmo tempo. Um despachante pega o pedido mais
+ * antigo da fila e espera até que haja `lote_maximo` pedidos do mesmo formato ou até que o
+ * mais antigo complete `espera_maxima` na fila; então executa juntos os pedidos desse formato
+ * (até `lote_maximo`, na ordem de chegada). Com espera_maxima = 0, cada pedido é executado
+ * assim que um despachante fica livre, junto com os de mesmo formato que já estiverem na fila.
+ *
+ * Erros de dimensão são lançados na chamada; erros do cálculo (matriz singular) chegam pelo
+ * future. O destrutor executa os pedidos pendentes antes de retornar.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+class ServicoCalculo
+{
+  private:
+    struct Implementacao;
+    std::unique_ptr<Implementacao> impl_;
+
+  public:
+    explicit ServicoCalculo(const ConfiguracaoServico &configuracao = {});
+    ~ServicoCalculo();
+    ServicoCalculo(const ServicoCalculo &) = delete;
+    ServicoCalculo &operator=(const ServicoCalculo &) = delete;
+
+    const ConfiguracaoServico &configuracao() const;
+
+    std::future<Matriz<double>> multiplicar(Matriz<double> A, Matriz<double> B);
+    std::future<Matriz<double>> resolverLU(Matriz<double> A, Matriz<double> b);
+    std::future<std::vector<double>> seno(std::vector<double> angulos);
+    std::future<std::vector<double>> cosseno(std::vector<double> angulos);
+
+    void multiplicar(Matriz<double> A, Matriz<double> B, Conclusao<Matriz<double>> concluir);
+    void resolverLU(Matriz<double> A, Matriz<double> b, Conclusao<Matriz<double>> concluir);
+    void seno(std::vector<double> angulos, Conclusao<std::vector<double>> concluir);
+    void cosseno(std::vector<double> angulos, Conclusao<std::vector<double>> concluir);
+
+#if IFNUM_CORROTINAS
+    Aguardavel<Matriz<double>> multiplicar(Matriz<double> A, Matriz<double> B, ComoAguardavel);
+    Aguardavel<Matriz<double>> resolverLU(Matriz<double> A, Matriz<double> b, ComoAguardavel);
+    Aguardavel<std::vector<double>> seno(std::vector<double> angulos, ComoAguardavel);
+    Aguardavel<std::vector<double>> cosseno(std::vector<double> angulos, ComoAguardavel);
+#endif
+
+    EstatisticasServico estatisticas() const;
+    void zerar_estatisticas();
+    void encerrar();
+};
+
+#if IFNUM_CORROTINAS
+/*!
+ * @brief Versões aguardáveis dos pedidos (C++20): `co_await servico.multiplicar(A, B,
+ *        ifnum::aguardavel)`.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+inline Aguardavel<Matriz<double>> ServicoCalculo::multiplicar(Matriz<double> A, Matriz<double> B,
+                                                              ComoAguardavel)
+{
+    Aguardavel<Matriz<double>> resultado;
+    multiplicar(std::move(A), std::move(B), resultado.conclusao());
+    return resultado;
+}
+
+inline Aguardavel<Matriz<double>> ServicoCalculo::resolverLU(Matriz<double> A, Matriz<double> b,
+                                                             ComoAguardavel)
+{
+    Aguardavel<Matriz<double>> resultado;
+    resolverLU(std::move(A), std::move(b), resultado.conclusao());
+    return resultado;
+}
+
+inline Aguardavel<std::vector<double>> ServicoCalculo::seno(std::vector<double> angulos,
+                                                            ComoAguardavel)
+{
+    Aguardavel<std::vector<double>> resultado;
+    seno(std::move(angulos), resultado.conclusao());
+    return resultado;
+}
+
+inline Aguardavel<std::vector<double>> ServicoCalculo::cosseno(std::vector<double> angulos,
+                                                               ComoAguardavel)
+{
+    Aguardavel<std::vector<double>> resultado;
+    cosseno(std::move(angulos), resultado.conclusao());
+    return resultado;
+}
+#endif
+
+} // namespace ifnum
@@ -1,4 +1,6 @@
 #pragma once
+#include "Blas1.hpp"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <stdexcept>
@@ -36,11 +38,18 @@ class Vetor
     Vetor<T> operator-(const Vetor &outro) const;
     T operator*(const Vetor &outro) const;
 
+    Vetor<T> &operator+=(const Vetor &outro);
+    Vetor<T> &operator-=(const Vetor &outro);
+    Vetor<T> &operator*=(T alfa);
+    Vetor<T> &axpy(T alfa, const Vetor &x);
+
     bool operator==(const Vetor &outro) const;
     bool operator!=(const Vetor &outro) const;
 
     size_t tamanho() const;
     std::vector<T> vector() const;
+    T *data();
+    const T *data() const;
 
     template <typename U>
     friend std::ostream &operator<<(std::ostream &os, const Vetor<U> &v);
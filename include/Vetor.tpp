@@ -74,6 +74,27 @@ std::vector<T> Vetor<T>::vector() const
     return elementos_;
 }
 
+/*!
+ * @brief Acesso direto aos elementos contíguos do vetor (ex.: para as funções de Blas1.hpp).
+ *
+ * @tparam T Tipo dos elementos do vetor.
+ * @return Ponteiro para o primeiro elemento.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+T *Vetor<T>::data()
+{
+    return elementos_.data();
+}
+
+template <typename T>
+const T *Vetor<T>::data() const
+{
+    return elementos_.data();
+}
+
 /*!
  * @brief Imprime o vetor no formato (x, y, z, ...).
  *
@@ -98,7 +119,8 @@ void Vetor<T>::imprimir() const
 /*!
  * @brief Calcula a norma (magnitude) do vetor.
  *
- * Usa a raiz quadrada da soma dos quadrados dos elementos.
+ * Usa a raiz quadrada da soma dos quadrados dos elementos. Para ponto flutuante, a soma é
+ * feita no próprio tipo T por blas::nrm2, sem overflow nem underflow intermediários.
  * @tparam T Tipo dos elementos do vetor.
  * @return Norma do vetor (double).
  *
@@ -108,10 +130,14 @@ void Vetor<T>::imprimir() const
 template <typename T>
 double Vetor<T>::norma() const
 {
-    double soma = 0;
-    for (T val : elementos_)
-        soma += val * val;
-    return std::sqrt(soma);
+    if constexpr (std::is_floating_point_v<T>) {
+        return blas::nrm2(tamanho_, elementos_.data());
+    } else {
+        double soma = 0;
+        for (T val : elementos_)
+            soma += val * val;
+        return std::sqrt(soma);
+    }
 }
 
 /*!
@@ -134,8 +160,12 @@ Vetor<T> Vetor<T>::normalizar() const
     if (n == 0)
         throw std::runtime_error("Não é possível normalizar um vetor nulo");
     Vetor resultado(*this);
-    for (T &val : resultado.elementos_)
-        val /= n;
+    if constexpr (std::is_floating_point_v<T>) {
+        resultado *= T(1) / T(n);
+    } else {
+        for (T &val : resultado.elementos_)
+            val /= n;
+    }
     return resultado;
 }
 
@@ -159,8 +189,7 @@ Vetor<T> Vetor<T>::operator+(const Vetor &outro) const
     if (tamanho_ != outro.tamanho_)
         throw std::invalid_argument("Os vetores devem ter o mesmo tamanho");
     Vetor resultado(*this);
-    for (size_t i = 0; i < tamanho_; i++)
-        resultado.elementos_[i] += outro.elementos_[i];
+    resultado += outro;
     return resultado;
 }
 
@@ -184,8 +213,7 @@ Vetor<T> Vetor<T>::operator-(const Vetor &outro) const
     if (tamanho_ != outro.tamanho_)
         throw std::invalid_argument("Os vetores devem ter o mesmo tamanho");
     Vetor resultado(*this);
-    for (size_t i = 0; i < tamanho_; i++)
-        resultado.elementos_[i] -= outro.elementos_[i];
+    resultado -= outro;
     return resultado;
 }
 
@@ -208,10 +236,93 @@ T Vetor<T>::operator*(const Vetor &outro) const
 {
     if (tamanho_ != outro.tamanho_)
         throw std::invalid_argument("Os vetores devem ter o mesmo tamanho");
-    T produto = 0;
-    for (size_t i = 0; i < tamanho_; i++)
-        produto += elementos_[i] * outro.elementos_[i];
-    return produto;
+    return blas::dot(tamanho_, elementos_.data(), outro.elementos_.data());
+}
+
+/*!
+ * @brief Soma vetorial no lugar, sem a cópia feita por operator+.
+ *
+ * @tparam T Tipo dos elementos do vetor.
+ * @param outro Vetor a ser somado.
+ * @return Referência para este vetor.
+ *
+ * @throws std::invalid_argument Se os vetores tiverem tamanhos diferentes.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Vetor<T> &Vetor<T>::operator+=(const Vetor &outro)
+{
+    return axpy(T(1), outro);
+}
+
+/*!
+ * @brief Subtração vetorial no lugar, sem a cópia feita por operator-.
+ *
+ * @tparam T Tipo dos elementos do vetor.
+ * @param outro Vetor a ser subtraído.
+ * @return Referência para este vetor.
+ *
+ * @throws std::invalid_argument Se os vetores tiverem tamanhos diferentes.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Vetor<T> &Vetor<T>::operator-=(const Vetor &outro)
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        return axpy(T(-1), outro);
+    } else {
+        // -1 * x pode transbordar em inteiros com sinal (ex.: INT_MIN); subtrai direto.
+        if (tamanho_ != outro.tamanho_)
+            throw std::invalid_argument("Os vetores devem ter o mesmo tamanho");
+        for (size_t i = 0; i < tamanho_; i++)
+            elementos_[i] -= outro.elementos_[i];
+        return *this;
+    }
+}
+
+/*!
+ * @brief Multiplica o vetor por um escalar, no lugar.
+ *
+ * @tparam T Tipo dos elementos do vetor.
+ * @param alfa Escalar.
+ * @return Referência para este vetor.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Vetor<T> &Vetor<T>::operator*=(T alfa)
+{
+    blas::scal(tamanho_, alfa, elementos_.data());
+    return *this;
+}
+
+/*!
+ * @brief Soma fundida no lugar: este vetor recebe this + alfa * x.
+ *
+ * Evita o vetor temporário de `v = v + x * alfa` e percorre a memória uma única vez.
+ *
+ * @tparam T Tipo dos elementos do vetor.
+ * @param alfa Escalar que multiplica x.
+ * @param x Vetor somado (pode ser o próprio vetor).
+ * @return Referência para este vetor.
+ *
+ * @throws std::invalid_argument Se os vetores tiverem tamanhos diferentes.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+template <typename T>
+Vetor<T> &Vetor<T>::axpy(T alfa, const Vetor &x)
+{
+    if (tamanho_ != x.tamanho_)
+        throw std::invalid_argument("Os vetores devem ter o mesmo tamanho");
+    blas::axpy(tamanho_, alfa, x.elementos_.data(), elementos_.data());
+    return *this;
 }
 /*!
  * @brief Verifica se dois vetores são iguais.
@@ -7,9 +7,28 @@
  */
 
 #include "AlgebraLinear.hpp"
+#include "Aleatorio.hpp"
+#include "Alocador.hpp"
+#include "Arquivo.hpp"
+#include "Autovalores.hpp"
 #include "Auxiliar.hpp"
+#include "Blas1.hpp"
+#include "Cholesky.hpp"
+#include "Configuracao.hpp"
 #include "Cordic.hpp"
+#include "CordicFixo.hpp"
+#include "Instrumentacao.hpp"
+#include "Iterativos.hpp"
+#include "Lote.hpp"
+#include "LU.hpp"
 #include "Matriz.hpp"
+#include "MatrizBanda.hpp"
+#include "MatrizEsparsa.hpp"
+#include "MatrizFixa.hpp"
+#include "MatrizView.hpp"
+#include "Paralelo.hpp"
+#include "QR.hpp"
+#include "Servico.hpp"
 #include "Vetor.hpp"
 
 /*!
@@ -30,4 +49,13 @@
 /*!
  * @namespace ifnum::debug
  * @brief Utilitários para depuração e exibição de dados.
- */
\ No newline at end of file
+ */
+/*!
+ * @namespace ifnum::detail
+ * @brief Kernels internos (GEMM, detecção de CPU) usados pelas estruturas públicas.
+ */
+
+/*!
+ * @namespace ifnum::paralelo
+ * @brief Backend de execução paralela (pool de threads com roubo de tarefas).
+ */
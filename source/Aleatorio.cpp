@@ -0,0 +1,274 @@
+/*!
+ * @file Aleatorio.cpp
+ * @brief Núcleo do Philox4x32-10 (com variante AVX2) e estado global das sementes.
+ *
+ * Como em Gemm.cpp, a variante AVX2 é compilada com atributo de alvo e escolhida em tempo de
+ * execução; a variante portável calcula um bloco por vez.
+ */
+
+#include "Aleatorio.hpp"
+#include "Cpu.hpp"
+#include <atomic>
+#include <random>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define IFNUM_PHILOX_X86 1
+#endif
+
+namespace ifnum::detail
+{
+namespace
+{
+constexpr uint32_t PHILOX_M0 = 0xD2511F53;
+constexpr uint32_t PHILOX_M1 = 0xCD9E8D57;
+constexpr uint32_t PHILOX_W0 = 0x9E3779B9; // parte fracionária da razão áurea
+constexpr uint32_t PHILOX_W1 = 0xBB67AE85; // parte fracionária de sqrt(3) - 1
+
+/*! @brief Um bloco do Philox4x32-10 (contador de 128 bits = (contador, fluxo), chave = semente). */
+void philox_escalar(uint64_t semente, uint64_t fluxo, uint64_t contador, uint32_t *saida)
+{
+    uint32_t c0 = static_cast<uint32_t>(contador), c1 = static_cast<uint32_t>(contador >> 32);
+    uint32_t c2 = static_cast<uint32_t>(fluxo), c3 = static_cast<uint32_t>(fluxo >> 32);
+    uint32_t k0 = static_cast<uint32_t>(semente), k1 = static_cast<uint32_t>(semente >> 32);
+    for (int rodada = 0; rodada < 10; rodada++) {
+        const uint64_t p0 = uint64_t(PHILOX_M0) * c0;
+        const uint64_t p1 = uint64_t(PHILOX_M1) * c2;
+        c0 = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+        c2 = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+        c1 = static_cast<uint32_t>(p1);
+        c3 = static_cast<uint32_t>(p0);
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+    saida[0] = c0;
+    saida[1] = c1;
+    saida[2] = c2;
+    saida[3] = c3;
+}
+
+void philox_padrao(uint64_t semente, uint64_t fluxo, uint64_t contador, size_t n,
+                   uint32_t *saida)
+{
+    for (size_t b = 0; b < n; b++)
+        philox_escalar(semente, fluxo, contador + b, saida + 4 * b);
+}
+
+#ifdef IFNUM_PHILOX_X86
+/*!
+ * @brief Philox4x32-10 com AVX2: 8 blocos por vez, em dois grupos de 4.
+ *
+ * Cada palavra de 32 bits do bloco ocupa uma faixa de 64 bits, para que vpmuludq dê o
+ * produto 32x32->64 inteiro; os dois grupos independentes escondem a latência dele.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+__attribute__((target("avx2"))) void philox_avx2(uint64_t semente, uint64_t fluxo,
+                                                 uint64_t contador, size_t n, uint32_t *saida)
+{
+    const __m256i mascara = _mm256_set1_epi64x(0xffffffff);
+    const __m256i m0 = _mm256_set1_epi64x(PHILOX_M0);
+    const __m256i m1 = _mm256_set1_epi64x(PHILOX_M1);
+    const __m256i f0 = _mm256_set1_epi64x(fluxo & 0xffffffff);
+    const __m256i f1 = _mm256_set1_epi64x(fluxo >> 32);
+
+    size_t b = 0;
+    for (; b + 8 <= n; b += 8) {
+        __m256i c0[2], c1[2], c2[2], c3[2];
+        for (int h = 0; h < 2; h++) {
+            const uint64_t c = contador + b + 4 * h;
+            const __m256i v = _mm256_setr_epi64x(c, c + 1, c + 2, c + 3);
+            c0[h] = _mm256_and_si256(v, mascara);
+            c1[h] = _mm256_srli_epi64(v, 32);
+            c2[h] = f0;
+            c3[h] = f1;
+        }
+
+        uint32_t k0 = static_cast<uint32_t>(semente), k1 = static_cast<uint32_t>(semente >> 32);
+        for (int rodada = 0; rodada < 10; rodada++) {
+            const __m256i vk0 = _mm256_set1_epi64x(k0);
+            const __m256i vk1 = _mm256_set1_epi64x(k1);
+            for (int h = 0; h < 2; h++) {
+                const __m256i p0 = _mm256_mul_epu32(c0[h], m0);
+                const __m256i p1 = _mm256_mul_epu32(c2[h], m1);
+                c0[h] = _mm256_xor_si256(_mm256_xor_si256(_mm256_srli_epi64(p1, 32), c1[h]), vk0);
+                c2[h] = _mm256_xor_si256(_mm256_xor_si256(_mm256_srli_epi64(p0, 32), c3[h]), vk1);
+                c1[h] = _mm256_and_si256(p1, mascara);
+                c3[h] = _mm256_and_si256(p0, mascara);
+            }
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+
+        // Junta as palavras: (c0, c1) e (c2, c3) de cada bloco viram um inteiro de 64 bits
+        for (int h = 0; h < 2; h++) {
+            const __m256i baixo = _mm256_or_si256(c0[h], _mm256_slli_epi64(c1[h], 32));
+            const __m256i alto = _mm256_or_si256(c2[h], _mm256_slli_epi64(c3[h], 32));
+            const __m256i lo = _mm256_unpacklo_epi64(baixo, alto); // blocos 0 e 2
+            const __m256i hi = _mm256_unpackhi_epi64(baixo, alto); // blocos 1 e 3
+            uint32_t *s = saida + 4 * (b + 4 * h);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(s),
+                                _mm256_permute2x128_si256(lo, hi, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(s + 8),
+                                _mm256_permute2x128_si256(lo, hi, 0x31));
+        }
+    }
+    philox_padrao(semente, fluxo, contador + b, n - b, saida + 4 * b);
+}
+#endif
+
+uint64_t semente_inicial()
+{
+    std::random_device rd;
+    return uint64_t(rd()) << 32 | rd();
+}
+
+std::atomic<uint64_t> semente_global{semente_inicial()};
+std::atomic<uint64_t> fluxos{0};
+std::atomic<uint64_t> geracao{0}; // incrementada a cada semear()
+} // namespace
+
+/*!
+ * @brief Escreve em `saida` (4 * n palavras) os blocos `contador`, ..., `contador + n - 1`
+ *        do fluxo, na melhor variante disponível.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void philox_blocos(uint64_t semente, uint64_t fluxo, uint64_t contador, size_t n,
+                   uint32_t *saida)
+{
+#ifdef IFNUM_PHILOX_X86
+    if (recursos_cpu().avx2) {
+        philox_avx2(semente, fluxo, contador, n, saida);
+        return;
+    }
+#endif
+    philox_padrao(semente, fluxo, contador, n, saida);
+}
+
+/*! @brief Reserva um fluxo ainda não usado desde o último rng::semear(). */
+uint64_t proximo_fluxo()
+{
+    return fluxos.fetch_add(1, std::memory_order_relaxed);
+}
+} // namespace ifnum::detail
+
+namespace ifnum::rng
+{
+/*!
+ * @brief Cria o gerador na posição 0 do fluxo `fluxo`.
+ *
+ * @param semente Chave de 64 bits.
+ * @param fluxo Índice do fluxo; fluxos diferentes são independentes.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+Philox::Philox(uint64_t semente, uint64_t fluxo) : semente_(semente), fluxo_(fluxo)
+{
+}
+
+/*! @brief Próxima palavra de 32 bits do fluxo. */
+Philox::result_type Philox::operator()()
+{
+    if (usados_ == 4) {
+        bloco_ = bloco(semente_, fluxo_, contador_++);
+        usados_ = 0;
+    }
+    return bloco_[usados_++];
+}
+
+/*! @brief Pula `blocos` blocos (4 palavras cada), descartando o resto do bloco atual. */
+void Philox::avancar(uint64_t blocos)
+{
+    contador_ += blocos;
+    usados_ = 4;
+}
+
+/*!
+ * @brief Reserva os próximos `blocos` blocos para quem vai calculá-los diretamente.
+ *
+ * @return Contador do primeiro bloco reservado.
+ */
+uint64_t Philox::reservar(uint64_t blocos)
+{
+    const uint64_t inicio = contador_;
+    avancar(blocos);
+    return inicio;
+}
+
+uint64_t Philox::semente() const
+{
+    return semente_;
+}
+
+uint64_t Philox::fluxo() const
+{
+    return fluxo_;
+}
+
+/*! @brief Próximo bloco a ser gerado. */
+uint64_t Philox::contador() const
+{
+    return contador_;
+}
+
+/*!
+ * @brief Bloco `contador` do fluxo `fluxo`: uma função pura dos três argumentos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+Philox::Bloco Philox::bloco(uint64_t semente, uint64_t fluxo, uint64_t contador)
+{
+    Bloco b;
+    detail::philox_escalar(semente, fluxo, contador, b.data());
+    return b;
+}
+
+/*!
+ * @brief Define a semente global e recomeça a numeração dos fluxos.
+ *
+ * Depois de `semear(s)`, a sequência de chamadas a `matriz_aleatoria` e `matriz_normal` sem
+ * gerador explícito (feitas na mesma ordem) produz sempre as mesmas matrizes. Os geradores
+ * de `local()` também são recriados. Não deve ser chamada enquanto outras threads sorteiam.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void semear(uint64_t semente)
+{
+    detail::semente_global.store(semente, std::memory_order_relaxed);
+    detail::fluxos.store(0, std::memory_order_relaxed);
+    detail::geracao.fetch_add(1, std::memory_order_release);
+}
+
+/*! @brief Semente global atual (aleatória, via std::random_device, até o primeiro semear()). */
+uint64_t semente()
+{
+    return detail::semente_global.load(std::memory_order_relaxed);
+}
+
+/*!
+ * @brief Gerador da thread atual, com a semente global e um fluxo só dela.
+ *
+ * Substitui o antigo `rng::mt` compartilhado para sorteios avulsos:
+ * `std::normal_distribution<double>{}(rng::local())` é seguro em qualquer thread.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+Philox &local()
+{
+    thread_local uint64_t geracao = UINT64_MAX;
+    thread_local Philox gerador(0);
+    const uint64_t atual = detail::geracao.load(std::memory_order_acquire);
+    if (geracao != atual) {
+        gerador = Philox(semente(), detail::proximo_fluxo());
+        geracao = atual;
+    }
+    return gerador;
+}
+} // namespace ifnum::rng
@@ -9,35 +9,23 @@
 
 namespace ifnum
 {
+namespace
+{
 // Ler um pouco de pivotamento em http://e-maxx.ru/bookz/files/numerical_recipes.pdf
 /*!
- * @brief Decompõe uma matriz quadrada em L, U e P com pivotamento completo.
- *
- * A função realiza a decomposição LU com pivotamento completo, retornando:
- * - L: matriz triangular inferior,
- * - U: matriz triangular superior,
- * - P: matriz de permutação.
- *
- * @param A Matriz quadrada a ser decomposta.
- * @return Tupla contendo as matrizes L, U e P, respectivamente.
+ * @brief Núcleo de decomposicaoLU: recebe L e P zeradas e U com uma cópia de A.
  *
+ * @tparam M Tipo das matrizes (Matriz com qualquer alocador).
  * @throws std::runtime_error Se a matriz for singular.
- *
- * @author Lucas Andrei
- * @author Giovani Zanella
- * @date 03/04/2025
  */
-std::tuple<Matriz<double>, Matriz<double>, Matriz<double>> decomposicaoLU(const Matriz<double> &A)
+template <typename M>
+void decompor_lu(M &L, M &U, M &P)
 {
-
-    size_t n = A.linhas();
-    Matriz<double> L(n, n);
-    Matriz<double> U = A;
-    Matriz<double> P(n, n);
+    const size_t n = U.linhas();
 
     // Inicializar P como identidade
     for (size_t i = 0; i < n; i++) {
-        P(i, i) = 1;
+        P.elemento(i, i) = 1;
     }
 
     for (size_t k = 0; k < n; k++) {
@@ -48,8 +36,8 @@ std::tuple<Matriz<double>, Matriz<double>, Matriz<double>> decomposicaoLU(const
         // Loop para encontrar os indicies do número absoluto mais alto.
         for (size_t i = k; i < n; i++) {
             for (size_t j = k; j < n; j++) {
-                if (std::abs(U(i, j)) > maxValor) {
-                    maxValor = std::abs(U(i, j));
+                if (std::abs(U.elemento(i, j)) > maxValor) {
+                    maxValor = std::abs(U.elemento(i, j));
                     maxLinha = i;
                     maxColuna = j;
                 }
@@ -69,30 +57,97 @@ std::tuple<Matriz<double>, Matriz<double>, Matriz<double>> decomposicaoLU(const
         U.trocar_colunas(k, maxColuna);
         P.trocar_colunas(k, maxColuna);
 
-        // Atualizar L e U
-        for (size_t i = k + 1; i < n; i++) {
-            L(i, k) = U(i, k) / U(k, k);
-            for (size_t j = k; j < n; j++) {
-                U(i, j) -= L(i, k) * U(k, j);
+        // Atualizar L e U (linhas abaixo do pivô são independentes)
+        paralelo::para(k + 1, n, n - k, [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++) {
+                L.elemento(i, k) = U.elemento(i, k) / U.elemento(k, k);
+                for (size_t j = k; j < n; j++) {
+                    U.elemento(i, j) -= L.elemento(i, k) * U.elemento(k, j);
+                }
             }
-        }
+        });
     }
 
     // Completar a diagonal de L com 1s
     for (size_t i = 0; i < n; i++) {
-        L(i, i) = 1.0;
+        L.elemento(i, i) = 1.0;
     }
+}
+} // namespace
 
-    return std::make_tuple(L, U, P);
+/*!
+ * @brief Decompõe uma matriz quadrada em L, U e P com pivotamento completo.
+ *
+ * A função realiza a decomposição LU com pivotamento completo, retornando:
+ * - L: matriz triangular inferior,
+ * - U: matriz triangular superior,
+ * - P: matriz de permutação.
+ *
+ * @param A Matriz quadrada a ser decomposta.
+ * @return Tupla contendo as matrizes L, U e P, respectivamente.
+ *
+ * @throws std::runtime_error Se a matriz for singular.
+ *
+ * @author Lucas Andrei
+ * @author Giovani Zanella
+ * @date 03/04/2025
+ */
+std::tuple<Matriz<double>, Matriz<double>, Matriz<double>> decomposicaoLU(const Matriz<double> &A)
+{
+    IFNUM_MEDIR("decomposicaoLU");
+    IFNUM_FLOPS(2 * A.linhas() * A.linhas() * A.linhas() / 3);
+    IFNUM_BYTES(4 * sizeof(double) * A.linhas() * A.linhas());
+
+    size_t n = A.linhas();
+    Matriz<double> L(n, n);
+    Matriz<double> U = A;
+    Matriz<double> P(n, n);
+    decompor_lu(L, U, P);
+
+    return std::make_tuple(std::move(L), std::move(U), std::move(P));
 }
 
 /*!
- * @brief Resolve um sistema linear utilizando a decomposição LU com pivotamento completo.
+ * @brief Versão de decomposicaoLU com L, U e P alocadas em uma arena.
+ *
+ * Em um laço que zera a arena a cada iteração, a decomposição não chama o malloc depois da
+ * primeira iteração.
+ *
+ * @param A Visão quadrada a ser decomposta.
+ * @param area Arena de onde vem a memória das três matrizes.
+ * @return Tupla contendo as matrizes L, U e P, respectivamente.
+ *
+ * @throws std::runtime_error Se a matriz for singular.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+std::tuple<MatrizArena<double>, MatrizArena<double>, MatrizArena<double>>
+decomposicaoLU(const ConstMatrizView<double> &A, Arena &area)
+{
+    IFNUM_MEDIR("decomposicaoLU");
+    IFNUM_FLOPS(2 * A.linhas() * A.linhas() * A.linhas() / 3);
+    IFNUM_BYTES(4 * sizeof(double) * A.linhas() * A.linhas());
+
+    size_t n = A.linhas();
+    MatrizArena<double> L(n, n, area);
+    MatrizArena<double> U(A, area);
+    MatrizArena<double> P(n, n, area);
+    decompor_lu(L, U, P);
+
+    return std::make_tuple(std::move(L), std::move(U), std::move(P));
+}
+
+/*!
+ * @brief Resolve um sistema linear utilizando a decomposição LU com pivotamento parcial.
  *
  * Resolve o sistema \( Ax = b \) através de:
- * 1. Decomposição LU com pivotamento completo.
+ * 1. Decomposição LU blocada com pivotamento parcial (classe LU).
  * 2. Substituição direta e reversa para encontrar o vetor solução.
  *
+ * Para resolver vários sistemas com a mesma matriz, prefira criar um objeto LU uma vez
+ * e chamar `LU::resolver` para cada lado direito.
+ *
  * @param A Matriz dos coeficientes (matriz quadrada).
  * @param b Vetor coluna com os termos independentes.
  * @return Vetor solução do sistema.
@@ -106,16 +161,79 @@ std::tuple<Matriz<double>, Matriz<double>, Matriz<double>> decomposicaoLU(const
 
 Matriz<double> resolverLU(const Matriz<double> &A, const Matriz<double> &b)
 {
-    auto [L, U, P] = decomposicaoLU(A);
-
-    // Resolver Pb = Ly
-    Matriz<double> Pb = P * b;
-    Matriz<double> y = reversub(L, Pb);
+    IFNUM_MEDIR("resolverLU");
+    return LU<double>(A).resolver(b);
+}
 
-    // Resolver Ux = y
-    Matriz<double> x = sub(U, y);
+/*!
+ * @brief Versão de resolverLU que tira da arena a fatoração e o resultado.
+ *
+ * Em um laço que zera a arena a cada iteração, a resolução não chama o malloc depois da
+ * primeira iteração.
+ *
+ * @param A Matriz dos coeficientes (quadrada).
+ * @param b Lados direitos (uma coluna por sistema).
+ * @param area Arena de onde vem a memória.
+ * @return Soluções, na arena.
+ *
+ * @throws std::invalid_argument Se A não for quadrada ou b não tiver n linhas.
+ * @throws std::runtime_error Se a matriz for singular.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+MatrizArena<double> resolverLU(const ConstMatrizView<double> &A, const ConstMatrizView<double> &b,
+                               Arena &area)
+{
+    IFNUM_MEDIR("resolverLU");
+    const LU<double> lu(A, area);
+    if (b.linhas() != A.linhas())
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
 
+    MatrizArena<double> x(b.linhas(), b.colunas(), area);
+    lu.resolver(b, x.visao());
     return x;
 }
 
+/*!
+ * @brief Resolve A x = b para A simétrica definida positiva, pela fatoração de Cholesky.
+ *
+ * Faz metade das operações de resolverLU e só lê o triângulo inferior de A. Para vários
+ * sistemas com a mesma matriz, prefira criar um objeto Cholesky uma vez.
+ *
+ * @param A Matriz dos coeficientes (simétrica definida positiva).
+ * @param b Lados direitos (uma coluna por sistema).
+ * @return Soluções.
+ *
+ * @throws std::invalid_argument Se A não for quadrada ou b não tiver n linhas.
+ * @throws std::runtime_error Se A não for definida positiva.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+Matriz<double> resolverCholesky(const Matriz<double> &A, const Matriz<double> &b)
+{
+    IFNUM_MEDIR("resolverCholesky");
+    return Cholesky<double>(A).resolver(b);
+}
+
+/*!
+ * @brief Solução de mínimos quadrados de A x ≈ b (min ||A x - b||₂), pela fatoração QR.
+ *
+ * @param A Matriz m x n com m >= n e posto completo.
+ * @param b Lados direitos, m x c.
+ * @return Soluções, n x c.
+ *
+ * @throws std::invalid_argument Se A tiver menos linhas que colunas ou b não tiver m linhas.
+ * @throws std::runtime_error Se A tiver posto incompleto.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+Matriz<double> minimos_quadrados(const Matriz<double> &A, const Matriz<double> &b)
+{
+    IFNUM_MEDIR("minimos_quadrados");
+    return QR<double>(A).resolver(b);
+}
+
 } // namespace ifnum
\ No newline at end of file
@@ -0,0 +1,153 @@
+/*!
+ * @file Alocador.cpp
+ * @brief Implementação da Arena (ver Alocador.hpp).
+ */
+
+#include "Alocador.hpp"
+#include "Instrumentacao.hpp"
+#include <cstdint>
+#include <stdexcept>
+
+namespace ifnum
+{
+/*!
+ * @brief Cria a arena, opcionalmente já com um bloco de `capacidade` bytes.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+Arena::Arena(size_t capacidade)
+{
+    if (capacidade)
+        novo_bloco_(capacidade);
+}
+
+Arena::~Arena()
+{
+    for (const Bloco &b : blocos_)
+        ::operator delete(b.inicio, std::align_val_t(alinhamento_padrao));
+}
+
+void Arena::novo_bloco_(size_t tamanho)
+{
+    IFNUM_ALOCACAO(tamanho);
+    unsigned char *inicio = static_cast<unsigned char *>(
+        ::operator new(tamanho, std::align_val_t(alinhamento_padrao)));
+    blocos_.push_back({inicio, tamanho});
+}
+
+/*!
+ * @brief Reserva `bytes` bytes alinhados a `alinhamento`.
+ *
+ * Usa o bloco atual; se não couber, passa para o próximo bloco já reservado ou cria um
+ * novo, com pelo menos o dobro do tamanho do último.
+ *
+ * @param bytes Tamanho do pedaço.
+ * @param alinhamento Alinhamento em bytes (potência de 2, no máximo 4096).
+ * @return Ponteiro para o início do pedaço.
+ * @throws std::invalid_argument Se o alinhamento não for uma potência de 2 até 4096.
+ * @throws std::bad_alloc Se não houver memória.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void *Arena::alocar(size_t bytes, size_t alinhamento)
+{
+    if (!alinhamento || (alinhamento & (alinhamento - 1)) || alinhamento > 4096)
+        throw std::invalid_argument("Alinhamento inválido.");
+
+    for (; atual_ < blocos_.size(); atual_++, posicao_ = 0) {
+        const Bloco &b = blocos_[atual_];
+        const uintptr_t endereco = reinterpret_cast<uintptr_t>(b.inicio) + posicao_;
+        const size_t inicio = posicao_ + ((alinhamento - endereco % alinhamento) % alinhamento);
+        if (inicio <= b.tamanho && bytes <= b.tamanho - inicio) {
+            posicao_ = inicio + bytes;
+            return b.inicio + inicio;
+        }
+    }
+
+    // Os blocos começam alinhados a 64 bytes; alinhamentos maiores precisam de folga
+    const size_t folga = alinhamento > alinhamento_padrao ? alinhamento : 0;
+    const size_t ultimo = blocos_.empty() ? 0 : blocos_.back().tamanho;
+    novo_bloco_(std::max({bytes + folga, 2 * ultimo, bloco_minimo_}));
+    atual_ = blocos_.size() - 1;
+    posicao_ = 0;
+    return alocar(bytes, alinhamento);
+}
+
+/*!
+ * @brief Libera tudo o que foi alocado, mantendo a memória reservada.
+ *
+ * Se mais de um bloco foi necessário, eles são trocados por um único bloco com a soma dos
+ * tamanhos, para que o próximo ciclo caiba inteiro nele.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void Arena::zerar()
+{
+    if (blocos_.size() > 1) {
+        const size_t total = capacidade();
+        for (const Bloco &b : blocos_)
+            ::operator delete(b.inicio, std::align_val_t(alinhamento_padrao));
+        blocos_.clear();
+        novo_bloco_(total);
+    }
+    atual_ = 0;
+    posicao_ = 0;
+}
+
+/*! @brief Posição atual, para um restaurar() posterior. */
+Arena::Marca Arena::marca() const
+{
+    return {atual_, posicao_};
+}
+
+/*!
+ * @brief Libera tudo o que foi alocado depois de `marca`.
+ *
+ * @param marca Valor retornado por marca() (sem zerar() no meio).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void Arena::restaurar(Marca marca)
+{
+    atual_ = marca.bloco;
+    posicao_ = marca.posicao;
+}
+
+/*! @brief Total de bytes reservados em blocos. */
+size_t Arena::capacidade() const
+{
+    size_t total = 0;
+    for (const Bloco &b : blocos_)
+        total += b.tamanho;
+    return total;
+}
+
+/*! @brief Bytes ocupados (inclui o espaço perdido com alinhamento e no fim de blocos). */
+size_t Arena::em_uso() const
+{
+    size_t total = posicao_;
+    for (size_t i = 0; i < atual_ && i < blocos_.size(); i++)
+        total += blocos_[i].tamanho;
+    return total;
+}
+
+/*! @brief Número de blocos reservados. */
+size_t Arena::blocos() const
+{
+    return blocos_.size();
+}
+
+EscopoArena::EscopoArena(Arena &arena) : arena_(arena), marca_(arena.marca())
+{
+}
+
+EscopoArena::~EscopoArena()
+{
+    arena_.restaurar(marca_);
+}
+
+} // namespace ifnum
@@ -0,0 +1,287 @@
+/*!
+ * @file Arquivo.cpp
+ * @brief Partes não-template do formato binário: cabeçalho, mapeamento e arquivo de saída.
+ */
+
+#include "Arquivo.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace ifnum::detail
+{
+namespace
+{
+constexpr char magica[8] = {'I', 'F', 'N', 'U', 'M', 'M', 'A', 'T'};
+constexpr uint32_t marca_bytes = 0x01020304;
+constexpr size_t buffer_saida = size_t(1) << 20;
+
+size_t tamanho_elemento(uint32_t tipo)
+{
+    switch (static_cast<TipoDado>(tipo)) {
+    case TipoDado::f32:
+    case TipoDado::i32:
+        return 4;
+    case TipoDado::f64:
+    case TipoDado::i64:
+        return 8;
+    }
+    return 0;
+}
+
+std::string erro_sistema(const std::string &mensagem, const std::string &caminho)
+{
+    return mensagem + " " + caminho + ": " + std::strerror(errno);
+}
+
+size_t pagina()
+{
+    static const size_t p = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return p;
+}
+} // namespace
+
+/*!
+ * @brief Monta o cabeçalho de um arquivo por linha, sem preenchimento entre as linhas.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+CabecalhoArquivo novo_cabecalho(TipoDado tipo, size_t linhas, size_t colunas)
+{
+    CabecalhoArquivo c{};
+    std::memcpy(c.magica, magica, sizeof(magica));
+    c.versao = 1;
+    c.marca_bytes = marca_bytes;
+    c.tipo = static_cast<uint32_t>(tipo);
+    c.ordem = static_cast<uint32_t>(Ordem::por_linha);
+    c.linhas = linhas;
+    c.colunas = colunas;
+    c.passo = colunas;
+    c.alinhamento = static_cast<uint32_t>(alinhamento_padrao);
+    c.deslocamento = sizeof(CabecalhoArquivo);
+    return c;
+}
+
+/*!
+ * @brief Confere o cabeçalho lido de um arquivo.
+ *
+ * @param c Cabeçalho lido.
+ * @param tipo Tipo de elemento esperado.
+ * @param tamanho_arquivo Tamanho do arquivo, em bytes.
+ * @param caminho Caminho do arquivo (para as mensagens de erro).
+ * @throws std::runtime_error Se o arquivo não for uma matriz válida, for de outra ordem de
+ *         bytes ou estiver truncado.
+ * @throws std::invalid_argument Se o tipo dos elementos não for o esperado.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void validar_cabecalho(const CabecalhoArquivo &c, TipoDado tipo, size_t tamanho_arquivo,
+                       const std::string &caminho)
+{
+    if (tamanho_arquivo < sizeof(CabecalhoArquivo) ||
+        std::memcmp(c.magica, magica, sizeof(magica)) != 0)
+        throw std::runtime_error("Arquivo não é uma matriz: " + caminho);
+    if (c.versao != 1)
+        throw std::runtime_error("Versão do formato não suportada: " + caminho);
+    if (c.marca_bytes != marca_bytes)
+        throw std::runtime_error("Arquivo gravado com outra ordem de bytes: " + caminho);
+    if (c.tipo != static_cast<uint32_t>(tipo))
+        throw std::invalid_argument("Tipo dos elementos diferente do arquivo: " + caminho);
+    if (c.ordem > static_cast<uint32_t>(Ordem::por_coluna))
+        throw std::runtime_error("Ordem de armazenamento inválida: " + caminho);
+
+    const uint64_t dentro = c.ordem == static_cast<uint32_t>(Ordem::por_linha) ? c.colunas
+                                                                                : c.linhas;
+    const uint64_t fora = c.ordem == static_cast<uint32_t>(Ordem::por_linha) ? c.linhas
+                                                                              : c.colunas;
+    const size_t bytes = tamanho_elemento(c.tipo);
+    if (c.passo < dentro || c.deslocamento < sizeof(CabecalhoArquivo) ||
+        (c.alinhamento && c.deslocamento % c.alinhamento) || c.deslocamento % bytes)
+        throw std::runtime_error("Cabeçalho inconsistente: " + caminho);
+
+    // (fora - 1) * passo + dentro elementos: o passo é limitado por divisão antes, para que
+    // um cabeçalho forjado não estoure a conta e passe pelo teste de tamanho.
+    if (c.deslocamento > tamanho_arquivo)
+        throw std::runtime_error("Arquivo truncado: " + caminho);
+    const uint64_t disponiveis = (tamanho_arquivo - c.deslocamento) / bytes;
+    if (fora && dentro &&
+        (dentro > disponiveis || (fora > 1 && c.passo > (disponiveis - dentro) / (fora - 1))))
+        throw std::runtime_error("Arquivo truncado: " + caminho);
+}
+
+/*!
+ * @brief Diz se os dois caminhos levam ao mesmo arquivo (mesmo dispositivo e inode).
+ *
+ * Compara os arquivos, e não os textos, para pegar também ligações e caminhos relativos.
+ * Se algum dos dois não existir, retorna false.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+bool mesmo_arquivo(const std::string &a, const std::string &b)
+{
+    struct stat ia, ib;
+    if (::stat(a.c_str(), &ia) != 0 || ::stat(b.c_str(), &ib) != 0)
+        return false;
+    return ia.st_dev == ib.st_dev && ia.st_ino == ib.st_ino;
+}
+
+/*!
+ * @brief Mapeia o arquivo inteiro para leitura.
+ *
+ * @param caminho Caminho do arquivo.
+ * @param acesso Padrão de acesso, repassado ao madvise.
+ * @throws std::runtime_error Se o arquivo não puder ser aberto ou mapeado.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+Mapeamento::Mapeamento(const std::string &caminho, Acesso acesso)
+{
+    const int fd = ::open(caminho.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error(erro_sistema("Não foi possível abrir", caminho));
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        const std::string erro = erro_sistema("Não foi possível ler", caminho);
+        ::close(fd);
+        throw std::runtime_error(erro);
+    }
+    tamanho_ = static_cast<size_t>(info.st_size);
+
+    if (tamanho_) {
+        void *p = ::mmap(nullptr, tamanho_, PROT_READ, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED) {
+            const std::string erro = erro_sistema("Não foi possível mapear", caminho);
+            ::close(fd);
+            throw std::runtime_error(erro);
+        }
+        dados_ = static_cast<const unsigned char *>(p);
+        if (acesso == Acesso::sequencial)
+            ::madvise(p, tamanho_, MADV_SEQUENTIAL);
+        else if (acesso == Acesso::aleatorio)
+            ::madvise(p, tamanho_, MADV_RANDOM);
+    }
+    ::close(fd); // o mapeamento continua válido sem o descritor
+}
+
+Mapeamento::~Mapeamento()
+{
+    if (dados_)
+        ::munmap(const_cast<unsigned char *>(dados_), tamanho_);
+}
+
+Mapeamento::Mapeamento(Mapeamento &&outro) noexcept
+    : dados_(outro.dados_), tamanho_(outro.tamanho_)
+{
+    outro.dados_ = nullptr;
+    outro.tamanho_ = 0;
+}
+
+Mapeamento &Mapeamento::operator=(Mapeamento &&outro) noexcept
+{
+    std::swap(dados_, outro.dados_);
+    std::swap(tamanho_, outro.tamanho_);
+    return *this;
+}
+
+const unsigned char *Mapeamento::dados() const
+{
+    return dados_;
+}
+
+size_t Mapeamento::tamanho() const
+{
+    return tamanho_;
+}
+
+/*!
+ * @brief Pede ao sistema que comece a ler [inicio, inicio + bytes) em segundo plano.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void Mapeamento::antecipar(size_t inicio, size_t bytes) const
+{
+    if (!dados_ || inicio >= tamanho_)
+        return;
+    const size_t base = inicio / pagina() * pagina();
+    const size_t fim = std::min(inicio + bytes, tamanho_);
+    ::madvise(const_cast<unsigned char *>(dados_) + base, fim - base, MADV_WILLNEED);
+}
+
+/*!
+ * @brief Libera as páginas inteiramente contidas em [inicio, inicio + bytes).
+ *
+ * Como o mapeamento é somente leitura, as páginas são relidas do arquivo se forem acessadas
+ * de novo; o objetivo é só aliviar a memória em varreduras maiores que a RAM.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void Mapeamento::descartar(size_t inicio, size_t bytes) const
+{
+    if (!dados_ || inicio >= tamanho_)
+        return;
+    const size_t base = (inicio + pagina() - 1) / pagina() * pagina();
+    const size_t fim = std::min(inicio + bytes, tamanho_) / pagina() * pagina();
+    if (fim > base)
+        ::madvise(const_cast<unsigned char *>(dados_) + base, fim - base, MADV_DONTNEED);
+}
+
+/*!
+ * @brief Cria (ou trunca) o arquivo para gravação.
+ *
+ * @throws std::runtime_error Se o arquivo não puder ser criado.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+ArquivoSaida::ArquivoSaida(const std::string &caminho) : caminho_(caminho)
+{
+    arquivo_ = std::fopen(caminho.c_str(), "wb");
+    if (!arquivo_)
+        throw std::runtime_error(erro_sistema("Não foi possível criar", caminho));
+    std::setvbuf(arquivo_, nullptr, _IOFBF, buffer_saida);
+}
+
+ArquivoSaida::~ArquivoSaida()
+{
+    if (arquivo_)
+        std::fclose(arquivo_);
+}
+
+/*!
+ * @throws std::runtime_error Se a escrita falhar (ex.: disco cheio).
+ */
+void ArquivoSaida::escrever(const void *dados, size_t bytes)
+{
+    if (!arquivo_)
+        throw std::runtime_error("Arquivo já fechado: " + caminho_);
+    if (std::fwrite(dados, 1, bytes, arquivo_) != bytes)
+        throw std::runtime_error(erro_sistema("Falha ao gravar", caminho_));
+}
+
+/*!
+ * @throws std::runtime_error Se a gravação dos dados pendentes falhar.
+ */
+void ArquivoSaida::fechar()
+{
+    if (!arquivo_)
+        return;
+    const int resultado = std::fclose(arquivo_);
+    arquivo_ = nullptr;
+    if (resultado != 0)
+        throw std::runtime_error(erro_sistema("Falha ao gravar", caminho_));
+}
+
+} // namespace ifnum::detail
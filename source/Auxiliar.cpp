@@ -2,7 +2,12 @@
 
 namespace ifnum::rng
 {
-/*! @brief Gerador de números aleatórios Mersenne Twister, inicializado com std::random_device. */
+/*!
+ * @brief Gerador de números aleatórios Mersenne Twister, inicializado com std::random_device.
+ *
+ * Mantido por compatibilidade; a biblioteca não o usa mais. Não é seguro entre threads:
+ * prefira rng::local() ou um rng::Philox próprio.
+ */
 std::mt19937 mt{std::random_device{}()};
 
 } // namespace ifnum::rng
@@ -0,0 +1,391 @@
+/*!
+ * @file Blas1.cpp
+ * @brief Kernels de Blas1.hpp para `float` e `double`, com variantes SSE2, AVX2 e AVX-512.
+ *
+ * Cada kernel é escrito uma vez, sobre L faixas independentes (um vetor `T[L]` de
+ * acumuladores que o compilador mapeia em registradores SIMD), e instanciado com a largura
+ * de cada variante: 4 registradores de 128, 256 ou 512 bits. Nas reduções, os laços sobre as
+ * faixas são desenrolados por inteiro (`#pragma GCC unroll`); como laço, o vetor de faixas
+ * ficava na pilha e era lido e gravado a cada iteração. Como em Gemm.cpp e Lote.cpp,
+ * as variantes AVX2 e AVX-512 são compiladas com atributo de alvo; a tabela de kernels é
+ * escolhida na primeira chamada. Fora de x86, só a variante portável existe.
+ */
+
+#include "Blas1.hpp"
+#include "Cpu.hpp"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define IFNUM_BLAS1_X86 1
+#endif
+
+namespace ifnum::detail
+{
+namespace
+{
+/*! @brief Soma as L faixas aos pares. */
+template <typename T, size_t L>
+[[gnu::always_inline]] inline T reduzir_faixas(T *faixas)
+{
+#pragma GCC unroll 8
+    for (size_t largura = L / 2; largura > 0; largura /= 2)
+#pragma GCC unroll 64
+        for (size_t l = 0; l < largura; l++)
+            faixas[l] += faixas[l + largura];
+    return faixas[0];
+}
+
+/*! @brief Folha de dot: Σ x[i] y[i] em L faixas. */
+template <typename T, size_t L>
+struct FolhaDot {
+    const T *x, *y;
+
+    [[gnu::always_inline]] T operator()(size_t inicio, size_t quantidade) const
+    {
+        alignas(64) T faixas[L] = {};
+        const T *a = x + inicio, *b = y + inicio;
+        size_t i = 0;
+        for (; i + L <= quantidade; i += L)
+#pragma GCC unroll 64
+            for (size_t l = 0; l < L; l++)
+                faixas[l] += a[i + l] * b[i + l];
+        for (size_t l = 0; i + l < quantidade; l++)
+            faixas[l] += a[i + l] * b[i + l];
+        return reduzir_faixas<T, L>(faixas);
+    }
+};
+
+/*!
+ * @brief Folha de nrm2: Σ x[i]² ou, com `Escalar`, Σ (x[i] / escala)².
+ */
+template <typename T, size_t L, bool Escalar>
+struct FolhaQuadrados {
+    const T *x;
+    T escala;
+
+    [[gnu::always_inline]] T operator()(size_t inicio, size_t quantidade) const
+    {
+        alignas(64) T faixas[L] = {};
+        const T *a = x + inicio;
+        size_t i = 0;
+        for (; i + L <= quantidade; i += L) {
+#pragma GCC unroll 64
+            for (size_t l = 0; l < L; l++) {
+                const T u = Escalar ? a[i + l] / escala : a[i + l];
+                faixas[l] += u * u;
+            }
+        }
+        for (size_t l = 0; i + l < quantidade; l++) {
+            const T u = Escalar ? a[i + l] / escala : a[i + l];
+            faixas[l] += u * u;
+        }
+        return reduzir_faixas<T, L>(faixas);
+    }
+};
+
+/*! @brief Folha de asum: Σ |x[i]|. */
+template <typename T, size_t L>
+struct FolhaModulos {
+    const T *x;
+
+    [[gnu::always_inline]] T operator()(size_t inicio, size_t quantidade) const
+    {
+        alignas(64) T faixas[L] = {};
+        const T *a = x + inicio;
+        size_t i = 0;
+        for (; i + L <= quantidade; i += L)
+#pragma GCC unroll 64
+            for (size_t l = 0; l < L; l++)
+                faixas[l] += std::abs(a[i + l]);
+        for (size_t l = 0; i + l < quantidade; l++)
+            faixas[l] += std::abs(a[i + l]);
+        return reduzir_faixas<T, L>(faixas);
+    }
+};
+
+/*! @brief Maior |x[i]|, ignorando NaN (-1 se n = 0 ou se todos forem NaN). */
+template <typename T, size_t L>
+[[gnu::always_inline]] inline T maximo_(size_t n, const T *x)
+{
+    alignas(64) T faixas[L];
+    for (size_t l = 0; l < L; l++)
+        faixas[l] = T(-1);
+    size_t i = 0;
+    for (; i + L <= n; i += L) {
+#pragma GCC unroll 64
+        for (size_t l = 0; l < L; l++) {
+            const T v = std::abs(x[i + l]);
+            faixas[l] = v > faixas[l] ? v : faixas[l]; // comparação com NaN é falsa
+        }
+    }
+    for (size_t l = 0; i + l < n; l++) {
+        const T v = std::abs(x[i + l]);
+        faixas[l] = v > faixas[l] ? v : faixas[l];
+    }
+#pragma GCC unroll 8
+    for (size_t largura = L / 2; largura > 0; largura /= 2)
+#pragma GCC unroll 64
+        for (size_t l = 0; l < largura; l++)
+            faixas[l] = faixas[l + largura] > faixas[l] ? faixas[l + largura] : faixas[l];
+    return faixas[0];
+}
+
+template <typename T, size_t L>
+[[gnu::always_inline]] inline T dot_(size_t n, const T *x, const T *y)
+{
+    return somar_pareado<T>(n, FolhaDot<T, L>{x, y});
+}
+
+template <typename T, size_t L>
+[[gnu::always_inline]] inline T nrm2_(size_t n, const T *x)
+{
+    const T soma = somar_pareado<T>(n, FolhaQuadrados<T, L, false>{x, T(1)});
+    if (soma_quadrados_confiavel(soma))
+        return std::sqrt(soma);
+    const T escala = maximo_<T, L>(n, x);
+    if (escala == T(0) || std::isinf(escala))
+        return escala;
+    return escala * std::sqrt(somar_pareado<T>(n, FolhaQuadrados<T, L, true>{x, escala}));
+}
+
+template <typename T, size_t L>
+[[gnu::always_inline]] inline T asum_(size_t n, const T *x)
+{
+    return somar_pareado<T>(n, FolhaModulos<T, L>{x});
+}
+
+/*! @brief O máximo é achado por faixas; depois, a primeira posição que o atinge. */
+template <typename T, size_t L>
+[[gnu::always_inline]] inline size_t iamax_(size_t n, const T *x)
+{
+    const T maior = maximo_<T, L>(n, x);
+    for (size_t i = 0; i < n; i++)
+        if (std::abs(x[i]) == maior)
+            return i;
+    return 0;
+}
+
+/*!
+ * @brief y += alfa x em blocos de L elementos.
+ *
+ * O bloco de x é copiado antes, para que x == y não impeça a vetorização (e dê o mesmo
+ * resultado que o laço escalar).
+ */
+template <typename T, size_t L>
+[[gnu::always_inline]] inline void axpy_(size_t n, T alfa, const T *x, T *y)
+{
+    size_t i = 0;
+    for (; i + L <= n; i += L) {
+        alignas(64) T bloco[L];
+        std::memcpy(bloco, x + i, sizeof(bloco));
+        for (size_t l = 0; l < L; l++)
+            y[i + l] += alfa * bloco[l];
+    }
+    for (; i < n; i++)
+        y[i] += alfa * x[i];
+}
+
+template <typename T, size_t L>
+[[gnu::always_inline]] inline void scal_(size_t n, T alfa, T *x)
+{
+    size_t i = 0;
+    for (; i + L <= n; i += L)
+        for (size_t l = 0; l < L; l++)
+            x[i + l] *= alfa;
+    for (; i < n; i++)
+        x[i] *= alfa;
+}
+
+/*! @brief Kernels de uma variante, para um tipo. */
+template <typename T>
+struct NucleosBlas1 {
+    T (*dot)(size_t, const T *, const T *);
+    T (*nrm2)(size_t, const T *);
+    T (*asum)(size_t, const T *);
+    size_t (*iamax)(size_t, const T *);
+    void (*axpy)(size_t, T, const T *, T *);
+    void (*scal)(size_t, T, T *);
+};
+
+/*! @brief Variante portável: 4 registradores de 128 bits (SSE2 em x86-64). */
+template <typename T>
+struct VariantePadrao {
+    static constexpr size_t L = 64 / sizeof(T);
+    static T dot(size_t n, const T *x, const T *y) { return dot_<T, L>(n, x, y); }
+    static T nrm2(size_t n, const T *x) { return nrm2_<T, L>(n, x); }
+    static T asum(size_t n, const T *x) { return asum_<T, L>(n, x); }
+    static size_t iamax(size_t n, const T *x) { return iamax_<T, L>(n, x); }
+    static void axpy(size_t n, T alfa, const T *x, T *y) { axpy_<T, L>(n, alfa, x, y); }
+    static void scal(size_t n, T alfa, T *x) { scal_<T, L>(n, alfa, x); }
+};
+
+#ifdef IFNUM_BLAS1_X86
+/*! @brief Variante AVX2: 4 registradores de 256 bits. */
+template <typename T>
+struct VarianteAvx2 {
+    static constexpr size_t L = 128 / sizeof(T);
+    __attribute__((target("avx2"))) static T dot(size_t n, const T *x, const T *y)
+    {
+        return dot_<T, L>(n, x, y);
+    }
+    __attribute__((target("avx2"))) static T nrm2(size_t n, const T *x)
+    {
+        return nrm2_<T, L>(n, x);
+    }
+    __attribute__((target("avx2"))) static T asum(size_t n, const T *x)
+    {
+        return asum_<T, L>(n, x);
+    }
+    __attribute__((target("avx2"))) static size_t iamax(size_t n, const T *x)
+    {
+        return iamax_<T, L>(n, x);
+    }
+    __attribute__((target("avx2"))) static void axpy(size_t n, T alfa, const T *x, T *y)
+    {
+        axpy_<T, L>(n, alfa, x, y);
+    }
+    __attribute__((target("avx2"))) static void scal(size_t n, T alfa, T *x)
+    {
+        scal_<T, L>(n, alfa, x);
+    }
+};
+
+/*! @brief Variante AVX-512: 4 registradores de 512 bits. */
+template <typename T>
+struct VarianteAvx512 {
+    static constexpr size_t L = 256 / sizeof(T);
+    __attribute__((target("avx512f"))) static T dot(size_t n, const T *x, const T *y)
+    {
+        return dot_<T, L>(n, x, y);
+    }
+    __attribute__((target("avx512f"))) static T nrm2(size_t n, const T *x)
+    {
+        return nrm2_<T, L>(n, x);
+    }
+    __attribute__((target("avx512f"))) static T asum(size_t n, const T *x)
+    {
+        return asum_<T, L>(n, x);
+    }
+    __attribute__((target("avx512f"))) static size_t iamax(size_t n, const T *x)
+    {
+        return iamax_<T, L>(n, x);
+    }
+    __attribute__((target("avx512f"))) static void axpy(size_t n, T alfa, const T *x, T *y)
+    {
+        axpy_<T, L>(n, alfa, x, y);
+    }
+    __attribute__((target("avx512f"))) static void scal(size_t n, T alfa, T *x)
+    {
+        scal_<T, L>(n, alfa, x);
+    }
+};
+#endif
+
+template <typename V, typename T>
+NucleosBlas1<T> tabela()
+{
+    return {V::dot, V::nrm2, V::asum, V::iamax, V::axpy, V::scal};
+}
+
+/*!
+ * @brief Kernels da melhor variante disponível no processador, escolhidos uma única vez.
+ */
+template <typename T>
+const NucleosBlas1<T> &nucleos()
+{
+    static const NucleosBlas1<T> escolhidos = [] {
+#ifdef IFNUM_BLAS1_X86
+        if (recursos_cpu().avx512f)
+            return tabela<VarianteAvx512<T>, T>();
+        if (recursos_cpu().avx2)
+            return tabela<VarianteAvx2<T>, T>();
+#endif
+        return tabela<VariantePadrao<T>, T>();
+    }();
+    return escolhidos;
+}
+} // namespace
+
+/*!
+ * @brief Produto interno de vetores `float` contíguos (ver blas::dot).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+float dot(size_t n, const float *x, const float *y)
+{
+    return nucleos<float>().dot(n, x, y);
+}
+
+/*!
+ * @brief Produto interno de vetores `double` contíguos (ver blas::dot).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+double dot(size_t n, const double *x, const double *y)
+{
+    return nucleos<double>().dot(n, x, y);
+}
+
+/*! @brief Norma euclidiana de um vetor `float` contíguo (ver blas::nrm2). */
+float nrm2(size_t n, const float *x)
+{
+    return nucleos<float>().nrm2(n, x);
+}
+
+/*! @brief Norma euclidiana de um vetor `double` contíguo (ver blas::nrm2). */
+double nrm2(size_t n, const double *x)
+{
+    return nucleos<double>().nrm2(n, x);
+}
+
+/*! @brief Soma dos módulos de um vetor `float` contíguo. */
+float asum(size_t n, const float *x)
+{
+    return nucleos<float>().asum(n, x);
+}
+
+/*! @brief Soma dos módulos de um vetor `double` contíguo. */
+double asum(size_t n, const double *x)
+{
+    return nucleos<double>().asum(n, x);
+}
+
+/*! @brief Índice do primeiro maior módulo de um vetor `float` contíguo. */
+size_t iamax(size_t n, const float *x)
+{
+    return nucleos<float>().iamax(n, x);
+}
+
+/*! @brief Índice do primeiro maior módulo de um vetor `double` contíguo. */
+size_t iamax(size_t n, const double *x)
+{
+    return nucleos<double>().iamax(n, x);
+}
+
+/*! @brief y += alfa x para vetores `float` contíguos. */
+void axpy(size_t n, float alfa, const float *x, float *y)
+{
+    nucleos<float>().axpy(n, alfa, x, y);
+}
+
+/*! @brief y += alfa x para vetores `double` contíguos. */
+void axpy(size_t n, double alfa, const double *x, double *y)
+{
+    nucleos<double>().axpy(n, alfa, x, y);
+}
+
+/*! @brief x *= alfa para um vetor `float` contíguo. */
+void scal(size_t n, float alfa, float *x)
+{
+    nucleos<float>().scal(n, alfa, x);
+}
+
+/*! @brief x *= alfa para um vetor `double` contíguo. */
+void scal(size_t n, double alfa, double *x)
+{
+    nucleos<double>().scal(n, alfa, x);
+}
+
+} // namespace ifnum::detail
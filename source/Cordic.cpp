@@ -7,11 +7,467 @@
  */
 
 #include "Cordic.hpp"
+#include "CordicFixo.hpp"
+#include "Instrumentacao.hpp"
+#include "Paralelo.hpp"
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 
 namespace ifnum::cordic
 {
+namespace
+{
+constexpr int ITERACOES = 30;
+
+/*! @brief atan(2⁻ⁱ) em graus, para i = 0, ..., 29 (arcos do modo circular). */
+constexpr std::array<double, ITERACOES> angles = {
+    45.0,
+    26.56505117707799,
+    14.036243467926479,
+    7.1250163489017977,
+    3.5763343749973511,
+    1.7899106082460694,
+    0.89517371021107439,
+    0.44761417086055311,
+    0.22381050036853808,
+    0.1119056770662069,
+    0.055952891893803675,
+    0.027976452617003676,
+    0.013988227142265016,
+    0.0069941136753529191,
+    0.0034970568507040108,
+    0.0017485284269804495,
+    0.00087426421369378026,
+    0.00043713210687233457,
+    0.00021856605343934784,
+    0.00010928302672007149,
+    5.464151336008544e-05,
+    2.7320756680048934e-05,
+    1.3660378340025243e-05,
+    6.8301891700127188e-06,
+    3.4150945850063712e-06,
+    1.7075472925031871e-06,
+    8.5377364625159377e-07,
+    4.2688682312579694e-07,
+    2.1344341156289847e-07,
+    1.0672170578144923e-07};
+
+/*! @brief atanh(2⁻ⁱ), para i = 1, ..., 30 (arcos dos modos hiperbólicos). */
+constexpr std::array<double, ITERACOES> arcos_hiperbolicos = {
+    0.54930614433405478,    0.25541281188299536,    0.12565721414045303,
+    0.062581571477003009,   0.031260178490666993,   0.015626271752052209,
+    0.0078126589515404212,  0.0039062698683968262,  0.0019531274835325498,
+    0.00097656281044103594, 0.00048828128880511277, 0.00024414062985063861,
+    0.00012207031310632982, 6.1035156325791221e-05, 3.0517578134473901e-05,
+    1.5258789063684237e-05, 7.6293945313980292e-06, 3.8146972656435034e-06,
+    1.9073486328148128e-06, 9.5367431640653905e-07, 4.768371582031611e-07,
+    2.38418579101567e-07,   1.1920928955078181e-07, 5.9604644775390691e-08,
+    2.9802322387695319e-08, 1.4901161193847656e-08, 7.4505805969238281e-09,
+    3.7252902984619141e-09, 1.862645149230957e-09,  9.3132257461547852e-10};
+
+/*! @brief Ganho do modo circular após 30 iterações: prod 1 / sqrt(1 + 2⁻²ⁱ). */
+constexpr double K = 0.60725293500888133;
+
+/*!
+ * @brief Ganho dos modos hiperbólicos: prod sqrt(1 - 2⁻²ⁱ) sobre a sequência de passos
+ *        (i = 1, ..., 30, com 4 e 13 repetidos).
+ */
+constexpr double K_HIPERBOLICO = 0.8281593609602157;
+
+constexpr double LN2 = 0.69314718055994530942;
+// ln 2 em duas partes: LN2_ALTO tem só 32 bits significativos, então k * LN2_ALTO é exato.
+constexpr double LN2_ALTO = 0.693147180369123816490;
+constexpr double LN2_BAIXO = 1.90821492927058770002e-10;
+
+/*! @brief Valores processados juntos pelas versões em lote. */
+constexpr size_t BLOCO = 64;
+
+/*! @brief 2ᵉ, para e em [-1022, 1023], montado diretamente nos bits do expoente. */
+double potencia_de_dois(int e)
+{
+    const uint64_t bits = static_cast<uint64_t>(e + 1023) << 52;
+    double resultado;
+    std::memcpy(&resultado, &bits, sizeof(resultado));
+    return resultado;
+}
+
+/*!
+ * @brief x · 2ᵉ, para |e| <= 2044, sem chamar std::scalbn (o laço continua vetorizável).
+ *
+ * Multiplica por duas potências de 2 normais; só a segunda pode arredondar (resultado
+ * subnormal) ou estourar.
+ */
+double escalar(double x, int e)
+{
+    const int metade = e / 2;
+    return x * potencia_de_dois(metade) * potencia_de_dois(e - metade);
+}
+
+/*!
+ * @brief Separa x > 0 finito em m · 2ᵉ, com m em [1/2, 1), como std::frexp.
+ */
+double separar(double x, int &e)
+{
+    int ajuste = 0;
+    if (x < std::numeric_limits<double>::min()) { // subnormal: normaliza antes
+        x *= 0x1p54;
+        ajuste = 54;
+    }
+    uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    e = static_cast<int>((bits >> 52) & 0x7ff) - 1022 - ajuste;
+    bits = (bits & ~(uint64_t(0x7ff) << 52)) | (uint64_t(1022) << 52);
+    std::memcpy(&x, &bits, sizeof(x));
+    return x;
+}
+
+/*!
+ * @brief Reduz um ângulo em graus a [-90, 90], onde a rotação do CORDIC converge.
+ *
+ * A rotação só alcança |ângulo| < 99.9° (a soma dos arcos). O ângulo é reduzido a
+ * [-180, 180] por detail::cordic_reduzir_graus e, fora de [-90, 90], deslocado de meia
+ * volta; as operações são exatas. Girar meia volta a mais troca o sinal do vetor, e `sinal`
+ * recebe -1 nesse caso. NaN e infinitos saem como NaN.
+ */
+double reduzir_angulo(double angulo, double &sinal)
+{
+    double r = ifnum::detail::cordic_reduzir_graus(angulo);
+    if (r > 180.0) // só pelo fmod, para |ângulo| >= 2⁴⁶
+        r -= 360.0;
+    else if (r < -180.0)
+        r += 360.0;
+    sinal = 1.0;
+    if (r > 90.0) {
+        r -= 180.0;
+        sinal = -1.0;
+    } else if (r < -90.0) {
+        r += 180.0;
+        sinal = -1.0;
+    }
+    return r;
+}
+
+/*! @brief Um passo hiperbólico: 2⁻ⁱ e atanh(2⁻ⁱ). */
+struct PassoHiperbolico {
+    double potencia;
+    double arco;
+};
+
+/*!
+ * @brief Sequência de passos dos modos hiperbólicos.
+ *
+ * O modo hiperbólico só converge se os passos i = 4, 13, 40, ... (i' = 3i + 1) forem
+ * repetidos; com 30 arcos, repetem-se 4 e 13, num total de 32 passos.
+ */
+constexpr std::array<PassoHiperbolico, ITERACOES + 2> passos_hiperbolicos = [] {
+    std::array<PassoHiperbolico, ITERACOES + 2> passos{};
+    size_t n = 0;
+    double potencia = 0.5;
+    int repetir = 4;
+    for (int i = 1; i <= ITERACOES; i++) {
+        passos[n++] = {potencia, arcos_hiperbolicos[i - 1]};
+        if (i == repetir) {
+            passos[n++] = {potencia, arcos_hiperbolicos[i - 1]};
+            repetir = 3 * repetir + 1;
+        }
+        potencia *= 0.5;
+    }
+    return passos;
+}();
+
+/*!
+ * @brief Modo vetorial circular: gira cada (x, y) até y = 0, acumulando o ângulo em z.
+ *
+ * Ao final, x = r / K e z = z₀ + atan2(y₀, x₀) em graus (para x₀ > 0). O laço interno
+ * percorre os N valores do bloco, então as iterações são vetorizadas entre elementos.
+ */
+template <size_t N>
+void vetorial_circular(double (&__restrict x)[N], double (&__restrict y)[N],
+                       double (&__restrict z)[N])
+{
+    double potencia = 1.0;
+    for (int i = 0; i < ITERACOES; i++) {
+        const double arco = angles[i];
+        for (size_t k = 0; k < N; k++) {
+            const double direcao = -std::copysign(1.0, y[k]);
+            const double passo = direcao * potencia;
+            const double xk = x[k], yk = y[k];
+            x[k] = xk - passo * yk;
+            y[k] = yk + passo * xk;
+            z[k] -= direcao * arco;
+        }
+        potencia *= 0.5;
+    }
+}
+
+/*!
+ * @brief Modo de rotação hiperbólico: leva z a 0.
+ *
+ * Ao final, x = (x₀ cosh z₀ + y₀ senh z₀) K_HIPERBOLICO e y = (y₀ cosh z₀ + x₀ senh z₀)
+ * K_HIPERBOLICO, para |z₀| < 1.118.
+ */
+template <size_t N>
+void rotacao_hiperbolica(double (&__restrict x)[N], double (&__restrict y)[N],
+                         double (&__restrict z)[N])
+{
+    for (const PassoHiperbolico &p : passos_hiperbolicos) {
+        for (size_t k = 0; k < N; k++) {
+            const double direcao = std::copysign(1.0, z[k]);
+            const double passo = direcao * p.potencia;
+            const double xk = x[k], yk = y[k];
+            x[k] = xk + passo * yk;
+            y[k] = yk + passo * xk;
+            z[k] -= direcao * p.arco;
+        }
+    }
+}
+
+/*!
+ * @brief Modo vetorial hiperbólico: leva y a 0.
+ *
+ * Ao final, x = sqrt(x₀² - y₀²) K_HIPERBOLICO e z = z₀ + atanh(y₀ / x₀), para
+ * |atanh(y₀ / x₀)| < 1.118.
+ */
+template <size_t N>
+void vetorial_hiperbolico(double (&__restrict x)[N], double (&__restrict y)[N],
+                          double (&__restrict z)[N])
+{
+    for (const PassoHiperbolico &p : passos_hiperbolicos) {
+        for (size_t k = 0; k < N; k++) {
+            const double direcao = -std::copysign(1.0, y[k]);
+            const double passo = direcao * p.potencia;
+            const double xk = x[k], yk = y[k];
+            x[k] = xk + passo * yk;
+            y[k] = yk + passo * xk;
+            z[k] -= direcao * p.arco;
+        }
+    }
+}
+
+/*!
+ * @brief Seno e cosseno de até N ângulos (em graus); `seno` ou `cosseno` podem ser nulos.
+ *
+ * Reduz os ângulos e repete as operações de rotate, com a direção tirada do sinal de
+ * (ângulo - acumulado), e dá os mesmos resultados. NaN entra como 0 e sai como NaN.
+ */
+template <size_t N>
+void rotacao_bloco(const double *angulo, double *seno, double *cosseno, size_t m)
+{
+    double vx[N], vy[N], alvo[N], atual[N], sinal[N];
+    for (size_t k = 0; k < N; k++) {
+        vx[k] = K;
+        vy[k] = atual[k] = alvo[k] = 0.0;
+        sinal[k] = 1.0;
+        if (k < m) {
+            const double r = reduzir_angulo(angulo[k], sinal[k]);
+            if (std::isnan(r))
+                sinal[k] = std::numeric_limits<double>::quiet_NaN();
+            else
+                alvo[k] = r + 0.0;
+        }
+    }
+
+    double potencia = 1.0;
+    for (int i = 0; i < ITERACOES; i++) {
+        const double arco = angles[i];
+        for (size_t k = 0; k < N; k++) {
+            const double direcao = std::copysign(1.0, alvo[k] - atual[k]);
+            const double passo = direcao * potencia;
+            const double xk = vx[k], yk = vy[k];
+            vx[k] = xk - passo * yk;
+            vy[k] = yk + passo * xk;
+            atual[k] += direcao * arco;
+        }
+        potencia *= 0.5;
+    }
+
+    for (size_t k = 0; k < m; k++) {
+        if (seno)
+            seno[k] = sinal[k] * vy[k];
+        if (cosseno)
+            cosseno[k] = sinal[k] * vx[k];
+    }
+}
+
+/*!
+ * @brief Coordenadas polares de até N pontos; `raio` ou `angulo` podem ser nulos.
+ *
+ * Pontos com x < 0 são girados de meia volta (o modo vetorial só converge para
+ * |ângulo| < 99.9°) e todos são escalados por uma potência de 2, para que o ganho do
+ * CORDIC não cause overflow nem os subnormais percam precisão.
+ */
+template <size_t N>
+void polar_bloco(const double *x, const double *y, double *raio, double *angulo, size_t m)
+{
+    double vx[N], vy[N], vz[N];
+    int expoente[N];
+    for (size_t k = 0; k < N; k++) {
+        vx[k] = 1.0;
+        vy[k] = vz[k] = 0.0;
+        expoente[k] = 0;
+        if (k >= m)
+            continue;
+        double a = x[k], b = y[k];
+        if (std::signbit(a)) {
+            vz[k] = std::signbit(b) ? -180.0 : 180.0;
+            a = -a;
+            b = -b;
+        }
+        const double maior = std::max(std::fabs(a), std::fabs(b));
+        if (maior > 0 && std::isfinite(maior))
+            separar(maior, expoente[k]);
+        vx[k] = escalar(a, -expoente[k]);
+        vy[k] = escalar(b, -expoente[k]);
+    }
+
+    vetorial_circular(vx, vy, vz);
+
+    for (size_t k = 0; k < m; k++) {
+        double r = escalar(vx[k] * K, expoente[k]);
+        double theta = vz[k];
+        if (std::isnan(x[k]) || std::isnan(y[k])) {
+            r = theta = std::numeric_limits<double>::quiet_NaN();
+        } else if (std::isinf(x[k]) || std::isinf(y[k])) {
+            r = std::numeric_limits<double>::infinity();
+            theta = std::atan2(y[k], x[k]) * (180.0 / M_PI);
+        } else if (x[k] == 0 && y[k] == 0) {
+            theta = std::atan2(y[k], x[k]) * (180.0 / M_PI); // ±0 ou ±180, conforme os sinais
+        }
+        if (raio)
+            raio[k] = r;
+        if (angulo)
+            angulo[k] = theta;
+    }
+}
+
+/*!
+ * @brief exp de até N valores: x = k ln 2 + r, com |r| <= ln(2) / 2, e exp(x) = 2ᵏ eʳ.
+ */
+template <size_t N>
+void exp_bloco(const double *x, double *resultado, size_t m)
+{
+    double vx[N], vy[N], vz[N];
+    int expoente[N];
+    for (size_t k = 0; k < N; k++) {
+        vx[k] = 1.0 / K_HIPERBOLICO;
+        vy[k] = vz[k] = 0.0;
+        expoente[k] = 0;
+        if (k >= m || !(std::fabs(x[k]) < 746.0))
+            continue;
+        const double q = (x[k] * (1 / LN2) + 0x1.8p52) - 0x1.8p52; // arredonda para inteiro
+        expoente[k] = static_cast<int>(q);
+        vz[k] = (x[k] - q * LN2_ALTO) - q * LN2_BAIXO;
+    }
+
+    rotacao_hiperbolica(vx, vy, vz);
+
+    for (size_t k = 0; k < m; k++) {
+        if (std::fabs(x[k]) < 746.0)
+            resultado[k] = escalar(vx[k] + vy[k], expoente[k]); // cosh r + senh r
+        else if (std::isnan(x[k]))
+            resultado[k] = x[k];
+        else
+            resultado[k] = x[k] > 0 ? std::numeric_limits<double>::infinity() : 0.0;
+    }
+}
+
+/*!
+ * @brief log de até N valores: x = 2ᵉ m, com m em [√2/2, √2), e log(x) = e ln 2 + log(m).
+ *
+ * log(m) = 2 atanh((m - 1) / (m + 1)), obtido pelo modo vetorial hiperbólico.
+ */
+template <size_t N>
+void log_bloco(const double *x, double *resultado, size_t m)
+{
+    double vx[N], vy[N], vz[N];
+    int expoente[N];
+    for (size_t k = 0; k < N; k++) {
+        vx[k] = 1.0;
+        vy[k] = vz[k] = 0.0;
+        expoente[k] = 0;
+        if (k >= m || !(x[k] > 0) || std::isinf(x[k]))
+            continue;
+        double mantissa = separar(x[k], expoente[k]);
+        if (mantissa < M_SQRT1_2) {
+            mantissa *= 2;
+            expoente[k]--;
+        }
+        vx[k] = mantissa + 1;
+        vy[k] = mantissa - 1;
+    }
+
+    vetorial_hiperbolico(vx, vy, vz);
+
+    for (size_t k = 0; k < m; k++) {
+        if (x[k] > 0 && !std::isinf(x[k]))
+            resultado[k] = 2 * vz[k] + expoente[k] * LN2;
+        else if (x[k] == 0)
+            resultado[k] = -std::numeric_limits<double>::infinity();
+        else if (x[k] > 0)
+            resultado[k] = x[k];
+        else
+            resultado[k] = std::numeric_limits<double>::quiet_NaN();
+    }
+}
+
+/*!
+ * @brief sqrt de até N valores: x = 2²ᵉ f, com f em [1/2, 2), e sqrt(x) = 2ᵉ sqrt(f).
+ *
+ * sqrt(f) = sqrt((f + 1/4)² - (f - 1/4)²), obtido pelo modo vetorial hiperbólico.
+ */
+template <size_t N>
+void sqrt_bloco(const double *x, double *resultado, size_t m)
+{
+    double vx[N], vy[N], vz[N];
+    int expoente[N];
+    for (size_t k = 0; k < N; k++) {
+        vx[k] = 1.0;
+        vy[k] = vz[k] = 0.0;
+        expoente[k] = 0;
+        if (k >= m || !(x[k] > 0) || std::isinf(x[k]))
+            continue;
+        double fracao = separar(x[k], expoente[k]);
+        if (expoente[k] % 2 != 0) {
+            fracao *= 2;
+            expoente[k]--;
+        }
+        vx[k] = fracao + 0.25;
+        vy[k] = fracao - 0.25;
+    }
+
+    vetorial_hiperbolico(vx, vy, vz);
+
+    for (size_t k = 0; k < m; k++) {
+        if (x[k] > 0 && !std::isinf(x[k]))
+            resultado[k] = escalar(vx[k] / K_HIPERBOLICO, expoente[k] / 2);
+        else if (x[k] == 0 || x[k] > 0)
+            resultado[k] = x[k]; // ±0 e +inf
+        else
+            resultado[k] = std::numeric_limits<double>::quiet_NaN();
+    }
+}
+
+/*!
+ * @brief Divide n valores em blocos de BLOCO e os distribui entre as threads do pool.
+ *
+ * `bloco(inicio, m)` processa os valores [inicio, inicio + m).
+ */
+template <typename F>
+void em_blocos(size_t n, F &&bloco)
+{
+    const size_t blocos = (n + BLOCO - 1) / BLOCO;
+    paralelo::para(0, blocos, BLOCO * ITERACOES, [&](size_t inicio, size_t fim) {
+        for (size_t b = inicio; b < fim; b++) {
+            const size_t primeiro = b * BLOCO;
+            bloco(primeiro, std::min(BLOCO, n - primeiro));
+        }
+    });
+}
+} // namespace
 
 /*!
  * @brief Realiza uma rotação de vetor (x, y) por um ângulo usando o algoritmo CORDIC.
@@ -20,9 +476,12 @@ namespace ifnum::cordic
  * uma rotação aproximada de um vetor no plano 2D. A rotação é feita iterativamente
  * com deslocamentos binários, evitando multiplicações pesadas.
  *
+ * O ângulo é antes reduzido a [-90, 90] (reduzir_angulo), pois as iterações só convergem
+ * para |ângulo| < 99.9°; a meia volta retirada é devolvida trocando o sinal do resultado.
+ *
  * @param x Componente x do vetor original.
  * @param y Componente y do vetor original.
- * @param angle Ângulo de rotação em graus.
+ * @param angle Ângulo de rotação em graus (NaN ou infinito: resultado NaN).
  * @return std::pair<double, double> Vetor rotacionado (x', y').
  *
  * @author Yean Jy Chen
@@ -30,12 +489,14 @@ namespace ifnum::cordic
  */
 std::pair<double, double> rotate(double x, double y, double angle)
 {
-    constexpr std::array<double, 30> angles = {
-        45.0,      26.565,    14.0362,   7.12502,   3.57633,   1.78991,   0.895174,  0.447614,
-        0.223811,  0.111906,  0.055953,  0.027977,  0.0139887, 0.0069943, 0.0034971, 0.0017486,
-        0.0008743, 0.0004372, 0.0002186, 0.0001093, 0.0000546, 0.0000273, 0.0000136, 0.0000068,
-        0.0000034, 0.0000017, 0.0000008, 0.0000004, 0.0000002, 0.0000001};
-    constexpr int MAX_ITERATIONS = 30;
+    IFNUM_MEDIR("cordic::rotate");
+    IFNUM_FLOPS(6 * ITERACOES);
+    constexpr int MAX_ITERATIONS = ITERACOES;
+
+    double sinal;
+    angle = reduzir_angulo(angle, sinal) + 0.0;
+    if (std::isnan(angle))
+        return {angle, angle};
 
     double current_angle = 0.0;
     double power_of_two = 1.0;
@@ -44,7 +505,9 @@ std::pair<double, double> rotate(double x, double y, double angle)
         double angle_step = angles[i];
         double new_x, new_y;
 
-        int direction = (angle < current_angle) ? -1 : 1;
+        // Sinal da diferença em vez de um desvio: depois da redução, a direção muda de forma
+        // imprevisível entre ângulos (-0 virou +0 na redução, como na comparação).
+        double direction = std::copysign(1.0, angle - current_angle);
         new_x = x - direction * power_of_two * y;
         new_y = y + direction * power_of_two * x;
         current_angle += direction * angle_step;
@@ -53,7 +516,7 @@ std::pair<double, double> rotate(double x, double y, double angle)
         x = new_x;
         y = new_y;
     }
-    return {x, y};
+    return {sinal * x, sinal * y};
 }
 
 /*!
@@ -69,7 +532,6 @@ std::pair<double, double> rotate(double x, double y, double angle)
  */
 double sin(double angle)
 {
-    constexpr double K = 0.6072529350088812561694;
     return rotate(K, 0, angle).second;
 }
 
@@ -86,8 +548,229 @@ double sin(double angle)
  */
 double cos(double angle)
 {
-    constexpr double K = 0.6072529350088812561694;
     return rotate(K, 0, angle).first;
 }
 
+/*!
+ * @brief Converte (x, y) para coordenadas polares usando o modo vetorial do CORDIC.
+ *
+ * Gira o vetor até o eixo x com os mesmos arcos de rotate, acumulando o ângulo; o módulo
+ * sai multiplicado pelo inverso do ganho K. Erro: ângulo com erro absoluto menor que
+ * 1.1e-7 graus (atan(2⁻²⁹), o último arco) e módulo com erro relativo menor que 2e-15.
+ *
+ * @param x Componente x do vetor.
+ * @param y Componente y do vetor.
+ * @return std::pair<double, double> Par {módulo, ângulo}, com o ângulo em graus, em [-180, 180].
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+std::pair<double, double> polar(double x, double y)
+{
+    double raio, angulo;
+    polar_bloco<1>(&x, &y, &raio, &angulo, 1);
+    return {raio, angulo};
+}
+
+/*!
+ * @brief Calcula o ângulo do vetor (x, y) usando CORDIC (ver polar).
+ *
+ * @param y Componente y do vetor.
+ * @param x Componente x do vetor.
+ * @return Ângulo em graus, em [-180, 180], como std::atan2 (que usa radianos).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+double atan2(double y, double x)
+{
+    return polar(x, y).second;
+}
+
+/*!
+ * @brief Calcula o módulo do vetor (x, y) usando CORDIC (ver polar).
+ *
+ * @param x Componente x do vetor.
+ * @param y Componente y do vetor.
+ * @return sqrt(x² + y²), sem overflow intermediário.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+double hypot(double x, double y)
+{
+    return polar(x, y).first;
+}
+
+/*!
+ * @brief Calcula eˣ usando o modo de rotação hiperbólico do CORDIC.
+ *
+ * Reduz x para r = x - k ln 2, com |r| <= ln(2) / 2, obtém cosh r + senh r e multiplica
+ * por 2ᵏ. Erro relativo menor que 1e-9 (atanh(2⁻³⁰), o último arco).
+ *
+ * @param x Expoente.
+ * @return Aproximação de eˣ (0 ou infinito fora do intervalo representável).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+double exp(double x)
+{
+    double resultado;
+    exp_bloco<1>(&x, &resultado, 1);
+    return resultado;
+}
+
+/*!
+ * @brief Calcula o logaritmo natural usando o modo vetorial hiperbólico do CORDIC.
+ *
+ * Separa x = 2ᵉ m e obtém log(m) = 2 atanh((m - 1) / (m + 1)). Erro absoluto menor que
+ * 2e-9 (o erro relativo cresce perto de x = 1, onde log(x) se aproxima de 0).
+ *
+ * @param x Valor positivo.
+ * @return Aproximação de log(x); -infinito para 0 e NaN para valores negativos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+double log(double x)
+{
+    double resultado;
+    log_bloco<1>(&x, &resultado, 1);
+    return resultado;
+}
+
+/*!
+ * @brief Calcula a raiz quadrada usando o modo vetorial hiperbólico do CORDIC.
+ *
+ * Separa x = 2²ᵉ f e obtém sqrt(f) = sqrt((f + 1/4)² - (f - 1/4)²). Erro relativo menor
+ * que 2e-15.
+ *
+ * @param x Valor não negativo.
+ * @return Aproximação de sqrt(x); NaN para valores negativos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+double sqrt(double x)
+{
+    double resultado;
+    sqrt_bloco<1>(&x, &resultado, 1);
+    return resultado;
+}
+
+/*!
+ * @brief Calcula o seno de n ângulos em graus (ver a versão em lote de atan2).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void sin(const double *angle, double *result, size_t n)
+{
+    IFNUM_MEDIR("cordic::sin (lote)");
+    IFNUM_BYTES(2 * sizeof(double) * n);
+    em_blocos(n, [&](size_t inicio, size_t m) {
+        rotacao_bloco<BLOCO>(angle + inicio, result + inicio, nullptr, m);
+    });
+}
+
+/*!
+ * @brief Calcula o cosseno de n ângulos em graus (ver a versão em lote de atan2).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void cos(const double *angle, double *result, size_t n)
+{
+    IFNUM_MEDIR("cordic::cos (lote)");
+    IFNUM_BYTES(2 * sizeof(double) * n);
+    em_blocos(n, [&](size_t inicio, size_t m) {
+        rotacao_bloco<BLOCO>(angle + inicio, nullptr, result + inicio, m);
+    });
+}
+
+/*!
+ * @brief Calcula atan2 (em graus) de n pares de valores.
+ *
+ * As versões em lote processam blocos de 64 valores, com as iterações do CORDIC vetorizadas
+ * entre os elementos do bloco, e dividem lotes grandes entre as threads do pool. Os
+ * resultados e os limites de erro são os mesmos das versões escalares.
+ *
+ * @param y Componentes y.
+ * @param x Componentes x.
+ * @param result Saída com n posições.
+ * @param n Número de valores.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void atan2(const double *y, const double *x, double *result, size_t n)
+{
+    IFNUM_MEDIR("cordic::atan2 (lote)");
+    IFNUM_BYTES(3 * sizeof(double) * n);
+    em_blocos(n, [&](size_t inicio, size_t m) {
+        polar_bloco<BLOCO>(x + inicio, y + inicio, nullptr, result + inicio, m);
+    });
+}
+
+/*!
+ * @brief Calcula o módulo de n vetores (ver a versão em lote de atan2).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void hypot(const double *x, const double *y, double *result, size_t n)
+{
+    IFNUM_MEDIR("cordic::hypot (lote)");
+    IFNUM_BYTES(3 * sizeof(double) * n);
+    em_blocos(n, [&](size_t inicio, size_t m) {
+        polar_bloco<BLOCO>(x + inicio, y + inicio, result + inicio, nullptr, m);
+    });
+}
+
+/*!
+ * @brief Calcula eˣ de n valores (ver a versão em lote de atan2).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void exp(const double *x, double *result, size_t n)
+{
+    IFNUM_MEDIR("cordic::exp (lote)");
+    IFNUM_BYTES(2 * sizeof(double) * n);
+    em_blocos(n, [&](size_t inicio, size_t m) {
+        exp_bloco<BLOCO>(x + inicio, result + inicio, m);
+    });
+}
+
+/*!
+ * @brief Calcula o logaritmo natural de n valores (ver a versão em lote de atan2).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void log(const double *x, double *result, size_t n)
+{
+    IFNUM_MEDIR("cordic::log (lote)");
+    IFNUM_BYTES(2 * sizeof(double) * n);
+    em_blocos(n, [&](size_t inicio, size_t m) {
+        log_bloco<BLOCO>(x + inicio, result + inicio, m);
+    });
+}
+
+/*!
+ * @brief Calcula a raiz quadrada de n valores (ver a versão em lote de atan2).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void sqrt(const double *x, double *result, size_t n)
+{
+    IFNUM_MEDIR("cordic::sqrt (lote)");
+    IFNUM_BYTES(2 * sizeof(double) * n);
+    em_blocos(n, [&](size_t inicio, size_t m) {
+        sqrt_bloco<BLOCO>(x + inicio, result + inicio, m);
+    });
+}
+
 } // namespace ifnum::cordic
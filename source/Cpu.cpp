@@ -0,0 +1,39 @@
+/*!
+ * @file Cpu.cpp
+ * @brief Implementação da detecção de recursos do processador declarada em Cpu.hpp.
+ */
+
+#include "Cpu.hpp"
+
+namespace ifnum::detail
+{
+/*!
+ * @brief Retorna os recursos SIMD do processador atual.
+ *
+ * A consulta (CPUID) é feita uma única vez, na primeira chamada. Em arquiteturas
+ * que não são x86, todos os recursos são reportados como ausentes e os kernels
+ * usam suas versões portáveis.
+ *
+ * @return Referência para a estrutura com os recursos detectados.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+const RecursosCpu &recursos_cpu()
+{
+    static const RecursosCpu recursos = [] {
+        RecursosCpu r;
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_cpu_init();
+        r.sse2 = __builtin_cpu_supports("sse2");
+        r.avx2 = __builtin_cpu_supports("avx2");
+        r.fma = __builtin_cpu_supports("fma");
+        r.avx512f = __builtin_cpu_supports("avx512f");
+#endif
+        return r;
+    }();
+
+    return recursos;
+}
+
+} // namespace ifnum::detail
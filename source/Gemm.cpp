@@ -0,0 +1,201 @@
+/*!
+ * @file Gemm.cpp
+ * @brief Sobrecargas do kernel GEMM para `float` e `double` e seus micro-kernels AVX2/FMA.
+ *
+ * Os micro-kernels SIMD são compilados com atributos de alvo, de modo que a biblioteca
+ * continua rodando em qualquer x86-64; a escolha do kernel é feita em tempo de execução.
+ */
+
+#include "Gemm.hpp"
+#include "Cpu.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define IFNUM_GEMM_X86 1
+#endif
+
+namespace ifnum::detail
+{
+namespace
+{
+// Tamanhos de bloco: MC x KC de A cabe na L2, KC x NR de B na L1.
+constexpr size_t MC_DOUBLE = 96;
+constexpr size_t KC_DOUBLE = 256;
+constexpr size_t NC_DOUBLE = 2048;
+
+constexpr size_t MC_FLOAT = 96;
+constexpr size_t KC_FLOAT = 384;
+constexpr size_t NC_FLOAT = 4096;
+
+#ifdef IFNUM_GEMM_X86
+/*!
+ * @brief Micro-kernel AVX2/FMA 6x8 para double (12 acumuladores de 256 bits).
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+__attribute__((target("avx2,fma"))) void micro_kernel_avx2(size_t kc, const double *a,
+                                                            const double *b, double *c,
+                                                            size_t ldc)
+{
+    __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+    __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+    __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+    __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+    __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+    __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+
+    for (size_t p = 0; p < kc; p++) {
+        const __m256d b0 = _mm256_loadu_pd(b);
+        const __m256d b1 = _mm256_loadu_pd(b + 4);
+        __m256d ai;
+
+        ai = _mm256_broadcast_sd(a + 0);
+        c00 = _mm256_fmadd_pd(ai, b0, c00);
+        c01 = _mm256_fmadd_pd(ai, b1, c01);
+        ai = _mm256_broadcast_sd(a + 1);
+        c10 = _mm256_fmadd_pd(ai, b0, c10);
+        c11 = _mm256_fmadd_pd(ai, b1, c11);
+        ai = _mm256_broadcast_sd(a + 2);
+        c20 = _mm256_fmadd_pd(ai, b0, c20);
+        c21 = _mm256_fmadd_pd(ai, b1, c21);
+        ai = _mm256_broadcast_sd(a + 3);
+        c30 = _mm256_fmadd_pd(ai, b0, c30);
+        c31 = _mm256_fmadd_pd(ai, b1, c31);
+        ai = _mm256_broadcast_sd(a + 4);
+        c40 = _mm256_fmadd_pd(ai, b0, c40);
+        c41 = _mm256_fmadd_pd(ai, b1, c41);
+        ai = _mm256_broadcast_sd(a + 5);
+        c50 = _mm256_fmadd_pd(ai, b0, c50);
+        c51 = _mm256_fmadd_pd(ai, b1, c51);
+
+        a += 6;
+        b += 8;
+    }
+
+    const __m256d acc[6][2] = {{c00, c01}, {c10, c11}, {c20, c21},
+                               {c30, c31}, {c40, c41}, {c50, c51}};
+    for (size_t i = 0; i < 6; i++) {
+        double *ci = c + i * ldc;
+        _mm256_storeu_pd(ci, _mm256_add_pd(_mm256_loadu_pd(ci), acc[i][0]));
+        _mm256_storeu_pd(ci + 4, _mm256_add_pd(_mm256_loadu_pd(ci + 4), acc[i][1]));
+    }
+}
+
+/*!
+ * @brief Micro-kernel AVX2/FMA 6x16 para float (12 acumuladores de 256 bits).
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+__attribute__((target("avx2,fma"))) void micro_kernel_avx2(size_t kc, const float *a,
+                                                            const float *b, float *c,
+                                                            size_t ldc)
+{
+    __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+    __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+    __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+    __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+    __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+    __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+    for (size_t p = 0; p < kc; p++) {
+        const __m256 b0 = _mm256_loadu_ps(b);
+        const __m256 b1 = _mm256_loadu_ps(b + 8);
+        __m256 ai;
+
+        ai = _mm256_broadcast_ss(a + 0);
+        c00 = _mm256_fmadd_ps(ai, b0, c00);
+        c01 = _mm256_fmadd_ps(ai, b1, c01);
+        ai = _mm256_broadcast_ss(a + 1);
+        c10 = _mm256_fmadd_ps(ai, b0, c10);
+        c11 = _mm256_fmadd_ps(ai, b1, c11);
+        ai = _mm256_broadcast_ss(a + 2);
+        c20 = _mm256_fmadd_ps(ai, b0, c20);
+        c21 = _mm256_fmadd_ps(ai, b1, c21);
+        ai = _mm256_broadcast_ss(a + 3);
+        c30 = _mm256_fmadd_ps(ai, b0, c30);
+        c31 = _mm256_fmadd_ps(ai, b1, c31);
+        ai = _mm256_broadcast_ss(a + 4);
+        c40 = _mm256_fmadd_ps(ai, b0, c40);
+        c41 = _mm256_fmadd_ps(ai, b1, c41);
+        ai = _mm256_broadcast_ss(a + 5);
+        c50 = _mm256_fmadd_ps(ai, b0, c50);
+        c51 = _mm256_fmadd_ps(ai, b1, c51);
+
+        a += 6;
+        b += 16;
+    }
+
+    const __m256 acc[6][2] = {{c00, c01}, {c10, c11}, {c20, c21},
+                              {c30, c31}, {c40, c41}, {c50, c51}};
+    for (size_t i = 0; i < 6; i++) {
+        float *ci = c + i * ldc;
+        _mm256_storeu_ps(ci, _mm256_add_ps(_mm256_loadu_ps(ci), acc[i][0]));
+        _mm256_storeu_ps(ci + 8, _mm256_add_ps(_mm256_loadu_ps(ci + 8), acc[i][1]));
+    }
+}
+#endif
+
+/*!
+ * @brief Indica se os micro-kernels AVX2/FMA podem ser usados neste processador.
+ */
+bool usar_avx2()
+{
+#ifdef IFNUM_GEMM_X86
+    return recursos_cpu().avx2 && recursos_cpu().fma;
+#else
+    return false;
+#endif
+}
+} // namespace
+
+/*!
+ * @brief GEMM para float: C = alfa * A * B + beta * C.
+ *
+ * Usa o micro-kernel AVX2/FMA 6x16 quando o processador suporta, ou o micro-kernel
+ * portável 4x16 caso contrário.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+void gemm(size_t m, size_t n, size_t k, float alfa, const float *A, size_t lda, const float *B,
+          size_t ldb, float beta, float *C, size_t ldc)
+{
+#ifdef IFNUM_GEMM_X86
+    if (usar_avx2()) {
+        gemm_blocado<float, 6, 16>(m, n, k, alfa, A, lda, B, ldb, beta, C, ldc,
+                                   micro_kernel_avx2, MC_FLOAT, KC_FLOAT, NC_FLOAT);
+        return;
+    }
+#endif
+    gemm_blocado<float, 4, 16>(m, n, k, alfa, A, lda, B, ldb, beta, C, ldc,
+                               micro_kernel_generico<float, 4, 16>, MC_FLOAT, KC_FLOAT,
+                               NC_FLOAT);
+}
+
+/*!
+ * @brief GEMM para double: C = alfa * A * B + beta * C.
+ *
+ * Usa o micro-kernel AVX2/FMA 6x8 quando o processador suporta, ou o micro-kernel
+ * portável 4x8 caso contrário.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+void gemm(size_t m, size_t n, size_t k, double alfa, const double *A, size_t lda,
+          const double *B, size_t ldb, double beta, double *C, size_t ldc)
+{
+#ifdef IFNUM_GEMM_X86
+    if (usar_avx2()) {
+        gemm_blocado<double, 6, 8>(m, n, k, alfa, A, lda, B, ldb, beta, C, ldc,
+                                   micro_kernel_avx2, MC_DOUBLE, KC_DOUBLE, NC_DOUBLE);
+        return;
+    }
+#endif
+    gemm_blocado<double, 4, 8>(m, n, k, alfa, A, lda, B, ldb, beta, C, ldc,
+                               micro_kernel_generico<double, 4, 8>, MC_DOUBLE, KC_DOUBLE,
+                               NC_DOUBLE);
+}
+
+} // namespace ifnum::detail
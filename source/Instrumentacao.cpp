@@ -0,0 +1,320 @@
+/*!
+ * @file Instrumentacao.cpp
+ * @brief Contadores por thread e agregação da instrumentação (ver Instrumentacao.hpp).
+ */
+
+#include "Instrumentacao.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+
+namespace ifnum::debug
+{
+namespace
+{
+constexpr size_t maximo_pontos = 256;
+constexpr size_t sem_ponto = maximo_pontos; // contadores fora de qualquer cronômetro
+
+/*!
+ * @brief Contador escrito só pela thread dona.
+ *
+ * A escrita é um load + store relaxados (sem lock), e a leitura por outra thread em
+ * instantaneo() vê um valor recente, sem rasgos.
+ */
+struct Contador {
+    std::atomic<uint64_t> valor{0};
+
+    void somar(uint64_t x)
+    {
+        valor.store(valor.load(std::memory_order_relaxed) + x, std::memory_order_relaxed);
+    }
+    void maximo(uint64_t x)
+    {
+        if (x > valor.load(std::memory_order_relaxed))
+            valor.store(x, std::memory_order_relaxed);
+    }
+    uint64_t ler() const
+    {
+        return valor.load(std::memory_order_relaxed);
+    }
+    void zerar()
+    {
+        valor.store(0, std::memory_order_relaxed);
+    }
+};
+
+struct Contadores {
+    Contador chamadas, ns_total, ns_max, flops, bytes, alocacoes, bytes_alocados, copias,
+        bytes_copiados;
+
+    void acumular_em(Registro &r) const
+    {
+        r.chamadas += chamadas.ler();
+        r.ns_total += ns_total.ler();
+        r.ns_max = std::max(r.ns_max, ns_max.ler());
+        r.flops += flops.ler();
+        r.bytes += bytes.ler();
+        r.alocacoes += alocacoes.ler();
+        r.bytes_alocados += bytes_alocados.ler();
+        r.copias += copias.ler();
+        r.bytes_copiados += bytes_copiados.ler();
+    }
+    void zerar()
+    {
+        for (Contador *c : {&chamadas, &ns_total, &ns_max, &flops, &bytes, &alocacoes,
+                            &bytes_alocados, &copias, &bytes_copiados})
+            c->zerar();
+    }
+};
+
+using Tabela = std::array<Contadores, maximo_pontos + 1>;
+
+struct DadosThread;
+
+/*!
+ * @brief Estado global: nomes dos pontos, threads vivas e totais de threads encerradas.
+ *
+ * Alocado e nunca destruído, para continuar válido enquanto as threads (inclusive a
+ * principal) encerram.
+ */
+struct Registros {
+    std::mutex trava;
+    std::vector<std::string> nomes;
+    std::vector<DadosThread *> ativas;
+    std::vector<Registro> encerradas = std::vector<Registro>(maximo_pontos + 1);
+};
+
+Registros &registros()
+{
+    static Registros *r = new Registros;
+    return *r;
+}
+
+struct DadosThread {
+    Tabela tabela;
+    size_t atual = sem_ponto;
+
+    DadosThread()
+    {
+        Registros &r = registros();
+        std::lock_guard<std::mutex> guarda(r.trava);
+        r.ativas.push_back(this);
+    }
+
+    ~DadosThread()
+    {
+        Registros &r = registros();
+        std::lock_guard<std::mutex> guarda(r.trava);
+        for (size_t i = 0; i <= maximo_pontos; i++)
+            tabela[i].acumular_em(r.encerradas[i]);
+        r.ativas.erase(std::find(r.ativas.begin(), r.ativas.end(), this));
+    }
+};
+
+DadosThread &dados()
+{
+    thread_local DadosThread d;
+    return d;
+}
+
+uint64_t agora_ns()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+void escrever_registro(std::string &saida, const Registro &r)
+{
+    char linha[640];
+    std::string nome;
+    for (char c : r.nome) {
+        if (c == '"' || c == '\\')
+            nome += '\\';
+        nome += c;
+    }
+    const double ns_medio = r.chamadas ? double(r.ns_total) / double(r.chamadas) : 0.0;
+    const double gflops = r.ns_total ? double(r.flops) / double(r.ns_total) : 0.0;
+    std::snprintf(linha, sizeof(linha),
+                  "{\"nome\": \"%s\", \"chamadas\": %llu, \"ns_total\": %llu, "
+                  "\"ns_medio\": %.1f, \"ns_max\": %llu, \"flops\": %llu, \"gflops\": %.4g, "
+                  "\"bytes\": %llu, \"alocacoes\": %llu, \"bytes_alocados\": %llu, "
+                  "\"copias\": %llu, \"bytes_copiados\": %llu}",
+                  nome.c_str(), (unsigned long long)r.chamadas, (unsigned long long)r.ns_total,
+                  ns_medio, (unsigned long long)r.ns_max, (unsigned long long)r.flops, gflops,
+                  (unsigned long long)r.bytes, (unsigned long long)r.alocacoes,
+                  (unsigned long long)r.bytes_alocados, (unsigned long long)r.copias,
+                  (unsigned long long)r.bytes_copiados);
+    saida += linha;
+}
+} // namespace
+
+/*!
+ * @brief Registra o ponto (ou reaproveita o de mesmo nome).
+ *
+ * @param nome Nome exibido no instantâneo.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+Ponto::Ponto(const char *nome)
+{
+    Registros &r = registros();
+    std::lock_guard<std::mutex> guarda(r.trava);
+    for (id_ = 0; id_ < r.nomes.size(); id_++)
+        if (r.nomes[id_] == nome)
+            return;
+    if (r.nomes.size() < maximo_pontos)
+        r.nomes.push_back(nome);
+    else
+        id_ = sem_ponto;
+}
+
+size_t Ponto::id() const
+{
+    return id_;
+}
+
+/*!
+ * @brief Inicia a medição e torna o ponto o destino dos contadores desta thread.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+Cronometro::Cronometro(const Ponto &ponto) : id_(ponto.id())
+{
+    DadosThread &d = dados();
+    anterior_ = d.atual;
+    d.atual = id_;
+    inicio_ = agora_ns();
+}
+
+/*!
+ * @brief Encerra a medição, acumula o tempo e restaura o ponto anterior.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+Cronometro::~Cronometro()
+{
+    const uint64_t duracao = agora_ns() - inicio_;
+    DadosThread &d = dados();
+    Contadores &c = d.tabela[id_];
+    c.chamadas.somar(1);
+    c.ns_total.somar(duracao);
+    c.ns_max.maximo(duracao);
+    d.atual = anterior_;
+}
+
+/*! @brief Soma operações de ponto flutuante ao ponto ativo desta thread. */
+void contar_flops(uint64_t quantidade)
+{
+    DadosThread &d = dados();
+    d.tabela[d.atual].flops.somar(quantidade);
+}
+
+/*! @brief Soma bytes lidos/escritos ao ponto ativo desta thread. */
+void contar_bytes(uint64_t quantidade)
+{
+    DadosThread &d = dados();
+    d.tabela[d.atual].bytes.somar(quantidade);
+}
+
+/*! @brief Conta uma alocação de `bytes` no ponto ativo desta thread. */
+void contar_alocacao(uint64_t bytes)
+{
+    DadosThread &d = dados();
+    d.tabela[d.atual].alocacoes.somar(1);
+    d.tabela[d.atual].bytes_alocados.somar(bytes);
+}
+
+/*! @brief Conta uma cópia de `bytes` no ponto ativo desta thread. */
+void contar_copia(uint64_t bytes)
+{
+    DadosThread &d = dados();
+    d.tabela[d.atual].copias.somar(1);
+    d.tabela[d.atual].bytes_copiados.somar(bytes);
+}
+
+/*!
+ * @brief Soma os contadores de todas as threads (vivas e encerradas).
+ *
+ * Pode ser chamada a qualquer momento; medições em andamento em outras threads podem
+ * aparecer parcialmente.
+ *
+ * @return Pontos com atividade e o total.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+Instantaneo instantaneo()
+{
+    Registros &r = registros();
+    std::lock_guard<std::mutex> guarda(r.trava);
+
+    std::vector<Registro> soma = r.encerradas;
+    for (const DadosThread *d : r.ativas)
+        for (size_t i = 0; i <= maximo_pontos; i++)
+            d->tabela[i].acumular_em(soma[i]);
+
+    Instantaneo resultado;
+    resultado.total.nome = "total";
+    for (size_t i = 0; i <= maximo_pontos; i++) {
+        Registro &p = soma[i];
+        if (!p.chamadas && !p.flops && !p.bytes && !p.alocacoes && !p.copias)
+            continue;
+        p.nome = i < r.nomes.size() ? r.nomes[i] : "(fora de medições)";
+        resultado.total.flops += p.flops;
+        resultado.total.bytes += p.bytes;
+        resultado.total.alocacoes += p.alocacoes;
+        resultado.total.bytes_alocados += p.bytes_alocados;
+        resultado.total.copias += p.copias;
+        resultado.total.bytes_copiados += p.bytes_copiados;
+        resultado.pontos.push_back(p);
+    }
+    return resultado;
+}
+
+/*!
+ * @brief Zera os contadores de todas as threads.
+ *
+ * Deve ser chamada com a biblioteca ociosa: contagens simultâneas em outras threads podem
+ * se perder.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void zerar()
+{
+    Registros &r = registros();
+    std::lock_guard<std::mutex> guarda(r.trava);
+    for (Registro &e : r.encerradas)
+        e = Registro{};
+    for (DadosThread *d : r.ativas)
+        for (Contadores &c : d->tabela)
+            c.zerar();
+}
+
+/*!
+ * @brief Serializa o instantâneo em JSON: {"total": {...}, "pontos": [{...}, ...]}.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+std::string Instantaneo::json() const
+{
+    std::string saida = "{\n  \"total\": ";
+    escrever_registro(saida, total);
+    saida += ",\n  \"pontos\": [";
+    for (size_t i = 0; i < pontos.size(); i++) {
+        saida += i ? ",\n    " : "\n    ";
+        escrever_registro(saida, pontos[i]);
+    }
+    saida += pontos.empty() ? "]\n}\n" : "\n  ]\n}\n";
+    return saida;
+}
+
+} // namespace ifnum::debug
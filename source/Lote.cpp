@@ -0,0 +1,299 @@
+/*!
+ * @file Lote.cpp
+ * @brief Kernels de resolver_lote para `float` e `double`, com variante AVX2.
+ *
+ * Cada bloco de L sistemas (uma linha de cache por coeficiente: 8 doubles ou 16 floats) é
+ * copiado para a pilha e eliminado com todos os laços internos sobre as L faixas, que o
+ * compilador vetoriza. O pivotamento parcial é feito faixa a faixa sem desvios: a linha do
+ * pivô de cada sistema é escolhida e trocada por seleção. As ordens 1 a 8 são instanciadas
+ * com a ordem fixa (laços desenrolados); ordens maiores usam a mesma rotina com a ordem em
+ * tempo de execução. Como em Gemm.cpp, a variante AVX2 é escolhida em tempo de execução.
+ */
+
+#include "Lote.hpp"
+#include "Cpu.hpp"
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define IFNUM_LOTE_X86 1
+#endif
+
+namespace ifnum::detail
+{
+namespace
+{
+/*! @brief Número máximo de ordem com kernel desenrolado. */
+constexpr size_t ORDEM_FIXA = 8;
+
+/*!
+ * @brief Resolve `quantos` (<= L) sistemas consecutivos do lote.
+ *
+ * @tparam N Ordem fixa, ou 0 para usar `ordem` (com `trabalho` de (n² + 2n) * L elementos).
+ * @return Quantos dos sistemas são singulares.
+ */
+template <typename T, size_t N, size_t L>
+[[gnu::always_inline]] inline size_t resolver_bloco_(size_t ordem, const T *A, const T *b, T *x,
+                                                   size_t passo, size_t quantos,
+                                                   uint8_t *singular, bool pivotar,
+                                                   T tolerancia, T *trabalho)
+{
+    const size_t n = N ? N : ordem;
+    alignas(64) T local[N ? (N * N + 2 * N) * L : 1];
+    T *a = N ? local : trabalho;
+    T *y = a + n * n * L; // lados direitos
+    T *inv = y + n * L;   // inversos dos pivôs
+    alignas(64) T falhou[L];
+
+    // Carga. Faixas além de `quantos` recebem a identidade, para não gerar falsos singulares.
+    // Há um fluxo de leitura por coeficiente, mais do que o prefetcher de hardware acompanha:
+    // o próximo bloco é pedido explicitamente.
+    if (quantos == L) {
+        for (size_t ij = 0; ij < n * n; ij++) {
+            __builtin_prefetch(A + ij * passo + L);
+            std::memcpy(a + ij * L, A + ij * passo, L * sizeof(T)); // tamanho constante
+        }
+        for (size_t i = 0; i < n; i++) {
+            __builtin_prefetch(b + i * passo + L);
+            std::memcpy(y + i * L, b + i * passo, L * sizeof(T));
+        }
+    } else {
+        for (size_t ij = 0; ij < n * n; ij++) {
+            T *destino = a + ij * L;
+            std::memcpy(destino, A + ij * passo, quantos * sizeof(T));
+            const T padrao = ij % (n + 1) == 0 ? T(1) : T(0);
+            for (size_t l = quantos; l < L; l++)
+                destino[l] = padrao;
+        }
+        for (size_t i = 0; i < n; i++) {
+            std::memcpy(y + i * L, b + i * passo, quantos * sizeof(T));
+            for (size_t l = quantos; l < L; l++)
+                y[i * L + l] = T(0);
+        }
+    }
+    for (size_t l = 0; l < L; l++)
+        falhou[l] = T(0);
+
+    for (size_t k = 0; k < n; k++) {
+        T *linha_k = a + k * n * L;
+        if (pivotar && k + 1 < n) {
+            alignas(64) T maior[L], pivo[L];
+            for (size_t l = 0; l < L; l++) {
+                maior[l] = std::abs(linha_k[k * L + l]);
+                pivo[l] = T(k);
+            }
+            for (size_t r = k + 1; r < n; r++) {
+                const T *ar = a + (r * n + k) * L;
+                for (size_t l = 0; l < L; l++) {
+                    const T v = std::abs(ar[l]);
+                    const bool troca = v > maior[l];
+                    maior[l] = troca ? v : maior[l];
+                    pivo[l] = troca ? T(r) : pivo[l];
+                }
+            }
+            for (size_t r = k + 1; r < n; r++) {
+                // Trocas só para as linhas escolhidas por alguma faixa (raras em matrizes
+                // diagonalmente dominantes)
+                bool alguma = false;
+                for (size_t l = 0; l < L; l++)
+                    alguma |= pivo[l] == T(r);
+                if (!alguma)
+                    continue;
+
+                T *linha_r = a + r * n * L;
+                for (size_t j = k; j < n; j++) {
+                    for (size_t l = 0; l < L; l++) {
+                        const bool troca = pivo[l] == T(r);
+                        const T u = linha_k[j * L + l], v = linha_r[j * L + l];
+                        linha_k[j * L + l] = troca ? v : u;
+                        linha_r[j * L + l] = troca ? u : v;
+                    }
+                }
+                for (size_t l = 0; l < L; l++) {
+                    const bool troca = pivo[l] == T(r);
+                    const T u = y[k * L + l], v = y[r * L + l];
+                    y[k * L + l] = troca ? v : u;
+                    y[r * L + l] = troca ? u : v;
+                }
+            }
+        }
+
+        // !(|p| > tol) também captura NaN
+        for (size_t l = 0; l < L; l++) {
+            const T p = linha_k[k * L + l];
+            const bool ruim = !(std::abs(p) > tolerancia);
+            falhou[l] = ruim ? T(1) : falhou[l];
+            inv[k * L + l] = ruim ? T(0) : T(1) / p;
+        }
+
+        for (size_t r = k + 1; r < n; r++) {
+            T *linha_r = a + r * n * L;
+            alignas(64) T f[L];
+            for (size_t l = 0; l < L; l++)
+                f[l] = linha_r[k * L + l] * inv[k * L + l];
+            for (size_t j = k + 1; j < n; j++) {
+                for (size_t l = 0; l < L; l++)
+                    linha_r[j * L + l] -= f[l] * linha_k[j * L + l];
+            }
+            for (size_t l = 0; l < L; l++)
+                y[r * L + l] -= f[l] * y[k * L + l];
+        }
+    }
+
+    // Substituição regressiva
+    for (size_t k = n; k-- > 0;) {
+        const T *linha_k = a + k * n * L;
+        for (size_t j = k + 1; j < n; j++) {
+            for (size_t l = 0; l < L; l++)
+                y[k * L + l] -= linha_k[j * L + l] * y[j * L + l];
+        }
+        for (size_t l = 0; l < L; l++)
+            y[k * L + l] *= inv[k * L + l];
+    }
+
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+    for (size_t i = 0; i < n; i++) {
+        for (size_t l = 0; l < L; l++)
+            y[i * L + l] = falhou[l] != T(0) ? nan : y[i * L + l];
+        if (quantos == L)
+            std::memcpy(x + i * passo, y + i * L, L * sizeof(T));
+        else
+            std::memcpy(x + i * passo, y + i * L, quantos * sizeof(T));
+    }
+    size_t singulares = 0;
+    for (size_t l = 0; l < quantos; l++) {
+        singulares += falhou[l] != T(0);
+        if (singular)
+            singular[l] = falhou[l] != T(0);
+    }
+    return singulares;
+}
+
+/*!
+ * @brief Resolve os blocos [inicio, fim) do lote com a ordem N fixa (ou 0).
+ */
+template <typename T, size_t N>
+[[gnu::always_inline]] inline size_t resolver_blocos_(size_t ordem, size_t quantidade,
+                                                      size_t passo, const T *A, const T *b,
+                                                      T *x, uint8_t *singular, bool pivotar,
+                                                      T tolerancia, size_t inicio, size_t fim)
+{
+    constexpr size_t L = 64 / sizeof(T);
+    std::vector<T> trabalho(N ? 0 : (ordem * ordem + 2 * ordem) * L);
+    size_t singulares = 0;
+    for (size_t bloco = inicio; bloco < fim; bloco++) {
+        const size_t s = bloco * L;
+        const size_t quantos = quantidade - s < L ? quantidade - s : L;
+        singulares += resolver_bloco_<T, N, L>(ordem, A + s, b + s, x + s, passo, quantos,
+                                               singular ? singular + s : nullptr, pivotar,
+                                               tolerancia, trabalho.data());
+    }
+    return singulares;
+}
+
+template <typename T>
+using KernelLote = size_t (*)(size_t, size_t, size_t, const T *, const T *, T *, uint8_t *, bool,
+                              T, size_t, size_t);
+
+template <typename T, size_t N>
+size_t kernel_padrao(size_t ordem, size_t quantidade, size_t passo, const T *A, const T *b, T *x,
+                     uint8_t *singular, bool pivotar, T tolerancia, size_t inicio, size_t fim)
+{
+    return resolver_blocos_<T, N>(ordem, quantidade, passo, A, b, x, singular, pivotar,
+                                  tolerancia, inicio, fim);
+}
+
+#ifdef IFNUM_LOTE_X86
+template <typename T, size_t N>
+__attribute__((target("avx2"))) size_t kernel_avx2(size_t ordem, size_t quantidade,
+                                                  size_t passo, const T *A, const T *b, T *x,
+                                                  uint8_t *singular, bool pivotar, T tolerancia,
+                                                  size_t inicio, size_t fim)
+{
+    return resolver_blocos_<T, N>(ordem, quantidade, passo, A, b, x, singular, pivotar,
+                                  tolerancia, inicio, fim);
+}
+#endif
+
+template <typename T, size_t... N>
+KernelLote<T> escolher_(size_t ordem, bool avx2, std::index_sequence<N...>)
+{
+    KernelLote<T> kernel = nullptr;
+#ifdef IFNUM_LOTE_X86
+    if (avx2)
+        ((ordem == N ? (void)(kernel = kernel_avx2<T, N>) : (void)0), ...);
+#else
+    (void)avx2;
+#endif
+    if (!kernel)
+        ((ordem == N ? (void)(kernel = kernel_padrao<T, N>) : (void)0), ...);
+    return kernel;
+}
+
+/*!
+ * @brief Kernel para a ordem dada: desenrolado até ORDEM_FIXA, genérico acima.
+ */
+template <typename T>
+KernelLote<T> escolher(size_t ordem)
+{
+#ifdef IFNUM_LOTE_X86
+    const bool avx2 = recursos_cpu().avx2;
+#else
+    const bool avx2 = false;
+#endif
+    // N = 0 só é escolhido para ordens acima de ORDEM_FIXA
+    const size_t chave = ordem > ORDEM_FIXA ? 0 : ordem;
+    return escolher_<T>(chave, avx2, std::make_index_sequence<ORDEM_FIXA + 1>{});
+}
+
+template <typename T>
+size_t resolver_lote_(size_t ordem, size_t quantidade, size_t passo, const T *A, const T *b,
+                      T *x, uint8_t *singular, bool pivotar, T tolerancia)
+{
+    constexpr size_t L = 64 / sizeof(T);
+    if (ordem == 0 || quantidade == 0)
+        return 0;
+
+    const KernelLote<T> kernel = escolher<T>(ordem);
+    const size_t blocos = (quantidade + L - 1) / L;
+    const size_t custo = (2 * ordem * ordem * ordem / 3 + 2 * ordem * ordem + 1) * L;
+
+    std::atomic<size_t> singulares{0};
+    paralelo::para(0, blocos, custo, [&](size_t inicio, size_t fim) {
+        singulares += kernel(ordem, quantidade, passo, A, b, x, singular, pivotar, tolerancia,
+                             inicio, fim);
+    });
+    return singulares;
+}
+} // namespace
+
+/*!
+ * @brief Resolve um lote de sistemas `double` em layout SoA (ver Lote.hpp).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+size_t resolver_lote(size_t ordem, size_t quantidade, size_t passo, const double *A,
+                     const double *b, double *x, uint8_t *singular, bool pivotar,
+                     double tolerancia)
+{
+    return resolver_lote_(ordem, quantidade, passo, A, b, x, singular, pivotar, tolerancia);
+}
+
+/*!
+ * @brief Resolve um lote de sistemas `float` em layout SoA.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+size_t resolver_lote(size_t ordem, size_t quantidade, size_t passo, const float *A,
+                     const float *b, float *x, uint8_t *singular, bool pivotar,
+                     float tolerancia)
+{
+    return resolver_lote_(ordem, quantidade, passo, A, b, x, singular, pivotar, tolerancia);
+}
+
+} // namespace ifnum::detail
@@ -0,0 +1,337 @@
+/*!
+ * @file Paralelo.cpp
+ * @brief Implementação do pool de threads com roubo de tarefas declarado em Paralelo.hpp.
+ *
+ * Cada thread trabalhadora possui sua própria fila (deque). Uma thread consome as tarefas
+ * da sua fila pelo fim e, quando ela esvazia, rouba tarefas do início das filas das
+ * outras. A thread que dispara um trabalho também executa tarefas enquanto espera, o que
+ * permite paralelismo aninhado sem deadlock.
+ */
+
+#include "Paralelo.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ifnum::paralelo
+{
+namespace
+{
+/*! @brief Conjunto de tarefas disparadas por uma mesma chamada a executar(). */
+struct Grupo {
+    std::atomic<size_t> restantes{0};
+    std::mutex mutex_erro;
+    std::exception_ptr erro;
+};
+
+/*! @brief Subintervalo a ser processado por uma thread. */
+struct Tarefa {
+    const std::function<void(size_t, size_t)> *funcao = nullptr;
+    size_t inicio = 0;
+    size_t fim = 0;
+    Grupo *grupo = nullptr;
+};
+
+/*! @brief Fila de tarefas de uma thread trabalhadora. */
+struct Fila {
+    std::mutex mutex;
+    std::deque<Tarefa> tarefas;
+};
+
+/*! @brief Índice da fila da thread atual no pool (-1 fora do pool). */
+thread_local int indice_local = -1;
+
+/*!
+ * @brief Lê uma variável de ambiente numérica, retornando `padrao` se ausente ou inválida.
+ */
+size_t ler_ambiente(const char *nome, size_t padrao)
+{
+    const char *valor = std::getenv(nome);
+    if (valor == nullptr)
+        return padrao;
+
+    try {
+        const long long lido = std::stoll(valor);
+        return lido > 0 ? static_cast<size_t>(lido) : padrao;
+    } catch (const std::exception &) {
+        return padrao;
+    }
+}
+
+size_t threads_padrao()
+{
+    const size_t hw = std::thread::hardware_concurrency();
+    return ler_ambiente("IFNUM_THREADS", hw == 0 ? 1 : hw);
+}
+
+/*!
+ * @class Pool
+ * @brief Pool de threads com filas por thread e roubo de tarefas.
+ *
+ * Um pool com `n` threads cria `n - 1` trabalhadoras; a thread chamadora é a n-ésima.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+class Pool
+{
+  private:
+    size_t threads_;
+    std::vector<std::unique_ptr<Fila>> filas_;
+    std::vector<std::thread> trabalhadoras_;
+    std::atomic<size_t> pendentes_{0};
+    std::atomic<size_t> proxima_fila_{0};
+    std::atomic<bool> parar_{false};
+    std::mutex mutex_sono_;
+    std::condition_variable cv_;
+
+    bool pegar(Tarefa &tarefa, int indice)
+    {
+        const size_t n = filas_.size();
+        if (n == 0)
+            return false;
+
+        // Primeiro a própria fila (LIFO, melhor localidade de cache)...
+        if (indice >= 0) {
+            Fila &propria = *filas_[indice];
+            std::lock_guard<std::mutex> lock(propria.mutex);
+            if (!propria.tarefas.empty()) {
+                tarefa = propria.tarefas.back();
+                propria.tarefas.pop_back();
+                pendentes_.fetch_sub(1);
+                return true;
+            }
+        }
+
+        // ...depois rouba do início das outras filas (FIFO, pedaços maiores e mais antigos).
+        const size_t inicio = indice >= 0 ? static_cast<size_t>(indice) + 1 : 0;
+        for (size_t i = 0; i < n; i++) {
+            Fila &vitima = *filas_[(inicio + i) % n];
+            std::lock_guard<std::mutex> lock(vitima.mutex);
+            if (!vitima.tarefas.empty()) {
+                tarefa = vitima.tarefas.front();
+                vitima.tarefas.pop_front();
+                pendentes_.fetch_sub(1);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static void rodar(const Tarefa &tarefa)
+    {
+        try {
+            (*tarefa.funcao)(tarefa.inicio, tarefa.fim);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(tarefa.grupo->mutex_erro);
+            if (!tarefa.grupo->erro)
+                tarefa.grupo->erro = std::current_exception();
+        }
+        tarefa.grupo->restantes.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    void laco_trabalhadora(int indice)
+    {
+        indice_local = indice;
+        Tarefa tarefa;
+
+        while (true) {
+            if (pegar(tarefa, indice)) {
+                rodar(tarefa);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mutex_sono_);
+            cv_.wait(lock, [this] { return parar_.load() || pendentes_.load() > 0; });
+            if (parar_.load())
+                return;
+        }
+    }
+
+  public:
+    explicit Pool(size_t threads) : threads_(threads == 0 ? 1 : threads)
+    {
+        for (size_t i = 0; i + 1 < threads_; i++)
+            filas_.push_back(std::make_unique<Fila>());
+        for (size_t i = 0; i + 1 < threads_; i++)
+            trabalhadoras_.emplace_back(&Pool::laco_trabalhadora, this, static_cast<int>(i));
+    }
+
+    ~Pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_sono_);
+            parar_.store(true);
+        }
+        cv_.notify_all();
+        for (auto &t : trabalhadoras_)
+            t.join();
+    }
+
+    Pool(const Pool &) = delete;
+    Pool &operator=(const Pool &) = delete;
+
+    size_t threads() const
+    {
+        return threads_;
+    }
+
+    void executar(size_t inicio, size_t fim, size_t partes,
+                  const std::function<void(size_t, size_t)> &funcao)
+    {
+        if (filas_.empty() || partes <= 1) {
+            funcao(inicio, fim);
+            return;
+        }
+
+        Grupo grupo;
+        grupo.restantes.store(partes);
+
+        const size_t n = fim - inicio;
+        const size_t base = n / partes;
+        const size_t resto = n % partes;
+
+        // Threads de fora do pool distribuem as partes entre todas as filas; uma
+        // trabalhadora coloca tudo na própria fila e deixa as demais roubarem.
+        const int indice = indice_local;
+        size_t atual = inicio;
+        for (size_t p = 0; p < partes; p++) {
+            const size_t tamanho = base + (p < resto ? 1 : 0);
+            Tarefa tarefa{&funcao, atual, atual + tamanho, &grupo};
+            atual += tamanho;
+
+            const size_t destino =
+                indice >= 0 ? static_cast<size_t>(indice) : proxima_fila_++ % filas_.size();
+            Fila &fila = *filas_[destino];
+            {
+                std::lock_guard<std::mutex> lock(fila.mutex);
+                fila.tarefas.push_back(tarefa);
+            }
+            pendentes_.fetch_add(1);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_sono_);
+        }
+        cv_.notify_all();
+
+        // A thread chamadora ajuda até que todas as partes terminem.
+        Tarefa tarefa;
+        while (grupo.restantes.load(std::memory_order_acquire) > 0) {
+            if (pegar(tarefa, indice))
+                rodar(tarefa);
+            else
+                std::this_thread::yield();
+        }
+
+        if (grupo.erro)
+            std::rethrow_exception(grupo.erro);
+    }
+};
+
+std::mutex mutex_pool;
+std::unique_ptr<Pool> pool_global;
+std::atomic<size_t> threads_global{0};
+std::atomic<size_t> limiar_global{ler_ambiente("IFNUM_LIMIAR", 1 << 16)};
+
+Pool &pool()
+{
+    std::lock_guard<std::mutex> lock(mutex_pool);
+    if (!pool_global) {
+        pool_global = std::make_unique<Pool>(threads_padrao());
+        threads_global.store(pool_global->threads());
+    }
+    return *pool_global;
+}
+} // namespace
+
+/*!
+ * @brief Define a quantidade de threads usadas pela biblioteca.
+ *
+ * Recria o pool; não deve ser chamada enquanto houver trabalho paralelo em andamento.
+ *
+ * @param quantidade Número de threads (incluindo a chamadora). Zero usa o valor padrão
+ *        (`IFNUM_THREADS` ou o número de núcleos).
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+void definir_threads(size_t quantidade)
+{
+    std::lock_guard<std::mutex> lock(mutex_pool);
+    pool_global.reset();
+    pool_global = std::make_unique<Pool>(quantidade == 0 ? threads_padrao() : quantidade);
+    threads_global.store(pool_global->threads());
+}
+
+/*!
+ * @brief Retorna a quantidade de threads usadas pela biblioteca.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+size_t threads()
+{
+    const size_t atual = threads_global.load();
+    return atual != 0 ? atual : pool().threads();
+}
+
+/*!
+ * @brief Define o custo mínimo (em operações estimadas) para que um trabalho seja paralelizado.
+ *
+ * @param custo Novo limiar.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+void definir_limiar(size_t custo)
+{
+    limiar_global.store(custo);
+}
+
+/*!
+ * @brief Retorna o limiar de paralelização atual.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+size_t limiar()
+{
+    return limiar_global.load();
+}
+
+/*!
+ * @brief Divide [inicio, fim) em `partes` subintervalos e os executa no pool.
+ *
+ * Bloqueia até que todas as partes terminem. Se alguma parte lançar uma exceção,
+ * a primeira delas é relançada na thread chamadora.
+ *
+ * @param inicio Primeiro índice.
+ * @param fim Índice após o último.
+ * @param partes Quantidade de subintervalos.
+ * @param tarefa Função chamada com cada subintervalo.
+ *
+ * @author Samuel Veras
+ * @date 16/10/2026
+ */
+void executar(size_t inicio, size_t fim, size_t partes,
+              const std::function<void(size_t, size_t)> &tarefa)
+{
+    if (fim <= inicio)
+        return;
+
+    if (partes > fim - inicio)
+        partes = fim - inicio;
+
+    pool().executar(inicio, fim, partes, tarefa);
+}
+
+} // namespace ifnum::paralelo
@@ -0,0 +1,660 @@
+/*!
+ * @file Servico.cpp
+ * @brief Fila, despachantes e execução em lote do serviço assíncrono (ver Servico.hpp).
+ */
+
+#include "Servico.hpp"
+#include "AlgebraLinear.hpp"
+#include "Cordic.hpp"
+#include "Instrumentacao.hpp"
+#include "Lote.hpp"
+#include "Paralelo.hpp"
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+namespace ifnum
+{
+namespace
+{
+using Relogio = std::chrono::steady_clock;
+
+/*! @brief Maior ordem de sistema enviada a resolver_lote (a de seus kernels especializados). */
+constexpr size_t ORDEM_LOTE = 8;
+
+enum class Operacao { multiplicar, resolver, seno, cosseno };
+
+/*!
+ * @brief Operação e dimensões de um pedido; só pedidos de mesmo formato entram no mesmo lote.
+ *
+ * Para multiplicar, A é m x k e B é k x n; para resolver, A é m x m e b é m x n. Senos e
+ * cossenos de qualquer quantidade de ângulos têm o mesmo formato.
+ */
+struct Formato {
+    Operacao operacao;
+    size_t m = 0;
+    size_t k = 0;
+    size_t n = 0;
+
+    bool operator==(const Formato &outro) const
+    {
+        return operacao == outro.operacao && m == outro.m && k == outro.k && n == outro.n;
+    }
+};
+
+/*! @brief Pedido na fila: operandos, função de conclusão e instante de chegada. */
+struct Pedido {
+    Formato formato;
+    Relogio::time_point chegada;
+    std::optional<Matriz<double>> A; //!< multiplicar e resolver
+    std::optional<Matriz<double>> B;
+    std::vector<double> valores; //!< seno e cosseno (o resultado é escrito no lugar)
+    Conclusao<Matriz<double>> concluir_matriz;
+    Conclusao<std::vector<double>> concluir_vetor;
+    bool concluido = false; //!< A função de conclusão já foi chamada.
+};
+
+uint64_t nanossegundos(Relogio::duration d)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+}
+
+/*! @brief Função de conclusão que cumpre uma std::promise. */
+template <typename R>
+Conclusao<R> cumprir(std::shared_ptr<std::promise<R>> promessa)
+{
+    return [promessa = std::move(promessa)](R *resultado, std::exception_ptr erro) {
+        if (resultado)
+            promessa->set_value(std::move(*resultado));
+        else
+            promessa->set_exception(erro);
+    };
+}
+
+/*!
+ * @brief Chama a função de conclusão de um pedido.
+ *
+ * Uma exceção lançada pela função do usuário é descartada, para não derrubar o despachante.
+ */
+template <typename R>
+void concluir(const Conclusao<R> &funcao, R *resultado, std::exception_ptr erro)
+{
+    if (!funcao)
+        return;
+    try {
+        funcao(resultado, erro);
+    } catch (...) {
+    }
+}
+
+/*!
+ * @brief Chama a função de conclusão do pedido e o marca como concluído.
+ */
+void concluir_pedido(Pedido &p, Matriz<double> *resultado, std::exception_ptr erro)
+{
+    p.concluido = true;
+    concluir(p.concluir_matriz, resultado, erro);
+}
+
+void concluir_pedido(Pedido &p, std::vector<double> *resultado, std::exception_ptr erro)
+{
+    p.concluido = true;
+    concluir(p.concluir_vetor, resultado, erro);
+}
+
+/*!
+ * @brief Resolve no lote SIMD os sistemas de ordem até ORDEM_LOTE com um lado direito.
+ *
+ * O kernel do lote arredonda de outro modo que LU<double>: um sistema singular pode chegar a
+ * um pivô minúsculo em vez de zero. Cada sistema é escalado por uma potência de 2 (exata)
+ * para que max |a_ij| fique em [1, 2), e pivôs até n ε 2ⁿ⁻¹ (o pior crescimento dos pivôs)
+ * marcam o sistema; os marcados são refeitos por ifnum::resolverLU, que decide, como para as
+ * ordens maiores, entre a solução e "Matriz singular".
+ */
+void resolver_pequenos(std::vector<Pedido> &lote, size_t ordem,
+                       std::vector<std::optional<Matriz<double>>> &resultados,
+                       std::vector<std::exception_ptr> &erros)
+{
+    const size_t q = lote.size();
+    LoteSistemas<double> sistemas(ordem, q);
+    for (size_t s = 0; s < q; s++) {
+        const Matriz<double> &A = *lote[s].A;
+        sistemas.definir(s, A, *lote[s].B);
+
+        double maximo = 0;
+        for (size_t i = 0; i < ordem; i++)
+            for (size_t j = 0; j < ordem; j++)
+                maximo = std::max(maximo, std::abs(A.elemento(i, j)));
+        if (!std::isnormal(maximo))
+            continue;
+        const double escala = std::ldexp(1.0, -std::ilogb(maximo));
+        for (size_t i = 0; i < ordem; i++) {
+            for (size_t j = 0; j < ordem; j++)
+                sistemas.a(s, i, j) *= escala;
+            sistemas.b(s, i) *= escala;
+        }
+    }
+
+    const double tolerancia = static_cast<double>(ordem) *
+                              std::numeric_limits<double>::epsilon() *
+                              std::ldexp(1.0, static_cast<int>(ordem) - 1);
+    sistemas.resolver(true, tolerancia);
+    for (size_t s = 0; s < q; s++) {
+        try {
+            if (sistemas.singular(s))
+                resultados[s].emplace(ifnum::resolverLU(*lote[s].A, *lote[s].B));
+            else
+                resultados[s].emplace(sistemas.solucao(s));
+        } catch (...) {
+            erros[s] = std::current_exception();
+        }
+    }
+}
+
+/*!
+ * @brief Executa os pedidos de um lote (todos de mesmo formato) e chama suas conclusões.
+ */
+void executar_pedidos(std::vector<Pedido> &lote)
+{
+    const Formato formato = lote.front().formato;
+    const size_t q = lote.size();
+
+    if (formato.operacao == Operacao::seno || formato.operacao == Operacao::cosseno) {
+        size_t total = 0;
+        for (const Pedido &p : lote)
+            total += p.valores.size();
+        std::vector<double> angulos;
+        angulos.reserve(total);
+        for (const Pedido &p : lote)
+            angulos.insert(angulos.end(), p.valores.begin(), p.valores.end());
+
+        if (formato.operacao == Operacao::seno)
+            cordic::sin(angulos.data(), angulos.data(), total);
+        else
+            cordic::cos(angulos.data(), angulos.data(), total);
+
+        size_t inicio = 0;
+        for (Pedido &p : lote) {
+            std::copy_n(angulos.begin() + inicio, p.valores.size(), p.valores.begin());
+            inicio += p.valores.size();
+            concluir_pedido(p, &p.valores, nullptr);
+        }
+        return;
+    }
+
+    std::vector<std::optional<Matriz<double>>> resultados(q);
+    std::vector<std::exception_ptr> erros(q);
+
+    if (formato.operacao == Operacao::resolver && formato.m <= ORDEM_LOTE && formato.n == 1) {
+        resolver_pequenos(lote, formato.m, resultados, erros);
+    } else {
+        const bool produto = formato.operacao == Operacao::multiplicar;
+        const size_t custo = produto ? 2 * formato.m * formato.k * formato.n
+                                     : formato.m * formato.m * (formato.m + 2 * formato.n);
+        paralelo::para(0, q, custo, [&](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++) {
+                try {
+                    if (produto)
+                        resultados[i].emplace(*lote[i].A * *lote[i].B);
+                    else
+                        resultados[i].emplace(ifnum::resolverLU(*lote[i].A, *lote[i].B));
+                } catch (...) {
+                    erros[i] = std::current_exception();
+                }
+            }
+        });
+    }
+
+    for (size_t i = 0; i < q; i++)
+        concluir_pedido(lote[i], resultados[i] ? &*resultados[i] : nullptr, erros[i]);
+}
+
+/*!
+ * @brief Executa um lote sem deixar exceções escaparem para o despachante.
+ *
+ * Um erro fora do cálculo de um pedido (alocação dos vetores do lote, montagem do lote de
+ * sistemas) é entregue a todos os pedidos do lote que ainda não foram concluídos.
+ */
+void executar_lote(std::vector<Pedido> &lote)
+{
+    IFNUM_MEDIR("ServicoCalculo (lote)");
+    try {
+        executar_pedidos(lote);
+    } catch (...) {
+        const std::exception_ptr erro = std::current_exception();
+        for (Pedido &p : lote) {
+            if (p.concluido)
+                continue;
+            if (p.formato.operacao == Operacao::seno || p.formato.operacao == Operacao::cosseno)
+                concluir_pedido(p, static_cast<std::vector<double> *>(nullptr), erro);
+            else
+                concluir_pedido(p, static_cast<Matriz<double> *>(nullptr), erro);
+        }
+    }
+}
+} // namespace
+
+/*!
+ * @brief Estado do serviço: fila de pedidos, despachantes e estatísticas, sob um único mutex.
+ */
+struct ServicoCalculo::Implementacao {
+    ConfiguracaoServico configuracao;
+    mutable std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<Pedido> fila;
+    std::vector<std::pair<Formato, size_t>> pendentes; //!< Pedidos na fila por formato
+    EstatisticasServico estatisticas;
+    bool parar = false;
+    std::vector<std::thread> despachantes;
+
+    explicit Implementacao(const ConfiguracaoServico &c) : configuracao(c)
+    {
+        configuracao.lote_maximo = std::max<size_t>(configuracao.lote_maximo, 1);
+        configuracao.despachantes = std::max<size_t>(configuracao.despachantes, 1);
+        for (size_t i = 0; i < configuracao.despachantes; i++)
+            despachantes.emplace_back(&Implementacao::laco, this);
+    }
+
+    /*! @brief Contador de pedidos na fila do formato dado (criado, zerado, se não existir). */
+    size_t &pendentes_de(const Formato &formato)
+    {
+        for (auto &[f, quantidade] : pendentes)
+            if (f == formato)
+                return quantidade;
+        return pendentes.emplace_back(formato, 0).second;
+    }
+
+    /*!
+     * @brief Põe o pedido na fila e acorda um despachante se a fila estava vazia ou se o
+     *        formato do pedido completou um lote; nos demais casos, os despachantes já
+     *        esperam pelo prazo do pedido mais antigo.
+     */
+    void enfileirar(Pedido pedido)
+    {
+        bool acordar;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (parar)
+                throw std::runtime_error("Serviço encerrado.");
+            pedido.chegada = Relogio::now();
+            const size_t quantidade = ++pendentes_de(pedido.formato);
+            fila.push_back(std::move(pedido));
+            acordar = fila.size() == 1 || quantidade == configuracao.lote_maximo;
+            estatisticas.pedidos++;
+            estatisticas.fila = fila.size();
+            estatisticas.fila_maxima = std::max(estatisticas.fila_maxima, fila.size());
+        }
+        if (acordar)
+            cv.notify_one();
+    }
+
+    /*! @brief Retira da fila até lote_maximo pedidos do formato dado, na ordem de chegada. */
+    std::vector<Pedido> extrair(const Formato &formato)
+    {
+        std::vector<Pedido> lote;
+        auto destino = fila.begin();
+        auto it = fila.begin();
+        for (; it != fila.end() && lote.size() < configuracao.lote_maximo; ++it) {
+            if (it->formato == formato) {
+                lote.push_back(std::move(*it));
+            } else {
+                if (destino != it)
+                    *destino = std::move(*it);
+                ++destino;
+            }
+        }
+        fila.erase(destino, it);
+
+        const auto p = std::find_if(pendentes.begin(), pendentes.end(),
+                                    [&](const auto &e) { return e.first == formato; });
+        p->second -= lote.size();
+        if (p->second == 0)
+            pendentes.erase(p);
+        return lote;
+    }
+
+    void laco()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            if (fila.empty()) {
+                if (parar)
+                    return;
+                cv.wait(lock);
+                continue;
+            }
+
+            // Um formato com lote completo sai na hora; senão, espera por mais pedidos do
+            // formato do mais antigo até o prazo dele. Ao acordar, reavalia desde o início,
+            // pois outro despachante pode ter levado o lote.
+            Formato formato = fila.front().formato;
+            const auto completo =
+                std::find_if(pendentes.begin(), pendentes.end(), [&](const auto &p) {
+                    return p.second >= configuracao.lote_maximo;
+                });
+            if (completo != pendentes.end()) {
+                formato = completo->first;
+            } else {
+                const Relogio::time_point prazo = fila.front().chegada + configuracao.espera_maxima;
+                if (!parar && Relogio::now() < prazo) {
+                    cv.wait_until(lock, prazo);
+                    continue;
+                }
+            }
+
+            std::vector<Pedido> lote = extrair(formato);
+            estatisticas.fila = fila.size();
+            if (!fila.empty())
+                cv.notify_one(); // outro despachante pode cuidar do restante
+            const Relogio::time_point inicio = Relogio::now();
+            lock.unlock();
+
+            executar_lote(lote);
+
+            const Relogio::time_point fim = Relogio::now();
+            lock.lock();
+            estatisticas.lotes++;
+            estatisticas.concluidos += lote.size();
+            for (const Pedido &p : lote) {
+                const uint64_t espera = nanossegundos(inicio - p.chegada);
+                const uint64_t latencia = nanossegundos(fim - p.chegada);
+                estatisticas.espera_ns_total += espera;
+                estatisticas.espera_ns_max = std::max(estatisticas.espera_ns_max, espera);
+                estatisticas.latencia_ns_total += latencia;
+                estatisticas.latencia_ns_max = std::max(estatisticas.latencia_ns_max, latencia);
+            }
+        }
+    }
+
+    void encerrar()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            parar = true;
+        }
+        cv.notify_all();
+        for (std::thread &t : despachantes)
+            if (t.joinable())
+                t.join();
+    }
+};
+
+/*!
+ * @brief Média de pedidos por lote.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+double EstatisticasServico::lote_medio() const
+{
+    return lotes == 0 ? 0.0 : static_cast<double>(concluidos) / static_cast<double>(lotes);
+}
+
+/*!
+ * @brief Espera média, em nanossegundos, dos pedidos concluídos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+double EstatisticasServico::espera_media_ns() const
+{
+    return concluidos == 0 ? 0.0
+                           : static_cast<double>(espera_ns_total) / static_cast<double>(concluidos);
+}
+
+/*!
+ * @brief Latência média, em nanossegundos, dos pedidos concluídos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+double EstatisticasServico::latencia_media_ns() const
+{
+    return concluidos == 0
+               ? 0.0
+               : static_cast<double>(latencia_ns_total) / static_cast<double>(concluidos);
+}
+
+/*!
+ * @brief Cria o serviço e inicia as threads despachantes.
+ *
+ * @param configuracao Tamanho máximo dos lotes, espera máxima e número de despachantes
+ *        (valores zero em lote_maximo e despachantes valem 1).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+ServicoCalculo::ServicoCalculo(const ConfiguracaoServico &configuracao)
+    : impl_(std::make_unique<Implementacao>(configuracao))
+{
+}
+
+/*!
+ * @brief Executa os pedidos pendentes e encerra os despachantes (ver encerrar()).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+ServicoCalculo::~ServicoCalculo()
+{
+    impl_->encerrar();
+}
+
+/*!
+ * @brief Retorna a configuração em uso.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+const ConfiguracaoServico &ServicoCalculo::configuracao() const
+{
+    return impl_->configuracao;
+}
+
+/*!
+ * @brief Pede o produto A * B.
+ *
+ * @param A Matriz m x k.
+ * @param B Matriz k x n.
+ * @param concluir Função chamada pela thread despachante com o resultado.
+ * @throws std::invalid_argument Se as dimensões forem incompatíveis.
+ * @throws std::runtime_error Se o serviço já tiver sido encerrado.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void ServicoCalculo::multiplicar(Matriz<double> A, Matriz<double> B,
+                                 Conclusao<Matriz<double>> concluir)
+{
+    if (A.colunas() != B.linhas())
+        throw std::invalid_argument("Matrizes com dimensões incompatíveis para multiplicação.");
+
+    Pedido pedido;
+    pedido.formato = {Operacao::multiplicar, A.linhas(), A.colunas(), B.colunas()};
+    pedido.A.emplace(std::move(A));
+    pedido.B.emplace(std::move(B));
+    pedido.concluir_matriz = std::move(concluir);
+    impl_->enfileirar(std::move(pedido));
+}
+
+/*!
+ * @brief Pede a solução de Ax = b (ver ifnum::resolverLU).
+ *
+ * Se A for singular, a conclusão recebe std::runtime_error("Matriz singular").
+ *
+ * @param A Matriz n x n.
+ * @param b Matriz n x p de lados direitos.
+ * @param concluir Função chamada pela thread despachante com o resultado.
+ * @throws std::invalid_argument Se A não for quadrada ou b não tiver n linhas.
+ * @throws std::runtime_error Se o serviço já tiver sido encerrado.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void ServicoCalculo::resolverLU(Matriz<double> A, Matriz<double> b,
+                                Conclusao<Matriz<double>> concluir)
+{
+    if (A.linhas() != A.colunas())
+        throw std::invalid_argument("Matriz não é quadrada.");
+    if (b.linhas() != A.linhas())
+        throw std::invalid_argument("Dimensões incompatíveis entre a matriz e o vetor.");
+
+    Pedido pedido;
+    pedido.formato = {Operacao::resolver, A.linhas(), A.colunas(), b.colunas()};
+    pedido.A.emplace(std::move(A));
+    pedido.B.emplace(std::move(b));
+    pedido.concluir_matriz = std::move(concluir);
+    impl_->enfileirar(std::move(pedido));
+}
+
+/*!
+ * @brief Pede o seno CORDIC de ângulos em graus (ver cordic::sin).
+ *
+ * Os ângulos podem ter qualquer valor: são reduzidos a [-90°, 90°] antes da rotação. NaN e
+ * infinitos resultam em NaN.
+ *
+ * @throws std::runtime_error Se o serviço já tiver sido encerrado.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void ServicoCalculo::seno(std::vector<double> angulos, Conclusao<std::vector<double>> concluir)
+{
+    Pedido pedido;
+    pedido.formato = {Operacao::seno};
+    pedido.valores = std::move(angulos);
+    pedido.concluir_vetor = std::move(concluir);
+    impl_->enfileirar(std::move(pedido));
+}
+
+/*!
+ * @brief Pede o cosseno CORDIC de ângulos em graus (ver cordic::cos).
+ *
+ * Os ângulos podem ter qualquer valor: são reduzidos a [-90°, 90°] antes da rotação. NaN e
+ * infinitos resultam em NaN.
+ *
+ * @throws std::runtime_error Se o serviço já tiver sido encerrado.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void ServicoCalculo::cosseno(std::vector<double> angulos, Conclusao<std::vector<double>> concluir)
+{
+    Pedido pedido;
+    pedido.formato = {Operacao::cosseno};
+    pedido.valores = std::move(angulos);
+    pedido.concluir_vetor = std::move(concluir);
+    impl_->enfileirar(std::move(pedido));
+}
+
+/*!
+ * @brief Pede o produto A * B (ver a versão com função de conclusão).
+ *
+ * @return Future com o produto.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+std::future<Matriz<double>> ServicoCalculo::multiplicar(Matriz<double> A, Matriz<double> B)
+{
+    auto promessa = std::make_shared<std::promise<Matriz<double>>>();
+    std::future<Matriz<double>> futuro = promessa->get_future();
+    multiplicar(std::move(A), std::move(B), cumprir(std::move(promessa)));
+    return futuro;
+}
+
+/*!
+ * @brief Pede a solução de Ax = b (ver a versão com função de conclusão).
+ *
+ * @return Future com a solução; `get()` lança std::runtime_error se A for singular.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+std::future<Matriz<double>> ServicoCalculo::resolverLU(Matriz<double> A, Matriz<double> b)
+{
+    auto promessa = std::make_shared<std::promise<Matriz<double>>>();
+    std::future<Matriz<double>> futuro = promessa->get_future();
+    resolverLU(std::move(A), std::move(b), cumprir(std::move(promessa)));
+    return futuro;
+}
+
+/*!
+ * @brief Pede o seno CORDIC de ângulos em graus.
+ *
+ * @return Future com os senos, na ordem dos ângulos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+std::future<std::vector<double>> ServicoCalculo::seno(std::vector<double> angulos)
+{
+    auto promessa = std::make_shared<std::promise<std::vector<double>>>();
+    std::future<std::vector<double>> futuro = promessa->get_future();
+    seno(std::move(angulos), cumprir(std::move(promessa)));
+    return futuro;
+}
+
+/*!
+ * @brief Pede o cosseno CORDIC de ângulos em graus.
+ *
+ * @return Future com os cossenos, na ordem dos ângulos.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+std::future<std::vector<double>> ServicoCalculo::cosseno(std::vector<double> angulos)
+{
+    auto promessa = std::make_shared<std::promise<std::vector<double>>>();
+    std::future<std::vector<double>> futuro = promessa->get_future();
+    cosseno(std::move(angulos), cumprir(std::move(promessa)));
+    return futuro;
+}
+
+/*!
+ * @brief Retorna uma cópia das estatísticas atuais.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+EstatisticasServico ServicoCalculo::estatisticas() const
+{
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->estatisticas;
+}
+
+/*!
+ * @brief Zera os contadores; `fila` continua com o número de pedidos aguardando.
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void ServicoCalculo::zerar_estatisticas()
+{
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->estatisticas = EstatisticasServico{};
+    impl_->estatisticas.fila = impl_->estatisticas.fila_maxima = impl_->fila.size();
+}
+
+/*!
+ * @brief Recusa novos pedidos, executa os pendentes (sem esperar espera_maxima) e encerra
+ *        os despachantes.
+ *
+ * Pode ser chamada mais de uma vez, mas não de dentro de uma função de conclusão (que roda
+ * em um despachante).
+ *
+ * @author Samuel Veras
+ * @date 17/10/2026
+ */
+void ServicoCalculo::encerrar()
+{
+    impl_->encerrar();
+}
+
+} // namespace ifnum